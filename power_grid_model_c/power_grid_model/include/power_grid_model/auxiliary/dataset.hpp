@@ -13,8 +13,10 @@
 #include "dataset_fwd.hpp"
 #include "meta_data.hpp"
 
+#include <algorithm>
 #include <span>
 #include <string_view>
+#include <vector>
 
 namespace power_grid_model {
 
@@ -164,6 +166,27 @@ template <typename T, dataset_type_tag dataset_type> class ColumnarAttributeRang
     auto iter() const { return std::ranges::subrange{begin(), end()}; }
     auto operator[](Idx idx) const { return *get(idx); }
 
+    // write consecutive values, starting at element idx, one attribute column at a time
+    //    the type of each attribute is resolved once for all values instead of once per element
+    void assign(Idx idx, std::span<std::remove_const_t<T> const> values) const
+        requires is_data_mutable_v<dataset_type>
+    {
+        for (auto const& attribute_buffer : attribute_buffers_) {
+            assert(attribute_buffer.meta_attribute != nullptr);
+            auto const& meta_attribute = *attribute_buffer.meta_attribute;
+            ctype_func_selector(meta_attribute.ctype, [&values, &attribute_buffer, &meta_attribute,
+                                                       first = start_ + idx]<typename AttributeType> {
+                AttributeType* buffer_ptr = reinterpret_cast<AttributeType*>(attribute_buffer.data) + first;
+                for (auto const& value : values) {
+                    *buffer_ptr++ = meta_attribute.template get_attribute<AttributeType const>(
+                        reinterpret_cast<RawDataConstPtr>(&value));
+                }
+            });
+        }
+    }
+
+    class BlockWriter;
+
   private:
     iterator get(Idx idx) const { return iterator{start_ + idx, attribute_buffers_}; }
 
@@ -172,6 +195,79 @@ template <typename T, dataset_type_tag dataset_type> class ColumnarAttributeRang
     std::span<AttributeBuffer<Data> const> attribute_buffers_;
 };
 
+// output iterator target that collects the rows written to a columnar range in a block
+//    a full block is written to the attribute columns at once, so rows can be produced as for a row-based buffer
+//    the rows must be written in order; call flush() after the last row
+template <typename T, dataset_type_tag dataset_type> class ColumnarAttributeRange<T, dataset_type>::BlockWriter {
+  public:
+    using value_type = std::remove_const_t<T>;
+
+    static constexpr Idx block_size = 256;
+
+    class iterator {
+      public:
+        using value_type = BlockWriter::value_type;
+        using difference_type = Idx;
+
+        iterator() = default;
+        iterator(BlockWriter* writer, Idx idx) : writer_{writer}, idx_{idx} {}
+
+        value_type& operator*() const { return writer_->row(idx_); }
+        iterator& operator++() {
+            ++idx_;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator const result = *this;
+            ++idx_;
+            return result;
+        }
+
+      private:
+        BlockWriter* writer_{};
+        Idx idx_{};
+    };
+
+    explicit BlockWriter(ColumnarAttributeRange range)
+        requires is_data_mutable_v<dataset_type>
+        : range_{std::move(range)}, block_(std::min(block_size, range_.size())) {}
+
+    // the iterators point to this writer
+    BlockWriter(BlockWriter const&) = delete;
+    BlockWriter& operator=(BlockWriter const&) = delete;
+    BlockWriter(BlockWriter&&) = delete;
+    BlockWriter& operator=(BlockWriter&&) = delete;
+    ~BlockWriter() = default;
+
+    iterator begin() { return iterator{this, 0}; }
+
+    void flush() {
+        range_.assign(block_start_, std::span<value_type const>{block_}.first(n_rows_));
+        block_start_ += n_rows_;
+        n_rows_ = 0;
+    }
+
+  private:
+    ColumnarAttributeRange range_;
+    std::vector<value_type> block_;
+    Idx block_start_{};
+    Idx n_rows_{}; // number of rows in the current block
+
+    value_type& row(Idx idx) {
+        if (idx - block_start_ == block_size) {
+            flush();
+        }
+        Idx const pos = idx - block_start_;
+        assert(0 <= pos && pos < block_size);
+        if (pos >= std::ssize(block_)) {
+            // more rows than the size of the range
+            block_.resize(block_size);
+        }
+        n_rows_ = std::max(n_rows_, pos + 1);
+        return block_[pos];
+    }
+};
+
 template <typename T> using const_range_object = ColumnarAttributeRange<T, const_dataset_t>;
 template <typename T> using mutable_range_object = ColumnarAttributeRange<T, mutable_dataset_t>;
 
@@ -30,6 +30,17 @@ struct get_attributes_list<BaseUpdate> {
     };
 };
 
+template<>
+struct get_attributes_list<NodeUpdate> {
+    static constexpr std::array<MetaAttribute, 3> value{
+            // all attributes including base class
+            
+            meta_data_gen::get_meta_attribute<&NodeUpdate::id>(offsetof(NodeUpdate, id), "id"),
+            meta_data_gen::get_meta_attribute<&NodeUpdate::u_init>(offsetof(NodeUpdate, u_init), "u_init"),
+            meta_data_gen::get_meta_attribute<&NodeUpdate::u_init_angle>(offsetof(NodeUpdate, u_init_angle), "u_init_angle"),
+    };
+};
+
 template<>
 struct get_attributes_list<BranchUpdate> {
     static constexpr std::array<MetaAttribute, 3> value{
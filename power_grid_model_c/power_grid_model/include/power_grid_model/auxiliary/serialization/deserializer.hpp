@@ -5,6 +5,7 @@
 #pragma once
 
 #include "common.hpp"
+#include "memory_mapped_file.hpp"
 
 #include "../../common/common.hpp"
 #include "../../common/exception.hpp"
@@ -16,6 +17,7 @@
 
 #include <msgpack.hpp>
 
+#include <filesystem>
 #include <set>
 #include <span>
 #include <sstream>
@@ -37,6 +39,9 @@ constexpr from_msgpack_t from_msgpack;
 struct from_json_t {};
 constexpr from_json_t from_json;
 
+struct from_file_t {};
+constexpr from_file_t from_file;
+
 namespace detail {
 
 using nlohmann::json;
@@ -431,6 +436,11 @@ class Deserializer {
                  MetaData const& meta_data)
         : Deserializer{create_from_format(data_buffer, serialization_format, meta_data)} {}
 
+    // the file is memory mapped, the msgpack data is parsed in place without loading the whole file
+    Deserializer(from_file_t /* tag */, std::filesystem::path const& file_path,
+                 SerializationFormat serialization_format, MetaData const& meta_data)
+        : Deserializer{create_from_format(MemoryMappedFile{file_path}, serialization_format, meta_data)} {}
+
     Deserializer(from_json_t /* tag */, std::string_view json_string, MetaData const& meta_data)
         : meta_data_{&meta_data},
           buffer_from_json_{json_to_msgpack(json_string)},
@@ -444,13 +454,26 @@ class Deserializer {
           size_{msgpack_data.size()},
           dataset_handler_{pre_parse()} {}
 
+    Deserializer(from_msgpack_t /* tag */, MemoryMappedFile mapped_file, MetaData const& meta_data)
+        : meta_data_{&meta_data},
+          mapped_file_{std::move(mapped_file)},
+          data_{mapped_file_.data()},
+          size_{mapped_file_.size()},
+          dataset_handler_{pre_parse()} {}
+
     WritableDataset& get_dataset_info() { return dataset_handler_; }
 
-    void parse() {
+    void parse() { parse(0, dataset_handler_.batch_size()); }
+
+    // parse the scenarios [scenario_begin, scenario_end) only
+    //    the buffers only need to hold the elements of these scenarios, see get_scenario_range_total_elements()
+    //    the indptr of a non-uniform component starts at zero for scenario_begin
+    void parse(Idx scenario_begin, Idx scenario_end) {
+        check_scenario_range(scenario_begin, scenario_end);
         root_key_ = "data";
         try {
             for (Idx i = 0; i != dataset_handler_.n_components(); ++i) {
-                parse_component(i);
+                parse_component(i, scenario_begin, scenario_end);
             }
         } catch (std::exception& e) {
             handle_error(e);
@@ -458,12 +481,21 @@ class Deserializer {
         root_key_ = {};
     }
 
+    // number of elements of a component in the scenarios [scenario_begin, scenario_end)
+    Idx get_scenario_range_total_elements(std::string_view component, Idx scenario_begin, Idx scenario_end) const {
+        check_scenario_range(scenario_begin, scenario_end);
+        Idx const component_idx = dataset_handler_.find_component(component, true);
+        return scenario_range_total_elements(component_idx, scenario_begin, scenario_end);
+    }
+
   private:
     // data members are order dependent
     // DO NOT modify the order!
     MetaData const* meta_data_;
     // own buffer if from json
     msgpack::sbuffer buffer_from_json_;
+    // own mapping if from msgpack file
+    MemoryMappedFile mapped_file_;
     // pointer to buffers
     char const* data_;
     size_t size_;
@@ -753,16 +785,35 @@ class Deserializer {
         return counter.front();
     }
 
-    void parse_component(Idx component_idx) {
+    void check_scenario_range(Idx scenario_begin, Idx scenario_end) const {
+        if (scenario_begin < 0 || scenario_begin > scenario_end || scenario_end > dataset_handler_.batch_size()) {
+            throw SerializationError{"Scenario range [" + std::to_string(scenario_begin) + ", " +
+                                     std::to_string(scenario_end) + ") out of range for batch size " +
+                                     std::to_string(dataset_handler_.batch_size()) + "!\n"};
+        }
+    }
+
+    Idx scenario_range_total_elements(Idx component_idx, Idx scenario_begin, Idx scenario_end) const {
+        auto const& info = dataset_handler_.get_component_info(component_idx);
+        if (info.elements_per_scenario >= 0) {
+            return info.elements_per_scenario * (scenario_end - scenario_begin);
+        }
+        auto const& msg_data = msg_data_offsets_[component_idx];
+        return std::transform_reduce(msg_data.cbegin() + scenario_begin, msg_data.cbegin() + scenario_end, Idx{},
+                                     std::plus{}, [](auto const& x) { return x.size; });
+    }
+
+    void parse_component(Idx component_idx, Idx scenario_begin, Idx scenario_end) {
         if (dataset_handler_.is_row_based(component_idx)) {
-            parse_component(row_based, component_idx);
+            parse_component(row_based, component_idx, scenario_begin, scenario_end);
         } else if (dataset_handler_.is_columnar(component_idx, true)) {
-            parse_component(columnar, component_idx);
+            parse_component(columnar, component_idx, scenario_begin, scenario_end);
         }
     }
 
     template <detail::row_based_or_columnar_c row_or_column_t>
-    void parse_component(row_or_column_t row_or_column_tag, Idx component_idx) {
+    void parse_component(row_or_column_t row_or_column_tag, Idx component_idx, Idx scenario_begin,
+                         Idx scenario_end) {
         auto const& buffer = dataset_handler_.get_buffer(component_idx);
 
         assert(dataset_handler_.is_row_based(buffer) == detail::is_row_based_v<row_or_column_t>);
@@ -773,11 +824,11 @@ class Deserializer {
         auto const& info = dataset_handler_.get_component_info(component_idx);
         auto const& msg_data = msg_data_offsets_[component_idx];
 
-        Idx const batch_size = dataset_handler_.batch_size();
         component_key_ = info.component->name;
 
         // set nan
-        set_nan(row_or_column_tag, buffer, info);
+        set_nan(row_or_column_tag, buffer, info,
+                scenario_range_total_elements(component_idx, scenario_begin, scenario_end));
 
         // handle indptr
         if (info.elements_per_scenario < 0) {
@@ -785,8 +836,8 @@ class Deserializer {
             buffer.indptr.front() = 0;
             // accumulate sum
             std::transform_inclusive_scan(
-                msg_data.cbegin(), msg_data.cend(), buffer.indptr.begin() + 1, std::plus{},
-                [](auto const& x) { return x.size; }, Idx{});
+                msg_data.cbegin() + scenario_begin, msg_data.cbegin() + scenario_end, buffer.indptr.begin() + 1,
+                std::plus{}, [](auto const& x) { return x.size; }, Idx{});
         }
 
         // attributes
@@ -814,14 +865,14 @@ class Deserializer {
         BufferView const buffer_view{
             .buffer = &buffer, .idx = 0, .reordered_attribute_buffers = reordered_attribute_buffers};
 
-        // all scenarios
-        for (scenario_number_ = 0; scenario_number_ != batch_size; ++scenario_number_) {
-            Idx const scenario_offset = info.elements_per_scenario < 0 ? buffer_view.buffer->indptr[scenario_number_]
-                                                                       : scenario_number_ * info.elements_per_scenario;
+        // all scenarios in the range, the buffer starts at scenario_begin
+        for (scenario_number_ = scenario_begin; scenario_number_ != scenario_end; ++scenario_number_) {
+            Idx const buffer_scenario = scenario_number_ - scenario_begin;
+            Idx const scenario_offset = info.elements_per_scenario < 0 ? buffer_view.buffer->indptr[buffer_scenario]
+                                                                       : buffer_scenario * info.elements_per_scenario;
 #ifndef NDEBUG
             if (info.elements_per_scenario < 0) {
-                assert(buffer_view.buffer->indptr[scenario_number_ + 1] -
-                           buffer_view.buffer->indptr[scenario_number_] ==
+                assert(buffer_view.buffer->indptr[buffer_scenario + 1] - buffer_view.buffer->indptr[buffer_scenario] ==
                        msg_data[scenario_number_].size);
 
             } else {
@@ -991,6 +1042,22 @@ class Deserializer {
         }
     }
 
+    static Deserializer create_from_format(MemoryMappedFile mapped_file, SerializationFormat serialization_format,
+                                           MetaData const& meta_data) {
+        switch (serialization_format) {
+        case SerializationFormat::json:
+            // the json is converted to msgpack, the mapping is not needed afterwards
+            return {from_json, std::string_view{mapped_file.data(), mapped_file.size()}, meta_data};
+        case SerializationFormat::msgpack:
+            return {from_msgpack, std::move(mapped_file), meta_data};
+        default: {
+            using namespace std::string_literals;
+            throw SerializationError("File input not supported for serialization format "s +
+                                     std::to_string(static_cast<IntS>(serialization_format)));
+        }
+        }
+    }
+
     static Deserializer create_from_format(std::span<char const> buffer, SerializationFormat serialization_format,
                                            MetaData const& meta_data) {
         switch (serialization_format) {
@@ -1006,17 +1073,16 @@ class Deserializer {
         }
     }
 
-    static void set_nan(row_based_t /*tag*/, Buffer const& buffer, ComponentInfo const& info) {
+    static void set_nan(row_based_t /*tag*/, Buffer const& buffer, ComponentInfo const& info, Idx size) {
         assert(is_row_based(buffer));
-        info.component->set_nan(buffer.data, 0, info.total_elements);
+        info.component->set_nan(buffer.data, 0, size);
     }
-    static void set_nan(columnar_t /*tag*/, Buffer const& buffer, ComponentInfo const& info) {
+    static void set_nan(columnar_t /*tag*/, Buffer const& buffer, ComponentInfo const& /*info*/, Idx size) {
         assert(is_columnar(buffer));
         for (auto const& attribute_buffer : buffer.attributes) {
             if (attribute_buffer.meta_attribute != nullptr) {
-                ctype_func_selector(attribute_buffer.meta_attribute->ctype, [&attribute_buffer, &info]<typename T> {
-                    std::ranges::fill(std::span{reinterpret_cast<T*>(attribute_buffer.data),
-                                                narrow_cast<size_t>(info.total_elements)},
+                ctype_func_selector(attribute_buffer.meta_attribute->ctype, [&attribute_buffer, size]<typename T> {
+                    std::ranges::fill(std::span{reinterpret_cast<T*>(attribute_buffer.data), narrow_cast<size_t>(size)},
                                       nan_value<T>);
                 });
             }
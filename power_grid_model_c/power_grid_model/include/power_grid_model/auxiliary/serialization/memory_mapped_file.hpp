@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../../common/exception.hpp"
+
+#include <filesystem>
+#include <span>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace power_grid_model::meta_data {
+
+// read-only memory mapping of a whole file
+//    the pages are loaded by the operating system on access and can be evicted again under memory pressure,
+//    so the file content does not need to fit in memory
+class MemoryMappedFile {
+  public:
+    MemoryMappedFile() = default;
+    explicit MemoryMappedFile(std::filesystem::path const& file_path) { map(file_path); }
+
+    // not copyable
+    MemoryMappedFile(MemoryMappedFile const&) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
+    // movable
+    MemoryMappedFile(MemoryMappedFile&& other) noexcept
+        : data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)} {}
+    MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    ~MemoryMappedFile() { unmap(); }
+
+    char const* data() const { return data_; }
+    size_t size() const { return size_; }
+    std::span<char const> span() const { return {data_, size_}; }
+
+  private:
+    char const* data_{nullptr};
+    size_t size_{0};
+
+    [[noreturn]] static void throw_error(std::filesystem::path const& file_path, char const* reason) {
+        throw SerializationError{"Cannot " + std::string{reason} + " file: " + file_path.string() + "\n"};
+    }
+
+#ifdef _WIN32
+    void map(std::filesystem::path const& file_path) {
+        HANDLE const file = CreateFileW(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw_error(file_path, "open");
+        }
+        LARGE_INTEGER file_size{};
+        if (GetFileSizeEx(file, &file_size) == 0) {
+            CloseHandle(file);
+            throw_error(file_path, "read the size of");
+        }
+        // an empty file cannot be mapped
+        if (file_size.QuadPart == 0) {
+            CloseHandle(file);
+            return;
+        }
+        HANDLE const mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        // the view keeps the file open
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            throw_error(file_path, "map");
+        }
+        void const* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (view == nullptr) {
+            throw_error(file_path, "map");
+        }
+        data_ = static_cast<char const*>(view);
+        size_ = static_cast<size_t>(file_size.QuadPart);
+    }
+
+    void unmap() noexcept {
+        if (data_ != nullptr) {
+            UnmapViewOfFile(data_);
+        }
+        data_ = nullptr;
+        size_ = 0;
+    }
+#else
+    void map(std::filesystem::path const& file_path) {
+        int const file = ::open(file_path.c_str(), O_RDONLY); // NOLINT(cppcoreguidelines-pro-type-vararg)
+        if (file < 0) {
+            throw_error(file_path, "open");
+        }
+        struct stat file_stat{};
+        if (::fstat(file, &file_stat) != 0) {
+            ::close(file);
+            throw_error(file_path, "read the size of");
+        }
+        // an empty file cannot be mapped
+        if (file_stat.st_size == 0) {
+            ::close(file);
+            return;
+        }
+        auto const file_size = static_cast<size_t>(file_stat.st_size);
+        void* const view = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file, 0);
+        // the mapping keeps the file open
+        ::close(file);
+        if (view == MAP_FAILED) { // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+            throw_error(file_path, "map");
+        }
+        data_ = static_cast<char const*>(view);
+        size_ = file_size;
+    }
+
+    void unmap() noexcept {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+        data_ = nullptr;
+        size_ = 0;
+    }
+#endif
+};
+
+} // namespace power_grid_model::meta_data
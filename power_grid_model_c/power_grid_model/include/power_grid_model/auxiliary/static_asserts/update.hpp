@@ -16,6 +16,13 @@ namespace power_grid_model::test {
 // static asserts for BaseUpdate
 static_assert(std::is_standard_layout_v<BaseUpdate>);
 
+// static asserts for NodeUpdate
+static_assert(std::is_standard_layout_v<NodeUpdate>);
+// static asserts for conversion of NodeUpdate to BaseUpdate
+static_assert(std::alignment_of_v<NodeUpdate> >= std::alignment_of_v<BaseUpdate>);
+static_assert(std::same_as<decltype(NodeUpdate::id), decltype(BaseUpdate::id)>);
+static_assert(offsetof(NodeUpdate, id) == offsetof(BaseUpdate, id));
+
 // static asserts for BranchUpdate
 static_assert(std::is_standard_layout_v<BranchUpdate>);
 // static asserts for conversion of BranchUpdate to BaseUpdate
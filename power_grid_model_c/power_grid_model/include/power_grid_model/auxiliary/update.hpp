@@ -19,6 +19,16 @@ struct BaseUpdate {
     ID id{na_IntID};  // ID of the object
 };
 
+struct NodeUpdate {
+    ID id{na_IntID};  // ID of the object
+    double u_init{nan};  // initial voltage magnitude (p.u.) and angle of the iterative power flow
+    double u_init_angle{nan};  // initial voltage magnitude (p.u.) and angle of the iterative power flow
+
+    // implicit conversions to BaseUpdate
+    operator BaseUpdate&() { return reinterpret_cast<BaseUpdate&>(*this); }
+    operator BaseUpdate const&() const { return reinterpret_cast<BaseUpdate const&>(*this); }
+};
+
 struct BranchUpdate {
     ID id{na_IntID};  // ID of the object
     IntS from_status{na_IntS};  // whether the branch is connected at each side
@@ -0,0 +1,333 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// reduction of the output of a batch calculation over its scenarios
+
+#include "auxiliary/dataset.hpp"
+#include "auxiliary/meta_data.hpp"
+#include "common/common.hpp"
+#include "common/enum.hpp"
+#include "common/exception.hpp"
+#include "common/three_phase_tensor.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace power_grid_model {
+
+// Reduction of output attributes over the scenarios of a batch calculation.
+// The output of each scenario is folded into one accumulated value per element (and per phase for asymmetric
+// attributes), so the memory use depends on the number of elements and not on the batch size.
+// Failed scenarios and NaN values are left out.
+class BatchReduction {
+  public:
+    struct Request {
+        meta_data::MetaComponent const* component;
+        meta_data::MetaAttribute const* attribute;
+        ReductionType type;
+        double threshold;
+        // one value per element (and per phase) of the component, in the order of the output
+        //    minimum, maximum and mean: double, NaN if there are no values
+        //    arg_minimum and arg_maximum: Idx, the first scenario with the extreme value, -1 if there are no values
+        //    count_above and count_below: Idx
+        meta_data::RawDataPtr result;
+    };
+
+    // accumulated values of the scenarios calculated by one thread
+    class Accumulator;
+
+    static constexpr Idx no_scenario = -1;
+
+    BatchReduction(std::string_view dataset_name, meta_data::MetaData const& meta_data)
+        : meta_data_{&meta_data}, dataset_{&meta_data.get_dataset(dataset_name)} {}
+
+    meta_data::MetaData const& meta_data() const { return *meta_data_; }
+    meta_data::MetaDataset const& dataset() const { return *dataset_; }
+    std::vector<Request> const& requests() const { return requests_; }
+
+    void add_request(std::string_view component, std::string_view attribute, ReductionType type, double threshold,
+                     meta_data::RawDataPtr result) {
+        meta_data::MetaComponent const& meta_component = dataset_->get_component(component);
+        meta_data::MetaAttribute const& meta_attribute = meta_component.get_attribute(attribute);
+        switch (type) {
+            using enum ReductionType;
+        case minimum:
+        case maximum:
+        case mean:
+        case arg_minimum:
+        case arg_maximum:
+        case count_above:
+        case count_below:
+            break;
+        default:
+            throw MissingCaseForEnumError{"BatchReduction::add_request", type};
+        }
+        if (result == nullptr) {
+            throw DatasetError{"The result buffer of a batch reduction cannot be null!\n"};
+        }
+        requests_.push_back(Request{.component = &meta_component,
+                                    .attribute = &meta_attribute,
+                                    .type = type,
+                                    .threshold = threshold,
+                                    .result = result});
+    }
+
+  private:
+    meta_data::MetaData const* meta_data_;
+    meta_data::MetaDataset const* dataset_;
+    std::vector<Request> requests_;
+};
+
+class BatchReduction::Accumulator {
+  public:
+    // n_elements contains the number of elements in the model of the component of each request
+    Accumulator(BatchReduction const& reduction, std::vector<Idx> const& n_elements)
+        : reduction_{&reduction}, scenario_output_{false, 1, reduction.dataset().name, reduction.meta_data()} {
+        auto const& requests = reduction.requests();
+        assert(n_elements.size() == requests.size());
+        states_.reserve(requests.size());
+        for (Idx idx = 0; idx != std::ssize(requests); ++idx) {
+            Request const& request = requests[idx];
+            Idx const size = n_elements[idx] * (request.attribute->ctype == CType::c_double3 ? 3 : 1);
+            State& state = states_.emplace_back(
+                State{.column = get_column(request, n_elements[idx]), .values = {}, .indices = {}});
+            switch (request.type) {
+                using enum ReductionType;
+            case minimum:
+            case maximum:
+            case arg_minimum:
+            case arg_maximum:
+                state.values.resize(size, nan);
+                state.indices.resize(size, no_scenario);
+                break;
+            case mean:
+                state.values.resize(size, 0.0);
+                state.indices.resize(size, 0);
+                break;
+            default:
+                state.indices.resize(size, 0);
+                break;
+            }
+        }
+
+        // the scenario output only contains the attributes to reduce
+        for (Column& column : columns_) {
+            if (!scenario_output_.contains_component(column.component->name)) {
+                scenario_output_.add_buffer(column.component->name, column.n_elements, column.n_elements, nullptr,
+                                            nullptr);
+            }
+            scenario_output_.add_attribute_buffer(column.component->name, column.attribute->name,
+                                                  column.data.data());
+        }
+    }
+
+    // the scenario output points to the columns of this accumulator
+    Accumulator(Accumulator const&) = delete;
+    Accumulator& operator=(Accumulator const&) = delete;
+    Accumulator(Accumulator&&) noexcept = default;
+    Accumulator& operator=(Accumulator&&) noexcept = default;
+    ~Accumulator() = default;
+
+    // the calculation of a scenario writes its output to the first (and only) scenario of this dataset
+    MutableDataset const& data() const { return scenario_output_; }
+    static constexpr Idx position(Idx /* scenario */) { return 0; }
+
+    // fold the output of the scenario that was just calculated
+    void add_scenario(Idx scenario) {
+        auto const& requests = reduction_->requests();
+        for (Idx idx = 0; idx != std::ssize(requests); ++idx) {
+            Request const& request = requests[idx];
+            State& state = states_[idx];
+            Column const& column = columns_[state.column];
+            meta_data::ctype_func_selector(
+                column.attribute->ctype, [&request, &state, &column, scenario]<typename T>() {
+                    auto const* values = reinterpret_cast<T const*>(column.data.data());
+                    for (Idx element = 0; element != column.n_elements; ++element) {
+                        if constexpr (std::same_as<T, RealValue<asymmetric_t>>) {
+                            for (Idx phase = 0; phase != 3; ++phase) {
+                                accumulate(request, state, 3 * element + phase, values[element](phase), scenario);
+                            }
+                        } else if constexpr (std::floating_point<T>) {
+                            accumulate(request, state, element, values[element], scenario);
+                        } else if (!is_nan(values[element])) {
+                            accumulate(request, state, element, static_cast<double>(values[element]), scenario);
+                        }
+                    }
+                });
+        }
+    }
+
+    // fold the accumulated values of another thread
+    void merge(Accumulator const& other) {
+        assert(other.reduction_ == reduction_);
+        auto const& requests = reduction_->requests();
+        for (Idx idx = 0; idx != std::ssize(requests); ++idx) {
+            State& state = states_[idx];
+            State const& other_state = other.states_[idx];
+            for (Idx value_idx = 0; value_idx != std::ssize(state.indices); ++value_idx) {
+                switch (requests[idx].type) {
+                    using enum ReductionType;
+                case minimum:
+                case maximum:
+                case arg_minimum:
+                case arg_maximum:
+                    update_extreme(requests[idx].type, state, value_idx, other_state.values[value_idx],
+                                   other_state.indices[value_idx]);
+                    break;
+                case mean:
+                    state.values[value_idx] += other_state.values[value_idx];
+                    state.indices[value_idx] += other_state.indices[value_idx];
+                    break;
+                default:
+                    state.indices[value_idx] += other_state.indices[value_idx];
+                    break;
+                }
+            }
+        }
+    }
+
+    // write the reduced values to the result buffers of the requests
+    void write_results() const {
+        auto const& requests = reduction_->requests();
+        for (Idx idx = 0; idx != std::ssize(requests); ++idx) {
+            Request const& request = requests[idx];
+            State const& state = states_[idx];
+            switch (request.type) {
+                using enum ReductionType;
+            case minimum:
+            case maximum: {
+                auto* const result = static_cast<double*>(request.result);
+                for (Idx value_idx = 0; value_idx != std::ssize(state.indices); ++value_idx) {
+                    result[value_idx] = state.indices[value_idx] == no_scenario ? nan : state.values[value_idx];
+                }
+                break;
+            }
+            case mean: {
+                auto* const result = static_cast<double*>(request.result);
+                for (Idx value_idx = 0; value_idx != std::ssize(state.indices); ++value_idx) {
+                    result[value_idx] = state.indices[value_idx] == 0
+                                            ? nan
+                                            : state.values[value_idx] / static_cast<double>(state.indices[value_idx]);
+                }
+                break;
+            }
+            default:
+                std::ranges::copy(state.indices, static_cast<Idx*>(request.result));
+                break;
+            }
+        }
+    }
+
+  private:
+    // output of one attribute of the scenario that was just calculated
+    struct Column {
+        meta_data::MetaComponent const* component;
+        meta_data::MetaAttribute const* attribute;
+        Idx n_elements;
+        std::vector<double> data; // storage for n_elements values of the attribute, aligned for all ctypes
+    };
+    // accumulated values of one request
+    struct State {
+        Idx column;
+        std::vector<double> values; // extreme value or sum
+        std::vector<Idx> indices;   // scenario of the extreme value or number of values
+    };
+
+    BatchReduction const* reduction_;
+    std::vector<Column> columns_;
+    std::vector<State> states_;
+    MutableDataset scenario_output_;
+
+    Idx get_column(Request const& request, Idx n_elements) {
+        for (Idx idx = 0; idx != std::ssize(columns_); ++idx) {
+            if (columns_[idx].component == request.component && columns_[idx].attribute == request.attribute) {
+                return idx;
+            }
+        }
+        auto const bytes = static_cast<size_t>(n_elements) * request.attribute->size;
+        columns_.push_back(Column{.component = request.component,
+                                  .attribute = request.attribute,
+                                  .n_elements = n_elements,
+                                  .data = std::vector<double>((bytes + sizeof(double) - 1) / sizeof(double))});
+        return std::ssize(columns_) - 1;
+    }
+
+    // the extreme values are independent of the order of the scenarios: on equal values, the first scenario is kept
+    static void update_extreme(ReductionType type, State& state, Idx value_idx, double value, Idx scenario) {
+        if (scenario == no_scenario) {
+            return;
+        }
+        Idx const current_scenario = state.indices[value_idx];
+        double const current_value = state.values[value_idx];
+        bool const is_minimum = type == ReductionType::minimum || type == ReductionType::arg_minimum;
+        if (current_scenario == no_scenario || (is_minimum ? value < current_value : value > current_value) ||
+            (value == current_value && scenario < current_scenario)) {
+            state.values[value_idx] = value;
+            state.indices[value_idx] = scenario;
+        }
+    }
+
+    static void accumulate(Request const& request, State& state, Idx value_idx, double value, Idx scenario) {
+        if (is_nan(value)) {
+            return;
+        }
+        switch (request.type) {
+            using enum ReductionType;
+        case minimum:
+        case maximum:
+        case arg_minimum:
+        case arg_maximum:
+            update_extreme(request.type, state, value_idx, value, scenario);
+            return;
+        case mean:
+            state.values[value_idx] += value;
+            ++state.indices[value_idx];
+            return;
+        case count_above:
+            if (value > request.threshold) {
+                ++state.indices[value_idx];
+            }
+            return;
+        case count_below:
+            if (value < request.threshold) {
+                ++state.indices[value_idx];
+            }
+            return;
+        default:
+            throw MissingCaseForEnumError{"BatchReduction::Accumulator::accumulate", request.type};
+        }
+    }
+};
+
+// batch result that reduces the output of all scenarios
+//    each thread accumulates the scenarios it calculates in its own accumulator, which is merged when the thread is
+//    done
+class BatchReductionResult {
+  public:
+    BatchReductionResult(BatchReduction const& reduction, std::vector<Idx> n_elements)
+        : reduction_{&reduction}, n_elements_{std::move(n_elements)}, total_{reduction, n_elements_} {}
+
+    BatchReduction::Accumulator thread_result() const { return BatchReduction::Accumulator{*reduction_, n_elements_}; }
+    void merge(BatchReduction::Accumulator const& thread_result) {
+        std::scoped_lock const lock{mutex_};
+        total_.merge(thread_result);
+    }
+
+    void write_results() const { total_.write_results(); }
+
+  private:
+    BatchReduction const* reduction_;
+    std::vector<Idx> n_elements_;
+    BatchReduction::Accumulator total_;
+    std::mutex mutex_;
+};
+
+} // namespace power_grid_model
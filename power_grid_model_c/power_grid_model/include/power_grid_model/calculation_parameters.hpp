@@ -220,6 +220,7 @@ template <symmetry_tag sym_type> struct PowerFlowInput {
 
     ComplexVector source;                // Complex u_ref of each source
     ComplexValueVector<sym> s_injection; // Specified injection power of each load_gen
+    ComplexValueVector<sym> u_init;      // Initial voltage of each bus, nan if not specified, may be empty
 };
 
 template <symmetry_tag sym_type> struct StateEstimationInput {
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "common.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace power_grid_model {
+
+// number of chunks in flight in a batch pipeline: one being produced, one being calculated and one being consumed
+constexpr Idx batch_pipeline_n_slots = 3;
+
+// Run a batch of n_scenarios in chunks of chunk_size consecutive scenarios through three stages:
+//     produce(slot, begin, end), calculate(slot, begin, end) and consume(slot, begin, end)
+// The stages run concurrently in their own thread (calculate in the calling thread), each handling the chunks in
+// order. A chunk uses slot (chunk_number % batch_pipeline_n_slots), so each stage can keep the buffers of at most
+// batch_pipeline_n_slots chunks, independent of the batch size. A slot is only produced again after its previous
+// chunk is consumed.
+// If any stage throws, the other stages stop after their current chunk and the first exception is re-thrown.
+template <typename Produce, typename Calculate, typename Consume>
+    requires std::invocable<Produce&, Idx, Idx, Idx> && std::invocable<Calculate&, Idx, Idx, Idx> &&
+             std::invocable<Consume&, Idx, Idx, Idx>
+void run_batch_pipeline(Idx n_scenarios, Idx chunk_size, Produce produce, Calculate calculate, Consume consume) {
+    chunk_size = std::max(chunk_size, Idx{1});
+    Idx const n_chunks = (n_scenarios + chunk_size - 1) / chunk_size;
+
+    std::mutex mutex;
+    std::condition_variable progress;
+    // number of finished chunks per stage
+    Idx n_produced{};
+    Idx n_calculated{};
+    Idx n_consumed{};
+    std::exception_ptr exception{};
+
+    // wait until the chunk can be handled by the stage, false if the pipeline failed
+    auto const wait_for = [&mutex, &progress, &exception](auto const& ready) {
+        std::unique_lock lock{mutex};
+        progress.wait(lock, [&ready, &exception] { return exception || ready(); });
+        return !exception;
+    };
+    auto const finish = [&mutex, &progress](Idx& n_finished) {
+        {
+            std::scoped_lock const lock{mutex};
+            ++n_finished;
+        }
+        progress.notify_all();
+    };
+    auto const fail = [&mutex, &progress, &exception] {
+        {
+            std::scoped_lock const lock{mutex};
+            if (!exception) {
+                exception = std::current_exception();
+            }
+        }
+        progress.notify_all();
+    };
+    auto const run_stage = [n_scenarios, n_chunks, chunk_size, &wait_for, &finish, &fail](
+                               auto& stage, auto const& ready, Idx& n_finished) {
+        try {
+            for (Idx chunk = 0; chunk != n_chunks; ++chunk) {
+                if (!wait_for([&ready, chunk] { return ready(chunk); })) {
+                    return;
+                }
+                Idx const begin = chunk * chunk_size;
+                stage(chunk % batch_pipeline_n_slots, begin, std::min(begin + chunk_size, n_scenarios));
+                finish(n_finished);
+            }
+        } catch (...) {
+            fail();
+        }
+    };
+
+    std::thread producer{[&] {
+        run_stage(produce, [&n_consumed](Idx chunk) { return chunk - n_consumed < batch_pipeline_n_slots; },
+                  n_produced);
+    }};
+    std::thread consumer{
+        [&] { run_stage(consume, [&n_calculated](Idx chunk) { return chunk < n_calculated; }, n_consumed); }};
+    run_stage(calculate, [&n_produced](Idx chunk) { return chunk < n_produced; }, n_calculated);
+
+    producer.join();
+    consumer.join();
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+} // namespace power_grid_model
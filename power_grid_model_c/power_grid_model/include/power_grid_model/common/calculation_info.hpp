@@ -4,13 +4,207 @@
 
 #pragma once
 
+#include "common.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <string>
+#include <string_view>
 
 namespace power_grid_model {
 
-using CalculationInfo = std::map<std::string, double, std::less<>>;
+// events that can be logged during a calculation
+//    the values are dense, so that they can be used as index into the registry
+enum class LogEvent : uint8_t {
+    total = 0,
+    build_model = 1,
+    total_batch_calculation_in_thread = 2,
+    total_single_calculation_in_thread = 3,
+    copy_model = 4,
+    update_model = 5,
+    restore_model = 6,
+    prepare = 7,
+    math_calculation = 8,
+    create_math_solver = 9,
+    math_solver = 10,
+    initialize_calculation = 11,
+    preprocess_measured_value = 12,
+    prepare_matrix = 13,
+    prepare_matrix_including_prefactorization = 14,
+    prepare_matrices = 15,
+    initialize_voltages = 16,
+    calculate_rhs = 17,
+    prepare_lhs_rhs = 18,
+    solve_sparse_linear_equation = 19,
+    solve_sparse_linear_equation_linear_pf = 20,
+    solve_sparse_linear_equation_se = 21,
+    solve_sparse_linear_equation_prefactorized = 22,
+    iterate_unknown = 23,
+    iterate_unknown_se = 24,
+    calculate_math_result = 25,
+    calculate_math_result_linear_pf = 26,
+    calculate_math_result_se = 27,
+    produce_output = 28,
+    iterations = 29,
+    max_num_iter = 30,
+    max_num_iter_se = 31,
+    factorizations = 32,
+    pivot_perturbations = 33,
+    partial_factorizations = 34,
+};
+
+// timings accumulate the duration in seconds, counters accumulate the count, maxima keep the largest value
+enum class LogEventKind : uint8_t { timing = 0, counter = 1, maximum = 2 };
+
+struct LogEventDescription {
+    int code;
+    std::string_view name;
+    LogEventKind kind;
+};
+
+// the codes and names are part of the calculation info reported to the users, do not change them for existing events
+//    the iterative power flow, the linear power flow and the state estimation report some of the same steps under
+//    different codes; the events without suffix are those of the iterative power flow
+constexpr std::array log_event_descriptions{
+    LogEventDescription{0, "Total", LogEventKind::timing},
+    LogEventDescription{1000, "Build model", LogEventKind::timing},
+    LogEventDescription{0, "Total in thread", LogEventKind::timing},
+    LogEventDescription{100, "Total single calculation in thread", LogEventKind::timing},
+    LogEventDescription{1100, "Copy model", LogEventKind::timing},
+    LogEventDescription{1200, "Update model", LogEventKind::timing},
+    LogEventDescription{1201, "Restore model", LogEventKind::timing},
+    LogEventDescription{2100, "Prepare", LogEventKind::timing},
+    LogEventDescription{2200, "Math Calculation", LogEventKind::timing},
+    LogEventDescription{2210, "Create math solver", LogEventKind::timing},
+    LogEventDescription{2220, "Math solver", LogEventKind::timing},
+    LogEventDescription{2221, "Initialize calculation", LogEventKind::timing},
+    LogEventDescription{2221, "Pre-process measured value", LogEventKind::timing},
+    LogEventDescription{2221, "Prepare matrix", LogEventKind::timing},
+    LogEventDescription{2222, "Prepare matrix, including pre-factorization", LogEventKind::timing},
+    LogEventDescription{2222, "Prepare the matrices", LogEventKind::timing},
+    LogEventDescription{2223, "Initialize voltages", LogEventKind::timing},
+    LogEventDescription{2224, "Calculate rhs", LogEventKind::timing},
+    LogEventDescription{2224, "Prepare LHS rhs", LogEventKind::timing},
+    LogEventDescription{2223, "Solve sparse linear equation", LogEventKind::timing},
+    LogEventDescription{2222, "Solve sparse linear equation", LogEventKind::timing},
+    LogEventDescription{2225, "Solve sparse linear equation", LogEventKind::timing},
+    LogEventDescription{2225, "Solve sparse linear equation (pre-factorized)", LogEventKind::timing},
+    LogEventDescription{2224, "Iterate unknown", LogEventKind::timing},
+    LogEventDescription{2226, "Iterate unknown", LogEventKind::timing},
+    LogEventDescription{2225, "Calculate math result", LogEventKind::timing},
+    LogEventDescription{2223, "Calculate math result", LogEventKind::timing},
+    LogEventDescription{2227, "Calculate math result", LogEventKind::timing},
+    LogEventDescription{3000, "Produce output", LogEventKind::timing},
+    LogEventDescription{2230, "Number of iterations", LogEventKind::counter},
+    LogEventDescription{2226, "Max number of iterations", LogEventKind::maximum},
+    LogEventDescription{2228, "Max number of iterations", LogEventKind::maximum},
+    LogEventDescription{2232, "Number of factorizations", LogEventKind::counter},
+    LogEventDescription{2233, "Number of pivot perturbations", LogEventKind::counter},
+    LogEventDescription{2234, "Number of partial factorizations", LogEventKind::counter},
+};
+constexpr Idx n_log_events = static_cast<Idx>(log_event_descriptions.size());
+static_assert(static_cast<Idx>(LogEvent::partial_factorizations) == n_log_events - 1);
+
+constexpr LogEventDescription const& describe(LogEvent event) {
+    return log_event_descriptions[static_cast<size_t>(event)];
+}
+
+// fixed-size registry of the logged events of a calculation
+//    recording an event is an array access, no allocation or string formatting is involved
+//    each thread logs into its own instance; the instances are merged afterwards
+class CalculationInfo {
+  public:
+    using Report = std::map<std::string, double, std::less<>>;
+
+    void add(LogEvent event, double value) {
+        auto const idx = static_cast<size_t>(event);
+        if (describe(event).kind == LogEventKind::maximum && recorded_[idx]) {
+            values_[idx] = std::max(values_[idx], value);
+        } else {
+            values_[idx] += value;
+        }
+        recorded_[idx] = true;
+    }
+
+    double get(LogEvent event) const { return values_[static_cast<size_t>(event)]; }
+    bool has(LogEvent event) const { return recorded_[static_cast<size_t>(event)]; }
+    bool empty() const { return recorded_.none(); }
+
+    void merge(CalculationInfo const& other) {
+        for (size_t idx = 0; idx != values_.size(); ++idx) {
+            if (other.recorded_[idx]) {
+                add(static_cast<LogEvent>(idx), other.values_[idx]);
+            }
+        }
+    }
+
+    void clear() { *this = CalculationInfo{}; }
+
+    // the share of one of n_calculations calculations that are done together
+    //    the timings and the counters are divided evenly, the maxima are kept
+    CalculationInfo shared_by(Idx n_calculations) const {
+        CalculationInfo result{*this};
+        for (size_t idx = 0; idx != values_.size(); ++idx) {
+            if (log_event_descriptions[idx].kind != LogEventKind::maximum) {
+                result.values_[idx] /= static_cast<double>(n_calculations);
+            }
+        }
+        return result;
+    }
+
+    // human readable overview of the recorded events, keyed by code and name
+    Report report() const {
+        Report result;
+        for (size_t idx = 0; idx != values_.size(); ++idx) {
+            if (recorded_[idx]) {
+                auto const& description = log_event_descriptions[idx];
+                result[make_key(description.code, description.name)] = values_[idx];
+            }
+        }
+        return result;
+    }
+
+    static std::string make_key(int code, std::string_view name) {
+        std::string key(5, '.');
+        for (Idx pos = 3; pos >= 0; --pos, code /= 10) {
+            key[pos] = static_cast<char>('0' + code % 10);
+        }
+        for (size_t i = 0, n = key.length() - 1; i < n; ++i) {
+            if (key[i] == '0') {
+                break;
+            }
+            key += "\t";
+        }
+        key += name;
+        return key;
+    }
+
+  private:
+    std::array<double, n_log_events> values_{};
+    std::bitset<n_log_events> recorded_{};
+};
+
+// logarithmic histogram of event values
+//    bin i contains the values in [2^(i + min_exponent), 2^(i + 1 + min_exponent))
+//    smaller values (including zero) are put in the first bin, larger values in the last bin
+namespace log2_histogram {
+constexpr Idx n_bins = 64;
+constexpr Idx min_exponent = -32;
+
+inline Idx bin(double value) {
+    if (!(value > 0.0)) {
+        return 0;
+    }
+    int exponent{};
+    std::frexp(value, &exponent); // value in [2^(exponent - 1), 2^exponent)
+    return std::clamp(Idx{exponent - 1} - min_exponent, Idx{0}, n_bins - 1);
+}
+} // namespace log2_histogram
 
 } // namespace power_grid_model
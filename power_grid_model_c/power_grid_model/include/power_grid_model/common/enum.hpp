@@ -34,6 +34,7 @@ enum class CalculationMethod : IntS {
     iterative_current = 3,
     linear_current = 4,
     iec60909 = 5,
+    fast_decoupled = 6,
 };
 
 enum class MeasuredTerminalType : IntS {
@@ -103,6 +104,11 @@ enum class FaultPhase : IntS {
 
 enum class ShortCircuitVoltageScaling : IntS { minimum = 0, maximum = 1 };
 
+enum class SparseOrderingMethod : IntS { // Fill-reducing ordering of the cyclic nodes of the math models
+    minimum_degree = 0,                  // minimum degree on the elimination graph
+    approximate_minimum_degree = 1,      // approximate minimum degree on the quotient graph
+};
+
 enum class CType : IntS { c_int32 = 0, c_int8 = 1, c_double = 2, c_double3 = 3 };
 
 enum class SerializationFormat : IntS { json = 0, msgpack = 1 };
@@ -124,6 +130,7 @@ enum class OptimizerStrategy : IntS { // Conventions for optimization strategies
 enum class SearchMethod : IntS { // Which type of tap search method for finite element optimization process
     linear_search = 0,           // use linear_search method: one step per iteration
     binary_search = 1,           // use binary search: half a tap range at a time
+    sensitivity_search = 2,      // use sensitivity search: jump to the tap predicted from the measured sensitivity
 };
 
 enum class AngleMeasurementType : IntS { // The type of the angle measurement for current sensors
@@ -131,4 +138,14 @@ enum class AngleMeasurementType : IntS { // The type of the angle measurement fo
     global_angle = 1,                    // global_angle = 1, the angle is relative to the global voltage angle
 };
 
+enum class ReductionType : IntS { // Reduction of an output attribute over the scenarios of a batch
+    minimum = 0,                  // minimum value
+    maximum = 1,                  // maximum value
+    mean = 2,                     // mean value
+    arg_minimum = 3,              // scenario with the minimum value
+    arg_maximum = 4,              // scenario with the maximum value
+    count_above = 5,              // number of scenarios with a value above the threshold
+    count_below = 6,              // number of scenarios with a value below the threshold
+};
+
 } // namespace power_grid_model
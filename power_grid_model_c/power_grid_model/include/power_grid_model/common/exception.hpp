@@ -241,6 +241,14 @@ class BatchCalculationError : public CalculationError {
     std::vector<std::string> err_msgs_;
 };
 
+class BatchPipelineAborted : public PowerGridError {
+  public:
+    BatchPipelineAborted(std::string_view stage, Idx scenario_begin, Idx scenario_end) {
+        append_msg(std::format("The {} of the batch pipeline aborted the calculation at scenarios [{}, {})!\n", stage,
+                               scenario_begin, scenario_end));
+    }
+};
+
 class InvalidCalculationMethod : public CalculationError {
   public:
     InvalidCalculationMethod() : CalculationError("The calculation method is invalid for this calculation!") {}
@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "common.hpp"
+#include "counting_iterator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace power_grid_model {
+
+// persistent pool of worker threads
+//    the threads are created on demand and retire after being idle for the idle timeout
+//    the calling thread always participates in the work and executes queued tasks while waiting,
+//    which makes nested parallel runs (e.g. from within a worker) deadlock-free
+class ThreadPool {
+  public:
+    static constexpr std::chrono::milliseconds default_idle_timeout{10000};
+
+    explicit ThreadPool(std::chrono::milliseconds idle_timeout = default_idle_timeout) : idle_timeout_{idle_timeout} {}
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+    ~ThreadPool() {
+        {
+            std::scoped_lock const lock{mutex_};
+            stop_ = true;
+        }
+        task_available_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    // process-wide pool, shared by all models
+    //    the pool is intentionally leaked: joining its workers during static destruction can deadlock,
+    //    e.g. under the loader lock when the library is unloaded on Windows
+    static ThreadPool& global() {
+        static ThreadPool* const pool = new ThreadPool; // NOLINT(cppcoreguidelines-owning-memory)
+        return *pool;
+    }
+
+    static Idx hardware_concurrency() { return static_cast<Idx>(std::thread::hardware_concurrency()); }
+
+    // number of live worker threads
+    Idx size() const {
+        std::scoped_lock const lock{mutex_};
+        return static_cast<Idx>(workers_.size() - retired_.size());
+    }
+
+    // run func(worker_idx) concurrently for worker_idx in [0, n_workers)
+    //    worker 0 is executed in the calling thread
+    //    the function returns when all workers are finished
+    //    the first exception thrown by any of the workers is re-thrown
+    template <typename Func>
+        requires std::invocable<std::remove_cvref_t<Func>&, Idx>
+    void parallel_run(Idx n_workers, Func&& func) {
+        if (n_workers <= 1) {
+            func(Idx{0});
+            return;
+        }
+
+        Group group{.n_pending = n_workers - 1};
+        {
+            std::scoped_lock const lock{mutex_};
+            ensure_workers(n_workers - 1);
+            for (Idx worker_idx = 1; worker_idx < n_workers; ++worker_idx) {
+                queue_.emplace_back([&group, &func, worker_idx] {
+                    group.run([&func, worker_idx] { func(worker_idx); });
+                    group.finish_one();
+                });
+            }
+        }
+        task_available_.notify_all();
+
+        group.run([&func] { func(Idx{0}); });
+
+        // help with queued work until all tasks of this group are finished
+        while (!group.is_finished()) {
+            if (!try_run_one()) {
+                group.wait();
+                break;
+            }
+        }
+        if (group.exception) {
+            std::rethrow_exception(group.exception);
+        }
+    }
+
+  private:
+    struct Group {
+        Idx n_pending{};
+        std::exception_ptr exception{};
+        std::mutex mutex{};
+        std::condition_variable finished{};
+
+        void run(auto&& task) {
+            try {
+                task();
+            } catch (...) {
+                std::scoped_lock const lock{mutex};
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+        void finish_one() {
+            std::scoped_lock const lock{mutex};
+            if (--n_pending == 0) {
+                finished.notify_all();
+            }
+        }
+        bool is_finished() {
+            std::scoped_lock const lock{mutex};
+            return n_pending == 0;
+        }
+        void wait() {
+            std::unique_lock lock{mutex};
+            finished.wait(lock, [this] { return n_pending == 0; });
+        }
+    };
+
+    mutable std::mutex mutex_;
+    std::condition_variable task_available_;
+    std::deque<std::function<void()>> queue_;
+    std::vector<std::thread> workers_;
+    std::vector<std::thread::id> retired_;
+    std::chrono::milliseconds idle_timeout_;
+    bool stop_{false};
+
+    // requires the lock to be held
+    void ensure_workers(Idx n_workers) {
+        join_retired();
+        while (static_cast<Idx>(workers_.size()) < n_workers) {
+            workers_.emplace_back([this] { worker_loop(); });
+        }
+    }
+
+    // requires the lock to be held
+    //    a retired worker does not take the lock anymore, so it can be joined while holding it
+    void join_retired() {
+        for (auto const id : retired_) {
+            auto const it =
+                std::ranges::find_if(workers_, [id](std::thread const& worker) { return worker.get_id() == id; });
+            it->join();
+            workers_.erase(it);
+        }
+        retired_.clear();
+    }
+
+    bool try_run_one() {
+        std::function<void()> task;
+        {
+            std::scoped_lock const lock{mutex_};
+            if (queue_.empty()) {
+                return false;
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        task();
+        return true;
+    }
+
+    void worker_loop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock{mutex_};
+                if (!task_available_.wait_for(lock, idle_timeout_, [this] { return stop_ || !queue_.empty(); })) {
+                    // idle for too long, the thread is joined by the next parallel run or the destructor
+                    retired_.push_back(std::this_thread::get_id());
+                    return;
+                }
+                if (stop_ && queue_.empty()) {
+                    return;
+                }
+                task = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+// hands out consecutive chunks [begin, end) of the range [0, size) to concurrent workers on request
+class ChunkCursor {
+  public:
+    ChunkCursor(Idx size, Idx chunk_size) : size_{size}, chunk_size_{std::max(chunk_size, Idx{1})} {}
+
+    std::optional<IdxRange> next() {
+        Idx const begin = next_.fetch_add(chunk_size_, std::memory_order_relaxed);
+        if (begin >= size_) {
+            return std::nullopt;
+        }
+        return IdxRange{begin, std::min(begin + chunk_size_, size_)};
+    }
+
+  private:
+    Idx size_;
+    Idx chunk_size_;
+    std::atomic<Idx> next_{0};
+};
+
+} // namespace power_grid_model
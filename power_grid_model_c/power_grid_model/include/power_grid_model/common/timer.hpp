@@ -8,8 +8,6 @@
 #include "common.hpp"
 
 #include <chrono>
-#include <iomanip>
-#include <sstream>
 
 namespace power_grid_model {
 
@@ -19,15 +17,13 @@ using Duration = std::chrono::duration<double>;
 class Timer {
   private:
     CalculationInfo* info_;
-    int code_;
-    std::string name_;
+    LogEvent event_{};
     Clock::time_point start_;
 
   public:
     Timer() : info_(nullptr){};
 
-    Timer(CalculationInfo& info, int code, std::string name)
-        : info_(&info), code_(code), name_(std::move(name)), start_(Clock::now()) {}
+    Timer(CalculationInfo& info, LogEvent event) : info_(&info), event_(event), start_(Clock::now()) {}
 
     Timer(Timer const&) = delete;
     Timer(Timer&&) = default;
@@ -39,8 +35,7 @@ class Timer {
 
         // Copy/move members
         info_ = timer.info_;
-        code_ = timer.code_;
-        name_ = std::move(timer.name_);
+        event_ = timer.event_;
         start_ = timer.start_;
 
         // Disable original timer
@@ -60,24 +55,10 @@ class Timer {
         if (info_ != nullptr) {
             auto const now = Clock::now();
             auto const duration = Duration(now - start_);
-            info_->operator[](Timer::make_key(code_, name_)) += (double)duration.count();
+            info_->add(event_, duration.count());
             info_ = nullptr;
         }
     }
-
-    static std::string make_key(int code, std::string_view name) {
-        std::stringstream ss;
-        ss << std::setw(4) << std::setfill('0') << code << ".";
-        auto key = ss.str();
-        for (size_t i = 0, n = key.length() - 1; i < n; ++i) {
-            if (key[i] == '0') {
-                break;
-            }
-            key += "\t";
-        }
-        key += name;
-        return key;
-    }
 };
 
 } // namespace power_grid_model
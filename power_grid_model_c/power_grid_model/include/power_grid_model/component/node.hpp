@@ -18,6 +18,7 @@ namespace power_grid_model {
 class Node final : public Base {
   public:
     using InputType = NodeInput;
+    using UpdateType = NodeUpdate;
     template <symmetry_tag sym> using OutputType = NodeOutput<sym>;
     using ShortCircuitOutputType = NodeShortCircuitOutput;
     static constexpr char const* name = "node";
@@ -25,11 +26,36 @@ class Node final : public Base {
 
     explicit Node(NodeInput const& node_input) : Base{node_input}, u_rated_{node_input.u_rated} {}
 
-    // update node, nothing happens here
-    static constexpr UpdateChange update(BaseUpdate const& /* update_data */) {
+    // update the initial voltage of the power flow, this changes neither the topology nor the parameters
+    UpdateChange update(NodeUpdate const& update_data) {
+        assert(update_data.id == this->id() || is_nan(update_data.id));
+        update_real_value<symmetric_t>(update_data.u_init, u_init_, 1.0);
+        update_real_value<symmetric_t>(update_data.u_init_angle, u_init_angle_, 1.0);
         return {.topo = false, .param = false};
     }
-    static constexpr BaseUpdate inverse(BaseUpdate update_data) { return update_data; }
+    // the inverse holds the current initial voltage, in which nan means unset, see restore
+    NodeUpdate inverse(NodeUpdate update_data) const {
+        assert(update_data.id == this->id() || is_nan(update_data.id));
+        update_data.u_init = u_init_;
+        update_data.u_init_angle = u_init_angle_;
+        return update_data;
+    }
+    // write the initial voltage of the inverse straight back, a nan value unsets it
+    //    an update cannot do this, because a nan value in an update leaves the initial voltage unchanged
+    UpdateChange restore(NodeUpdate const& inverse_data) {
+        assert(inverse_data.id == this->id() || is_nan(inverse_data.id));
+        u_init_ = inverse_data.u_init;
+        u_init_angle_ = inverse_data.u_init_angle;
+        return {.topo = false, .param = false};
+    }
+
+    // initial voltage of the power flow, nan if it is not (completely) specified
+    template <symmetry_tag sym> ComplexValue<sym> calc_param() const {
+        if (is_nan(u_init_) || is_nan(u_init_angle_)) {
+            return ComplexValue<sym>{DoubleComplex{nan, nan}};
+        }
+        return ComplexValue<sym>{u_init_ * std::exp(1.0i * u_init_angle_)};
+    }
 
     // energized
     template <symmetry_tag sym>
@@ -75,6 +101,8 @@ class Node final : public Base {
 
   private:
     double u_rated_;
+    double u_init_{nan};
+    double u_init_angle_{nan};
 };
 
 } // namespace power_grid_model
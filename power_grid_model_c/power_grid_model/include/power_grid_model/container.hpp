@@ -12,12 +12,17 @@
 
 #include <boost/range.hpp>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <span>
-#include <unordered_map>
 
 namespace power_grid_model {
 
@@ -53,6 +58,188 @@ constexpr size_t get_sub_cls_pos_v = get_index_bool_array(std::array{std::is_bas
 template <class T, class... SupportedTs>
 concept supported_type_c = is_in_list_c<T, SupportedTs...>;
 
+// vector which stores its elements in fixed-size pages
+// if sharing is enabled, the pages are shared with copies of the vector and only copied when an element in a shared
+// page is modified (copy-on-write), so that copying the vector and modifying a few elements is cheap
+// otherwise, a copy is a regular deep copy
+// NOTE: a mutable access may relocate a shared page, references obtained before are not updated
+template <class T> class CopyOnWriteVector {
+  public:
+    static constexpr Idx page_size_bits = 8;
+    static constexpr Idx page_size = Idx{1} << page_size_bits;
+
+    CopyOnWriteVector() = default;
+    CopyOnWriteVector(CopyOnWriteVector const& other) : pages_{other.pages_}, size_{other.size_} {
+        if (!other.share_on_copy_) {
+            make_exclusive();
+        }
+    }
+    CopyOnWriteVector& operator=(CopyOnWriteVector const& other) {
+        if (this != &other) {
+            *this = CopyOnWriteVector{other};
+        }
+        return *this;
+    }
+    CopyOnWriteVector(CopyOnWriteVector&&) noexcept = default;
+    CopyOnWriteVector& operator=(CopyOnWriteVector&&) noexcept = default;
+    ~CopyOnWriteVector() = default;
+
+    // share the pages with copies made from now on
+    //    the elements must not be modified through references obtained before the copy
+    void set_share_on_copy(bool share_on_copy) { share_on_copy_ = share_on_copy; }
+
+    Idx size() const { return size_; }
+
+    void reserve(Idx size) { pages_.reserve((size + page_size - 1) >> page_size_bits); }
+
+    template <class... Args> void emplace_back(Args&&... args) {
+        if ((size_ & (page_size - 1)) == 0) {
+            pages_.push_back(std::make_shared<Page>());
+        }
+        exclusive_page(size_ >> page_size_bits).emplace_back(std::forward<Args>(args)...);
+        ++size_;
+    }
+
+    T const& operator[](Idx pos) const {
+        assert(0 <= pos && pos < size_);
+        return (*pages_[pos >> page_size_bits])[pos & (page_size - 1)];
+    }
+    T& mutable_at(Idx pos) {
+        assert(0 <= pos && pos < size_);
+        return exclusive_page(pos >> page_size_bits)[pos & (page_size - 1)];
+    }
+
+    // make sure all pages are owned by this vector only
+    void make_exclusive() {
+        for (Idx page_idx = 0; page_idx != static_cast<Idx>(pages_.size()); ++page_idx) {
+            exclusive_page(page_idx);
+        }
+    }
+
+    // number of pages which are (still) shared with other vectors
+    Idx n_shared_pages() const {
+        return static_cast<Idx>(std::ranges::count_if(pages_, [](auto const& page) { return page.use_count() > 1; }));
+    }
+
+  private:
+    using Page = std::vector<T>;
+
+    std::vector<std::shared_ptr<Page>> pages_;
+    Idx size_{0};
+    bool share_on_copy_{false};
+
+    Page& exclusive_page(Idx page_idx) {
+        auto& page = pages_[page_idx];
+        if (page.use_count() > 1) {
+            page = std::make_shared<Page>(*page);
+        } else {
+            // synchronize with the release of the other owners that were reading the page
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return *page;
+    }
+};
+
+// index from component ID to Idx2D in a flat hash table with open addressing and linear probing
+//    all entries are stored in one array, so a lookup touches only one or two cache lines and there is no allocation
+//    per ID. The capacity is a power of two and the load factor is kept at most one half.
+class IdIndex {
+  public:
+    static constexpr Idx min_capacity = 16;
+
+    Idx size() const { return size_; }
+    Idx capacity() const { return static_cast<Idx>(entries_.size()); }
+
+    // make sure that size IDs fit without growing the table
+    void reserve(Idx size) {
+        auto const capacity = static_cast<Idx>(std::bit_ceil(static_cast<uint64_t>(std::max(2 * size, min_capacity))));
+        if (capacity > this->capacity()) {
+            rehash(capacity);
+        }
+    }
+
+    bool contains(ID id) const { return find(id).has_value(); }
+
+    std::optional<Idx2D> find(ID id) const {
+        if (entries_.empty()) {
+            return std::nullopt;
+        }
+        for (Idx slot = home_slot(id);; slot = next_slot(slot)) {
+            Entry const& entry = entries_[slot];
+            if (entry.group == empty) {
+                return std::nullopt;
+            }
+            if (entry.id == id) {
+                return Idx2D{.group = entry.group, .pos = entry.pos};
+            }
+        }
+    }
+
+    // insert the ID, returns false (and does nothing) if the ID already exists
+    bool emplace(ID id, Idx2D idx_2d) {
+        assert(0 <= idx_2d.group && idx_2d.group < std::numeric_limits<IntS>::max());
+        if (2 * (size_ + 1) > capacity()) {
+            rehash(std::max(2 * capacity(), min_capacity));
+        }
+        Idx slot = home_slot(id);
+        for (; entries_[slot].group != empty; slot = next_slot(slot)) {
+            if (entries_[slot].id == id) {
+                return false;
+            }
+        }
+        entries_[slot] = Entry{.id = id, .group = static_cast<IntS>(idx_2d.group), .pos = idx_2d.pos};
+        ++size_;
+        return true;
+    }
+
+    // reverse lookup by a linear search, only for debugging purpose
+    std::optional<ID> find_id(Idx2D idx_2d) const {
+        auto const found = std::ranges::find_if(entries_, [&idx_2d](Entry const& entry) {
+            return entry.group != empty && entry.group == idx_2d.group && entry.pos == idx_2d.pos;
+        });
+        if (found == entries_.end()) {
+            return std::nullopt;
+        }
+        return found->id;
+    }
+
+  private:
+    static constexpr IntS empty = -1;
+
+    struct Entry {
+        ID id{};
+        IntS group{empty};
+        Idx pos{};
+    };
+
+    std::vector<Entry> entries_;
+    Idx size_{0};
+    int shift_{std::numeric_limits<uint64_t>::digits};
+
+    // Fibonacci hashing, the high bits of the product spread both consecutive and strided IDs over the table
+    Idx home_slot(ID id) const {
+        constexpr uint64_t multiplier = 0x9E3779B97F4A7C15;
+        return static_cast<Idx>((static_cast<uint64_t>(static_cast<uint32_t>(id)) * multiplier) >> shift_);
+    }
+    Idx next_slot(Idx slot) const { return (slot + 1) & (capacity() - 1); }
+
+    void rehash(Idx capacity) {
+        assert(std::has_single_bit(static_cast<uint64_t>(capacity)));
+        std::vector<Entry> old_entries(static_cast<size_t>(capacity));
+        std::swap(entries_, old_entries);
+        shift_ = std::numeric_limits<uint64_t>::digits - std::countr_zero(static_cast<uint64_t>(capacity));
+        for (Entry const& entry : old_entries) {
+            if (entry.group != empty) {
+                Idx slot = home_slot(entry.id);
+                while (entries_[slot].group != empty) {
+                    slot = next_slot(slot);
+                }
+                entries_[slot] = entry;
+            }
+        }
+    }
+};
+
 // define what types are retrievable using sequence number
 template <class... T> struct RetrievableTypes;
 
@@ -72,10 +259,11 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
     template <typename T> static constexpr bool is_storageable_v = supported_type_c<T, StorageableTypes...>;
     template <typename T> static constexpr bool is_gettable_v = supported_type_c<T, GettableTypes...>;
 
-    // reserve space
+    // reserve space, for the components and their IDs
     template <supported_type_c<StorageableTypes...> Storageable> void reserve(size_t size) {
-        auto& vec = std::get<std::vector<Storageable>>(vectors_);
-        vec.reserve(size);
+        auto& vec = std::get<CopyOnWriteVector<Storageable>>(vectors_);
+        vec.reserve(static_cast<Idx>(size));
+        exclusive_map().reserve(map_->size() + static_cast<Idx>(size));
     }
 
     // emplace component
@@ -83,17 +271,18 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         // template<class... Args> Args&&... args perfect forwarding
         assert(!construction_complete_);
         // throw if id already exists
-        if (map_.contains(id)) {
+        if (map_->contains(id)) {
             throw ConflictID{id};
         }
         // find group and position
         auto const group = static_cast<Idx>(get_cls_pos_v<Storageable, StorageableTypes...>);
-        auto& vec = std::get<std::vector<Storageable>>(vectors_);
-        auto const pos = static_cast<Idx>(vec.size());
+        auto& vec = std::get<CopyOnWriteVector<Storageable>>(vectors_);
+        auto const pos = vec.size();
         // create object
         vec.emplace_back(std::forward<Args>(args)...);
         // insert idx to map
-        map_[id] = Idx2D{.group = group, .pos = pos};
+        [[maybe_unused]] bool const inserted = exclusive_map().emplace(id, Idx2D{.group = group, .pos = pos});
+        assert(inserted);
     }
 
     // get item based on Idx2D
@@ -115,8 +304,8 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
 #ifndef NDEBUG
     // get id by idx, only for debugging purpose
     ID get_id_by_idx(Idx2D idx_2d) const {
-        if (auto it = std::ranges::find(map_, idx_2d, &std::pair<const ID, Idx2D>::second); it != map_.end()) {
-            return it->first;
+        if (auto const id = map_->find_id(idx_2d); id.has_value()) {
+            return *id;
         }
         throw Idx2DNotFound{idx_2d};
     }
@@ -124,11 +313,11 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
 
     // get idx by id
     Idx2D get_idx_by_id(ID id) const {
-        auto const found = map_.find(id);
-        if (found == map_.end()) {
+        auto const found = map_->find(id);
+        if (!found.has_value()) {
             throw IDNotFound{id};
         }
-        return found->second;
+        return *found;
     }
     template <supported_type_c<GettableTypes...> Gettable> Idx2D get_idx_by_id(ID id) const {
         auto const result = get_idx_by_id(id);
@@ -177,9 +366,9 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
     // get sequence idx based on id
     template <supported_type_c<GettableTypes...> Gettable> Idx get_seq(ID id) const {
         assert(construction_complete_);
-        auto const found = map_.find(id);
-        assert(found != map_.end());
-        return get_seq<Gettable>(found->second);
+        auto const found = map_->find(id);
+        assert(found.has_value());
+        return get_seq<Gettable>(*found);
     }
 
     // get idx_2d based on sequence
@@ -219,9 +408,35 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         cum_size_ = {accumulate_size_per_vector<GettableTypes>()...};
     };
 
+    // share the component storage with copies of the container made from now on, see CopyOnWriteVector
+    //    this container is not affected when a copy is modified, and vice versa
+    //    however, components must not be modified through references obtained before the copy
+    void set_share_storage_on_copy(bool share_on_copy) {
+        std::apply([share_on_copy](auto&... vectors) { (vectors.set_share_on_copy(share_on_copy), ...); }, vectors_);
+    }
+
+    // make sure that the storage of the components of a type is not shared with other containers
+    // after this, references to these components stay valid when other components of the same type are modified
+    template <supported_type_c<StorageableTypes...> Storageable> void make_exclusive() {
+        std::get<CopyOnWriteVector<Storageable>>(vectors_).make_exclusive();
+    }
+
+    // number of storage pages of a type that are shared with other containers
+    template <supported_type_c<StorageableTypes...> Storageable> Idx n_shared_pages() const {
+        return std::get<CopyOnWriteVector<Storageable>>(vectors_).n_shared_pages();
+    }
+
+    // read-only storage of the components of a type
+    //    unlike references to the components, it stays valid when a shared page is copied on write
+    template <supported_type_c<StorageableTypes...> Storageable>
+    CopyOnWriteVector<Storageable> const& storage() const {
+        return std::get<CopyOnWriteVector<Storageable>>(vectors_);
+    }
+
   private:
-    std::tuple<std::vector<StorageableTypes>...> vectors_;
-    std::unordered_map<ID, Idx2D> map_;
+    // the id map is always shared between copies of the container and copied on modification
+    std::tuple<CopyOnWriteVector<StorageableTypes>...> vectors_;
+    std::shared_ptr<IdIndex> map_{std::make_shared<IdIndex>()};
     std::array<Idx, num_gettable> size_;
     std::array<std::array<Idx, num_storageable + 1>, num_gettable> cum_size_;
 
@@ -230,16 +445,23 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
     bool construction_complete_{false};
 #endif // !NDEBUG
 
+    IdIndex& exclusive_map() {
+        if (map_.use_count() > 1) {
+            map_ = std::make_shared<IdIndex>(*map_);
+        }
+        return *map_;
+    }
+
     // get item per type
     template <supported_type_c<GettableTypes...> GettableBaseType, class StorageableSubType>
         requires std::derived_from<StorageableSubType, GettableBaseType>
     GettableBaseType& get_raw(Idx pos) {
-        return std::get<std::vector<StorageableSubType>>(vectors_)[pos];
+        return std::get<CopyOnWriteVector<StorageableSubType>>(vectors_).mutable_at(pos);
     }
     template <supported_type_c<GettableTypes...> GettableBaseType, class StorageableSubType>
         requires std::derived_from<StorageableSubType, GettableBaseType>
     GettableBaseType const& get_raw(Idx pos) const {
-        return std::get<std::vector<StorageableSubType>>(vectors_)[pos];
+        return std::get<CopyOnWriteVector<StorageableSubType>>(vectors_)[pos];
     }
 
     // templates to select function pointer
@@ -267,7 +489,7 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         assert(construction_complete_);
         return std::array<Idx, num_storageable>{
             std::is_base_of_v<Gettable, StorageableTypes>
-                ? static_cast<Idx>(std::get<std::vector<StorageableTypes>>(vectors_).size())
+                ? std::get<CopyOnWriteVector<StorageableTypes>>(vectors_).size()
                 : 0 ...};
     }
     // total size of a type
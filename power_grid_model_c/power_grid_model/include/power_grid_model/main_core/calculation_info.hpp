@@ -4,24 +4,18 @@
 
 #pragma once
 
+#include "../common/calculation_info.hpp"
 #include "../common/common.hpp"
 
+#include <vector>
+
 namespace power_grid_model::main_core {
 
 inline CalculationInfo merge_calculation_info(std::vector<CalculationInfo> const& infos) {
     CalculationInfo result;
-
-    auto const key = Timer::make_key(2226, "Max number of iterations");
     for (auto const& info : infos) {
-        for (auto const& [k, v] : info) {
-            if (k == key) {
-                result[k] = std::max(result[k], v);
-            } else {
-                result[k] += v;
-            }
-        }
+        result.merge(info);
     }
-
     return result;
 }
 
@@ -7,13 +7,56 @@
 #include "../math_solver/math_solver_dispatch.hpp"
 #include "../math_solver/y_bus.hpp"
 
+#include <functional>
+
 namespace power_grid_model::main_core {
 
+// let the y bus signal parameter changes to the math solver of the same math model
+template <symmetry_tag sym>
+inline void register_parameters_changed_callbacks(std::vector<YBus<sym>>& y_bus_vec,
+                                                  std::vector<MathSolverProxy<sym>>& solvers) {
+    assert(solvers.empty() || solvers.size() == y_bus_vec.size());
+    for (size_t idx = 0; idx < solvers.size(); ++idx) {
+        y_bus_vec[idx].register_parameters_changed_callback(
+            [solver = std::ref(solvers[idx])](bool changed) { solver.get().get().parameters_changed(changed); });
+    }
+}
+
 struct MathState {
     std::vector<YBus<symmetric_t>> y_bus_vec_sym;
     std::vector<YBus<asymmetric_t>> y_bus_vec_asym;
     std::vector<MathSolverProxy<symmetric_t>> math_solvers_sym;
     std::vector<MathSolverProxy<asymmetric_t>> math_solvers_asym;
+
+    MathState() = default;
+    // the callbacks of the copied y bus should point to the copied solvers
+    MathState(MathState const& other)
+        : y_bus_vec_sym{other.y_bus_vec_sym},
+          y_bus_vec_asym{other.y_bus_vec_asym},
+          math_solvers_sym{other.math_solvers_sym},
+          math_solvers_asym{other.math_solvers_asym} {
+        register_callbacks();
+    }
+    MathState& operator=(MathState const& other) {
+        if (this != &other) {
+            y_bus_vec_sym = other.y_bus_vec_sym;
+            y_bus_vec_asym = other.y_bus_vec_asym;
+            math_solvers_sym = other.math_solvers_sym;
+            math_solvers_asym = other.math_solvers_asym;
+            register_callbacks();
+        }
+        return *this;
+    }
+    // moving the vectors keeps the solvers at the same address
+    MathState(MathState&& other) noexcept = default;
+    MathState& operator=(MathState&& other) noexcept = default;
+    ~MathState() = default;
+
+  private:
+    void register_callbacks() {
+        register_parameters_changed_callbacks(y_bus_vec_sym, math_solvers_sym);
+        register_parameters_changed_callbacks(y_bus_vec_asym, math_solvers_asym);
+    }
 };
 
 inline void clear(MathState& math_state) {
@@ -24,7 +67,7 @@ inline void clear(MathState& math_state) {
 }
 
 template <symmetry_tag sym>
-inline void update_y_bus(MathState& math_state, std::vector<MathModelParam<sym>> const& math_model_params) {
+inline void update_y_bus(MathState& math_state, std::vector<MathModelParam<sym>> math_model_params) {
     auto& y_bus_vec = [&math_state]() -> auto& {
         if constexpr (is_symmetric_v<sym>) {
             return math_state.y_bus_vec_sym;
@@ -40,8 +83,9 @@ inline void update_y_bus(MathState& math_state, std::vector<MathModelParam<sym>>
     }
 }
 
+// the parameters of the changed components are already updated in place in the y bus
 template <symmetry_tag sym>
-inline void update_y_bus(MathState& math_state, std::vector<MathModelParam<sym>> const& math_model_params,
+inline void update_y_bus(MathState& math_state,
                          std::vector<MathModelParamIncrement> const& math_model_param_increments) {
     auto& y_bus_vec = [&math_state]() -> auto& {
         if constexpr (is_symmetric_v<sym>) {
@@ -51,12 +95,10 @@ inline void update_y_bus(MathState& math_state, std::vector<MathModelParam<sym>>
         }
     }();
 
-    assert(y_bus_vec.size() == math_model_params.size());
+    assert(y_bus_vec.size() == math_model_param_increments.size());
 
     for (Idx i = 0; i != static_cast<Idx>(y_bus_vec.size()); ++i) {
-        y_bus_vec[i].update_admittance_increment(
-            std::make_shared<MathModelParam<sym> const>(std::move(math_model_params[i])),
-            math_model_param_increments[i]);
+        y_bus_vec[i].update_admittance_increment(math_model_param_increments[i]);
     }
 }
 
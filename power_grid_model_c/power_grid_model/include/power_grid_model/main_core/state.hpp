@@ -8,9 +8,17 @@
 #include "../container.hpp"
 
 #include <concepts>
+#include <memory>
+#include <vector>
 
 namespace power_grid_model::main_core {
 
+// topology of the math models, as built for the state of the components
+struct MathTopologyCache {
+    std::vector<std::shared_ptr<MathModelTopology const>> math_topology;
+    std::shared_ptr<TopologicalComponentToMathCoupling const> topo_comp_coup;
+};
+
 template <class CompContainer> struct MainModelState {
     using ComponentContainer = CompContainer;
 
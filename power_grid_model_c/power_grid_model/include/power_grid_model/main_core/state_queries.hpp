@@ -58,6 +58,8 @@ constexpr auto& get_component(MainModelState<ComponentContainer> const& state, a
     return state.components.template get_item<ComponentType>(id_or_index);
 }
 
+// write access: copies the storage page of the component if it is shared with another state, see CopyOnWriteVector
+//    read through the const overload instead
 template <typename ComponentType, class ComponentContainer>
     requires model_component_state_c<MainModelState, ComponentContainer, ComponentType>
 constexpr auto& get_component(MainModelState<ComponentContainer>& state, auto const& id_or_index) {
@@ -70,6 +72,8 @@ constexpr auto& get_component_by_sequence(MainModelState<ComponentContainer> con
     return state.components.template get_item_by_seq<ComponentType>(sequence);
 }
 
+// write access: copies the storage page of the component if it is shared with another state, see CopyOnWriteVector
+//    read through the const overload instead
 template <typename ComponentType, class ComponentContainer>
     requires model_component_state_c<MainModelState, ComponentContainer, ComponentType>
 constexpr auto& get_component_by_sequence(MainModelState<ComponentContainer>& state, Idx sequence) {
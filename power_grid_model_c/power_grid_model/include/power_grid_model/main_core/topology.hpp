@@ -9,6 +9,14 @@
 
 #include "../all_components.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
 namespace power_grid_model::main_core {
 
 namespace detail {
@@ -191,4 +199,271 @@ constexpr void register_topology_components(MainModelState<ComponentContainer> c
     });
 }
 
+// check that the math topologies are consistent with the components, e.g. when they are restored from a model snapshot
+//    every index in the math topologies and in the coupling is in range, every element of a math model is coupled to
+//    exactly one component and the elements are grouped by the math model objects the components are connected to
+inline bool is_consistent_math_topology(ComponentTopology const& comp_topo, MathTopologyCache const& topology) {
+    using enum MeasuredTerminalType;
+
+    auto const& math_topology = topology.math_topology;
+    auto const n_math_topologies = static_cast<Idx>(math_topology.size());
+    if (topology.topo_comp_coup == nullptr ||
+        std::ranges::any_of(math_topology, [](auto const& math_topo) { return math_topo == nullptr; })) {
+        return false;
+    }
+    auto const& coup = *topology.topo_comp_coup;
+
+    // the fill-in completes the structure of the sparse matrices of a math model: the fill-in entries are not in the
+    // structure of the branches and eliminating the buses in order creates no entries outside the structure, i.e. the
+    // higher neighbours of every bus, except the lowest one, are higher neighbours of the lowest one as well
+    auto const has_complete_fill_in = [](MathModelTopology const& math_topo) {
+        std::vector<IdxVector> neighbours(math_topo.n_bus());
+        for (BranchIdx const& bus : math_topo.branch_bus_idx) {
+            if (bus[0] != -1 && bus[1] != -1 && bus[0] != bus[1]) {
+                neighbours[std::min(bus[0], bus[1])].push_back(std::max(bus[0], bus[1]));
+            }
+        }
+        for (IdxVector& bus_neighbours : neighbours) {
+            std::ranges::sort(bus_neighbours);
+            auto const duplicates = std::ranges::unique(bus_neighbours);
+            bus_neighbours.erase(duplicates.begin(), duplicates.end());
+        }
+        for (BranchIdx const& bus : math_topo.fill_in) {
+            IdxVector& bus_neighbours = neighbours[std::min(bus[0], bus[1])];
+            Idx const neighbour = std::max(bus[0], bus[1]);
+            auto const it = std::ranges::lower_bound(bus_neighbours, neighbour);
+            if (bus[0] == bus[1] || (it != bus_neighbours.end() && *it == neighbour)) {
+                return false;
+            }
+            bus_neighbours.insert(it, neighbour);
+        }
+        return std::ranges::all_of(neighbours, [&neighbours](IdxVector const& bus_neighbours) {
+            return bus_neighbours.size() < 2 ||
+                   std::ranges::includes(neighbours[bus_neighbours.front()], bus_neighbours | std::views::drop(1));
+        });
+    };
+    auto const is_valid_math_model = [&has_complete_fill_in](MathModelTopology const& math_topo) {
+        Idx const n_bus = math_topo.n_bus();
+        Idx const n_branch = math_topo.n_branch();
+        auto const is_bus = [n_bus](Idx bus) { return bus >= 0 && bus < n_bus; };
+        auto const is_branch_bus = [&is_bus](Idx bus) { return bus == -1 || is_bus(bus); };
+        return is_bus(math_topo.slack_bus) &&
+               std::ranges::all_of(math_topo.branch_bus_idx,
+                                   [&is_branch_bus](BranchIdx const& bus) {
+                                       return is_branch_bus(bus[0]) && is_branch_bus(bus[1]);
+                                   }) &&
+               std::ranges::all_of(math_topo.fill_in,
+                                   [&is_bus](BranchIdx const& bus) { return is_bus(bus[0]) && is_bus(bus[1]); }) &&
+               math_topo.sources_per_bus.size() == n_bus && math_topo.shunts_per_bus.size() == n_bus &&
+               math_topo.load_gens_per_bus.size() == n_bus &&
+               std::cmp_equal(math_topo.load_gen_type.size(), math_topo.n_load_gen()) &&
+               math_topo.voltage_sensors_per_bus.size() == n_bus &&
+               math_topo.power_sensors_per_source.size() == math_topo.n_source() &&
+               math_topo.power_sensors_per_load_gen.size() == math_topo.n_load_gen() &&
+               math_topo.power_sensors_per_shunt.size() == math_topo.n_shunt() &&
+               math_topo.power_sensors_per_branch_from.size() == n_branch &&
+               math_topo.power_sensors_per_branch_to.size() == n_branch &&
+               math_topo.power_sensors_per_bus.size() == n_bus &&
+               math_topo.current_sensors_per_branch_from.size() == n_branch &&
+               math_topo.current_sensors_per_branch_to.size() == n_branch &&
+               (math_topo.tap_regulators_per_branch.size() == 0 ||
+                math_topo.tap_regulators_per_branch.size() == n_branch) &&
+               has_complete_fill_in(math_topo);
+    };
+    if (!std::ranges::all_of(math_topology, [&is_valid_math_model](auto const& math_topo) {
+            return is_valid_math_model(*math_topo);
+        })) {
+        return false;
+    }
+
+    // the coupling of the sensors with the given terminal types
+    auto const select = [](std::span<Idx2D const> coupling, std::vector<MeasuredTerminalType> const& terminal_type,
+                           std::initializer_list<MeasuredTerminalType> selected) {
+        std::vector<Idx2D> result;
+        for (Idx k = 0; k != static_cast<Idx>(coupling.size()); ++k) {
+            if (std::ranges::find(selected, terminal_type[k]) != selected.end()) {
+                result.push_back(coupling[k]);
+            }
+        }
+        return result;
+    };
+    // the three branches of a branch3 are elements of the math model as well
+    std::vector<Idx2D> branch_coupling{coup.branch};
+    for (Idx2DBranch3 const& branch3 : coup.branch3) {
+        for (Idx const pos : branch3.pos) {
+            branch_coupling.push_back({.group = branch3.group, .pos = pos});
+        }
+    }
+
+    // every element of every math model is coupled to exactly one component
+    auto const is_one_to_one = [&math_topology, n_math_topologies](std::span<Idx2D const> coupling,
+                                                                     auto n_elements) {
+        std::vector<std::vector<bool>> is_coupled(math_topology.size());
+        for (Idx group = 0; group != n_math_topologies; ++group) {
+            is_coupled[group].resize(static_cast<size_t>(std::invoke(n_elements, *math_topology[group])));
+        }
+        for (Idx2D const& idx : coupling) {
+            if (idx.group == -1) {
+                continue;
+            }
+            if (idx.group < 0 || idx.group >= n_math_topologies || idx.pos < 0 ||
+                std::cmp_greater_equal(idx.pos, is_coupled[idx.group].size()) || is_coupled[idx.group][idx.pos]) {
+                return false;
+            }
+            is_coupled[idx.group][idx.pos] = true;
+        }
+        return std::ranges::all_of(is_coupled,
+                                   [](auto const& coupled) { return std::ranges::all_of(coupled, std::identity{}); });
+    };
+    auto const power_sensor_coupling = [&](std::initializer_list<MeasuredTerminalType> selected) {
+        return select(coup.power_sensor, comp_topo.power_sensor_terminal_type, selected);
+    };
+    auto const current_sensor_coupling = [&](std::initializer_list<MeasuredTerminalType> selected) {
+        return select(coup.current_sensor, comp_topo.current_sensor_terminal_type, selected);
+    };
+    if (coup.node.size() != static_cast<size_t>(comp_topo.n_node_total()) ||
+        coup.branch.size() != comp_topo.branch_node_idx.size() ||
+        coup.branch3.size() != comp_topo.branch3_node_idx.size() ||
+        coup.shunt.size() != comp_topo.shunt_node_idx.size() ||
+        coup.load_gen.size() != comp_topo.load_gen_node_idx.size() ||
+        coup.source.size() != comp_topo.source_node_idx.size() ||
+        coup.voltage_sensor.size() != comp_topo.voltage_sensor_node_idx.size() ||
+        coup.power_sensor.size() != comp_topo.power_sensor_object_idx.size() ||
+        coup.current_sensor.size() != comp_topo.current_sensor_object_idx.size() ||
+        (!coup.regulator.empty() &&
+         (coup.regulator.size() != comp_topo.regulated_object_idx.size() ||
+          !is_one_to_one(coup.regulator, &MathModelTopology::n_transformer_tap_regulator))) ||
+        !is_one_to_one(coup.node, &MathModelTopology::n_bus) ||
+        !is_one_to_one(branch_coupling, &MathModelTopology::n_branch) ||
+        !is_one_to_one(coup.shunt, &MathModelTopology::n_shunt) ||
+        !is_one_to_one(coup.load_gen, &MathModelTopology::n_load_gen) ||
+        !is_one_to_one(coup.source, &MathModelTopology::n_source) ||
+        !is_one_to_one(coup.voltage_sensor, &MathModelTopology::n_voltage_sensor) ||
+        !is_one_to_one(power_sensor_coupling({source}), &MathModelTopology::n_source_power_sensor) ||
+        !is_one_to_one(power_sensor_coupling({shunt}), &MathModelTopology::n_shunt_power_power_sensor) ||
+        !is_one_to_one(power_sensor_coupling({load, generator}), &MathModelTopology::n_load_gen_power_sensor) ||
+        !is_one_to_one(power_sensor_coupling({branch_from, branch3_1, branch3_2, branch3_3}),
+                       &MathModelTopology::n_branch_from_power_sensor) ||
+        !is_one_to_one(power_sensor_coupling({branch_to}), &MathModelTopology::n_branch_to_power_sensor) ||
+        !is_one_to_one(power_sensor_coupling({node}), &MathModelTopology::n_bus_power_sensor) ||
+        !is_one_to_one(current_sensor_coupling({branch_from, branch3_1, branch3_2, branch3_3}),
+                       &MathModelTopology::n_branch_from_current_sensor) ||
+        !is_one_to_one(current_sensor_coupling({branch_to}), &MathModelTopology::n_branch_to_current_sensor)) {
+        return false;
+    }
+
+    // the buses of the branches are the coupled nodes, or -1 if the side is not connected
+    auto const is_branch_bus = [&coup](Idx bus, Idx group, Idx node_idx) {
+        return bus == -1 || coup.node[node_idx] == Idx2D{.group = group, .pos = bus};
+    };
+    for (Idx k = 0; k != static_cast<Idx>(coup.branch.size()); ++k) {
+        if (auto const [group, pos] = coup.branch[k]; group != -1) {
+            auto const& bus = math_topology[group]->branch_bus_idx[pos];
+            if (!is_branch_bus(bus[0], group, comp_topo.branch_node_idx[k][0]) ||
+                !is_branch_bus(bus[1], group, comp_topo.branch_node_idx[k][1])) {
+                return false;
+            }
+        }
+    }
+    for (Idx k = 0; k != static_cast<Idx>(coup.branch3.size()); ++k) {
+        if (auto const& [group, pos] = coup.branch3[k]; group != -1) {
+            for (size_t side = 0; side != 3; ++side) {
+                auto const& bus = math_topology[group]->branch_bus_idx[pos[side]];
+                if (!is_branch_bus(bus[0], group, comp_topo.branch3_node_idx[k][side]) ||
+                    coup.node[comp_topo.n_node + k] != Idx2D{.group = group, .pos = bus[1]}) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    // the elements are grouped by the math model object they are connected to or measure
+    auto const is_grouped_by = [&math_topology](std::span<Idx2D const> coupling, auto get_object, auto get_group) {
+        for (Idx k = 0; k != static_cast<Idx>(coupling.size()); ++k) {
+            if (auto const [group, pos] = coupling[k]; group != -1) {
+                Idx2D const object = get_object(k);
+                if (object.group != group || get_group(*math_topology[group], k, pos) != object.pos) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+    auto const node_of = [&coup](IdxVector const& node_idx) {
+        return [&coup, &node_idx](Idx k) { return coup.node[node_idx[k]]; };
+    };
+    auto const group_in = [](auto member) {
+        return [member](MathModelTopology const& math_topo, Idx /* k */, Idx pos) {
+            return (math_topo.*member).get_group(pos);
+        };
+    };
+    auto const measured_object_of = [&coup](IdxVector const& object_idx,
+                                            std::vector<MeasuredTerminalType> const& terminal_type) {
+        return [&coup, &object_idx, &terminal_type](Idx k) -> Idx2D {
+            Idx const obj = object_idx[k];
+            switch (terminal_type[k]) {
+            case branch_from:
+            case branch_to:
+                return coup.branch[obj];
+            case source:
+                return coup.source[obj];
+            case shunt:
+                return coup.shunt[obj];
+            case load:
+            case generator:
+                return coup.load_gen[obj];
+            case branch3_1:
+                return {.group = coup.branch3[obj].group, .pos = coup.branch3[obj].pos[0]};
+            case branch3_2:
+                return {.group = coup.branch3[obj].group, .pos = coup.branch3[obj].pos[1]};
+            case branch3_3:
+                return {.group = coup.branch3[obj].group, .pos = coup.branch3[obj].pos[2]};
+            case node:
+                return coup.node[obj];
+            default:
+                return {.group = -1, .pos = -1};
+            }
+        };
+    };
+    auto const power_sensor_group = [&comp_topo](MathModelTopology const& math_topo, Idx k, Idx pos) {
+        switch (comp_topo.power_sensor_terminal_type[k]) {
+        case source:
+            return math_topo.power_sensors_per_source.get_group(pos);
+        case shunt:
+            return math_topo.power_sensors_per_shunt.get_group(pos);
+        case load:
+        case generator:
+            return math_topo.power_sensors_per_load_gen.get_group(pos);
+        case branch_to:
+            return math_topo.power_sensors_per_branch_to.get_group(pos);
+        case node:
+            return math_topo.power_sensors_per_bus.get_group(pos);
+        default:
+            return math_topo.power_sensors_per_branch_from.get_group(pos);
+        }
+    };
+    auto const current_sensor_group = [&comp_topo](MathModelTopology const& math_topo, Idx k, Idx pos) {
+        return comp_topo.current_sensor_terminal_type[k] == branch_to
+                   ? math_topo.current_sensors_per_branch_to.get_group(pos)
+                   : math_topo.current_sensors_per_branch_from.get_group(pos);
+    };
+    return is_grouped_by(coup.shunt, node_of(comp_topo.shunt_node_idx), group_in(&MathModelTopology::shunts_per_bus)) &&
+           is_grouped_by(coup.load_gen, node_of(comp_topo.load_gen_node_idx),
+                         group_in(&MathModelTopology::load_gens_per_bus)) &&
+           is_grouped_by(coup.source, node_of(comp_topo.source_node_idx),
+                         group_in(&MathModelTopology::sources_per_bus)) &&
+           is_grouped_by(coup.voltage_sensor, node_of(comp_topo.voltage_sensor_node_idx),
+                         group_in(&MathModelTopology::voltage_sensors_per_bus)) &&
+           is_grouped_by(coup.power_sensor,
+                         measured_object_of(comp_topo.power_sensor_object_idx, comp_topo.power_sensor_terminal_type),
+                         power_sensor_group) &&
+           is_grouped_by(coup.current_sensor,
+                         measured_object_of(comp_topo.current_sensor_object_idx,
+                                            comp_topo.current_sensor_terminal_type),
+                         current_sensor_group) &&
+           std::ranges::all_of(IdxRange{static_cast<Idx>(coup.load_gen.size())}, [&](Idx k) {
+               auto const [group, pos] = coup.load_gen[k];
+               return group == -1 || math_topology[group]->load_gen_type[pos] == comp_topo.load_gen_type[k];
+           });
+}
 } // namespace power_grid_model::main_core
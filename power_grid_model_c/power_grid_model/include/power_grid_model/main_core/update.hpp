@@ -8,10 +8,14 @@
 #include "state.hpp"
 
 #include "../all_components.hpp"
+#include "../auxiliary/dataset.hpp"
 #include "../common/iterator_facade.hpp"
 #include "../container.hpp"
 
+#include <algorithm>
 #include <map>
+#include <numeric>
+#include <unordered_map>
 
 namespace power_grid_model::main_core::update {
 
@@ -240,21 +244,23 @@ get_all_sequence_idx_map(MainModelState<ComponentContainer> const& state, ConstD
 // using forward interators
 // different selection based on component type
 // if sequence_idx is given, it will be used to load the object instead of using IDs via hash map.
+namespace detail {
 template <component_c Component, class ComponentContainer, std::forward_iterator ForwardIterator,
-          std::output_iterator<Idx2D> OutputIterator>
+          std::output_iterator<Idx2D> OutputIterator, typename ApplyUpdate>
     requires model_component_state_c<MainModelState, ComponentContainer, Component>
-inline UpdateChange update_component(MainModelState<ComponentContainer>& state, ForwardIterator begin,
-                                     ForwardIterator end, OutputIterator changed_it,
-                                     std::span<Idx2D const> sequence_idx) {
+inline UpdateChange apply_component_update(MainModelState<ComponentContainer>& state, ForwardIterator begin,
+                                           ForwardIterator end, OutputIterator changed_it,
+                                           std::span<Idx2D const> sequence_idx, ApplyUpdate apply_update) {
     using UpdateType = typename Component::UpdateType;
 
     UpdateChange state_changed;
 
-    detail::iterate_component_sequence<Component>(
-        [&state_changed, &changed_it, &state](UpdateType const& update_data, Idx2D const& sequence_single) {
+    iterate_component_sequence<Component>(
+        [&state_changed, &changed_it, &state, &apply_update](UpdateType const& update_data,
+                                                             Idx2D const& sequence_single) {
             auto& comp = get_component<Component>(state, sequence_single);
             assert(state.components.get_id_by_idx(sequence_single) == comp.id());
-            auto const comp_changed = comp.update(update_data);
+            auto const comp_changed = apply_update(comp, update_data);
             state_changed = state_changed || comp_changed;
 
             if (comp_changed.param || comp_changed.topo) {
@@ -265,6 +271,18 @@ inline UpdateChange update_component(MainModelState<ComponentContainer>& state,
 
     return state_changed;
 }
+} // namespace detail
+
+template <component_c Component, class ComponentContainer, std::forward_iterator ForwardIterator,
+          std::output_iterator<Idx2D> OutputIterator>
+    requires model_component_state_c<MainModelState, ComponentContainer, Component>
+inline UpdateChange update_component(MainModelState<ComponentContainer>& state, ForwardIterator begin,
+                                     ForwardIterator end, OutputIterator changed_it,
+                                     std::span<Idx2D const> sequence_idx) {
+    return detail::apply_component_update<Component>(
+        state, std::move(begin), std::move(end), std::move(changed_it), sequence_idx,
+        [](Component& comp, typename Component::UpdateType const& update_data) { return comp.update(update_data); });
+}
 template <component_c Component, class ComponentContainer, std::forward_iterator ForwardIterator,
           std::output_iterator<Idx2D> OutputIterator>
     requires model_component_state_c<MainModelState, ComponentContainer, Component>
@@ -274,6 +292,26 @@ inline UpdateChange update_component(MainModelState<ComponentContainer>& state,
                                        detail::get_component_sequence_by_iter<Component>(state, begin, end));
 }
 
+// template to restore components with their inverse update
+//    a component whose inverse update cannot be applied as a regular update restores it with restore(),
+//    e.g. because a nan value in its inverse update means unset instead of unchanged
+template <component_c Component, class ComponentContainer, std::forward_iterator ForwardIterator,
+          std::output_iterator<Idx2D> OutputIterator>
+    requires model_component_state_c<MainModelState, ComponentContainer, Component>
+inline UpdateChange restore_component(MainModelState<ComponentContainer>& state, ForwardIterator begin,
+                                      ForwardIterator end, OutputIterator changed_it,
+                                      std::span<Idx2D const> sequence_idx) {
+    return detail::apply_component_update<Component>(
+        state, std::move(begin), std::move(end), std::move(changed_it), sequence_idx,
+        [](Component& comp, typename Component::UpdateType const& inverse_data) {
+            if constexpr (requires { comp.restore(inverse_data); }) {
+                return comp.restore(inverse_data);
+            } else {
+                return comp.update(inverse_data);
+            }
+        });
+}
+
 // template to get the inverse update for components
 // using forward interators
 // different selection based on component type
@@ -301,4 +339,162 @@ inline void update_inverse(MainModelState<ComponentContainer> const& state, Forw
                                      detail::get_component_sequence_by_iter<Component>(state, begin, end));
 }
 
+namespace topology_grouping {
+// scenarios of a batch grouped by the topology they result in
+//    group 0 is the topology of the model without any status changes
+struct ScenarioTopologyGroups {
+    IdxVector group;          // topology group of each scenario
+    IdxVector scenario_order; // all scenarios, ordered by topology group
+    Idx n_groups{1};
+};
+
+namespace detail {
+// components of which the status determines the topology
+template <typename Component>
+constexpr bool affects_topology_v = std::derived_from<Component, Branch> || std::derived_from<Component, Branch3> ||
+                                    std::derived_from<Component, Source>;
+
+constexpr IntS set_status_bit(IntS status, IntS bit, IntS new_status) {
+    if (new_status == na_IntS) {
+        return status;
+    }
+    auto const mask = static_cast<IntS>(1 << bit);
+    return new_status != 0 ? static_cast<IntS>(status | mask) : static_cast<IntS>(status & ~mask);
+}
+
+// status of all connections of a component to the grid, packed in bits
+constexpr IntS connection_status(Branch const& branch) {
+    return static_cast<IntS>(static_cast<IntS>(branch.from_status()) | (static_cast<IntS>(branch.to_status()) << 1));
+}
+constexpr IntS connection_status(Branch3 const& branch3) {
+    return static_cast<IntS>(static_cast<IntS>(branch3.status_1()) | (static_cast<IntS>(branch3.status_2()) << 1) |
+                             (static_cast<IntS>(branch3.status_3()) << 2));
+}
+inline IntS connection_status(Source const& source) { return static_cast<IntS>(source.status()); }
+
+constexpr IntS updated_connection_status(IntS status, BranchUpdate const& update) {
+    return set_status_bit(set_status_bit(status, 0, update.from_status), 1, update.to_status);
+}
+constexpr IntS updated_connection_status(IntS status, Branch3Update const& update) {
+    return set_status_bit(set_status_bit(set_status_bit(status, 0, update.status_1), 1, update.status_2), 2,
+                          update.status_3);
+}
+constexpr IntS updated_connection_status(IntS status, SourceUpdate const& update) {
+    return set_status_bit(status, 0, update.status);
+}
+
+template <typename Component> constexpr IntS updated_connection_status(IntS status, auto const& update) {
+    if constexpr (std::derived_from<Component, Branch>) {
+        return updated_connection_status(status, static_cast<BranchUpdate const&>(update));
+    } else if constexpr (std::derived_from<Component, Branch3>) {
+        return updated_connection_status(status, static_cast<Branch3Update const&>(update));
+    } else {
+        return updated_connection_status(status, static_cast<SourceUpdate const&>(update));
+    }
+}
+
+// the topology key of a scenario lists all components of which the connection status differs from the model
+//    as flattened (group, pos, status) triplets, ordered by component
+using TopologyKey = IdxVector;
+
+struct TopologyKeyHash {
+    size_t operator()(TopologyKey const& key) const {
+        size_t result = key.size();
+        for (Idx const value : key) {
+            result ^= std::hash<Idx>{}(value) + 0x9e3779b97f4a7c15ULL + (result << 6) + (result >> 2);
+        }
+        return result;
+    }
+};
+
+template <class... ComponentTypes, class ComponentContainer>
+TopologyKey get_topology_key(MainModelState<ComponentContainer> const& state, ConstDataset const& update_data,
+                             Idx scenario_idx, utils::ComponentFlags<ComponentTypes...> const& components_to_update,
+                             independence::UpdateIndependence<ComponentTypes...> const& independence) {
+    std::map<std::pair<Idx, Idx>, std::pair<IntS, IntS>> statuses; // (group, pos) -> (original, updated)
+
+    utils::run_functor_with_all_types_return_void<ComponentTypes...>([&]<typename CompType>() {
+        constexpr auto comp_idx = utils::index_of_component<CompType, ComponentTypes...>;
+        if constexpr (affects_topology_v<CompType>) {
+            if (!std::get<comp_idx>(components_to_update)) {
+                return;
+            }
+            auto const process = [&state, &statuses, &independence](auto const& span) {
+                auto const sequence = update::detail::get_component_sequence_by_iter<CompType>(
+                    state, std::begin(span), std::end(span), std::get<comp_idx>(independence).get_n_elements());
+                update::detail::iterate_component_sequence<CompType>(
+                    [&state, &statuses](typename CompType::UpdateType const& update, Idx2D const& sequence_single) {
+                        auto [it, inserted] = statuses.try_emplace({sequence_single.group, sequence_single.pos});
+                        if (inserted) {
+                            auto const status = connection_status(get_component<CompType>(state, sequence_single));
+                            it->second = {status, status};
+                        }
+                        it->second.second = updated_connection_status<CompType>(it->second.second, update);
+                    },
+                    std::begin(span), std::end(span), sequence);
+            };
+            if (update_data.is_columnar(CompType::name)) {
+                process(update_data.get_columnar_buffer_span<meta_data::update_getter_s, CompType>(scenario_idx));
+            } else {
+                process(update_data.get_buffer_span<meta_data::update_getter_s, CompType>(scenario_idx));
+            }
+        }
+    });
+
+    TopologyKey result;
+    for (auto const& [idx, status] : statuses) {
+        if (status.first != status.second) {
+            result.insert(result.end(), {idx.first, idx.second, Idx{status.second}});
+        }
+    }
+    return result;
+}
+} // namespace detail
+
+// group the scenarios of a batch by the topology they result in, so that the topology and the math solvers can be
+// reused for consecutive scenarios of the same group
+//    the connection status updates are hashed per scenario, scenarios with the same resulting statuses share a group
+//    scenarios of which the update cannot be interpreted get their own group, the error is reported when the
+//    scenario itself is calculated
+template <class... ComponentTypes, class ComponentContainer>
+ScenarioTopologyGroups
+group_scenarios_by_topology(MainModelState<ComponentContainer> const& state, ConstDataset const& update_data,
+                            Idx n_scenarios, utils::ComponentFlags<ComponentTypes...> const& components_to_update,
+                            independence::UpdateIndependence<ComponentTypes...> const& independence) {
+    ScenarioTopologyGroups result{.group = IdxVector(n_scenarios, 0), .scenario_order = IdxVector(n_scenarios)};
+    std::iota(result.scenario_order.begin(), result.scenario_order.end(), Idx{0});
+
+    bool const any_topology_update = [&components_to_update] {
+        bool result = false;
+        utils::run_functor_with_all_types_return_void<ComponentTypes...>([&]<typename CompType>() {
+            result = result || (detail::affects_topology_v<CompType> &&
+                                std::get<utils::index_of_component<CompType, ComponentTypes...>>(components_to_update));
+        });
+        return result;
+    }();
+    if (!any_topology_update) {
+        return result;
+    }
+
+    std::unordered_map<detail::TopologyKey, Idx, detail::TopologyKeyHash> groups{{detail::TopologyKey{}, Idx{0}}};
+    for (Idx scenario_idx = 0; scenario_idx != n_scenarios; ++scenario_idx) {
+        try {
+            auto const key = detail::get_topology_key<ComponentTypes...>(state, update_data, scenario_idx,
+                                                                         components_to_update, independence);
+            result.group[scenario_idx] = groups.try_emplace(key, result.n_groups).first->second;
+            if (result.group[scenario_idx] == result.n_groups) {
+                ++result.n_groups;
+            }
+        } catch (std::exception const&) {
+            result.group[scenario_idx] = result.n_groups++;
+        }
+    }
+
+    std::ranges::stable_sort(result.scenario_order, {},
+                             [&result](Idx scenario_idx) { return result.group[scenario_idx]; });
+    return result;
+}
+
+} // namespace topology_grouping
+
 } // namespace power_grid_model::main_core::update
@@ -7,6 +7,7 @@
 #include "main_model_impl.hpp"
 
 #include <memory>
+#include <utility>
 
 namespace power_grid_model {
 
@@ -23,8 +24,9 @@ class MainModel {
     using Options = MainModelOptions;
 
     explicit MainModel(double system_frequency, ConstDataset const& input_data,
-                       MathSolverDispatcher const& math_solver_dispatcher, Idx pos = 0)
-        : impl_{std::make_unique<Impl>(system_frequency, input_data, math_solver_dispatcher, pos)} {}
+                       MathSolverDispatcher const& math_solver_dispatcher, Idx pos = 0,
+                       Idx threading = Options::sequential)
+        : impl_{std::make_unique<Impl>(system_frequency, input_data, math_solver_dispatcher, pos, threading)} {}
     explicit MainModel(double system_frequency, meta_data::MetaData const& meta_data,
                        MathSolverDispatcher const& math_solver_dispatcher)
         : impl_{std::make_unique<Impl>(system_frequency, meta_data, math_solver_dispatcher)} {};
@@ -57,6 +59,11 @@ class MainModel {
         impl().get_indexer(component_type, id_begin, size, indexer_begin);
     }
 
+    main_core::MathTopologyCache math_topology() { return impl().math_topology(); }
+    void restore_math_topology(main_core::MathTopologyCache topology) {
+        impl().restore_math_topology(std::move(topology));
+    }
+
     template <cache_type_c CacheType> void update_components(ConstDataset const& update_data) {
         impl().update_components<CacheType>(update_data.get_individual_scenario(0));
     }
@@ -66,7 +73,21 @@ class MainModel {
         return impl().calculate(options, result_data, update_data);
     }
 
+    BatchParameter calculate(Options const& options, BatchReduction const& reduction,
+                             ConstDataset const& update_data) {
+        return impl().calculate(options, reduction, update_data);
+    }
+
+    template <typename Produce, typename Consume>
+    void calculate_pipelined(Options const& options, Idx n_scenarios, Idx chunk_size, Produce produce,
+                             Consume consume) {
+        impl().calculate_pipelined(options, n_scenarios, chunk_size, std::move(produce), std::move(consume));
+    }
+
     CalculationInfo calculation_info() const { return impl().calculation_info(); }
+    std::vector<CalculationInfo> const& scenario_calculation_info() const {
+        return impl().scenario_calculation_info();
+    }
 
     void check_no_experimental_features_used(Options const& options) const {
         impl().check_no_experimental_features_used(options);
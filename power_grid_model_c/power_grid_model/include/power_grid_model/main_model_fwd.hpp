@@ -10,9 +10,12 @@ namespace power_grid_model {
 
 struct cached_update_t : std::true_type {};
 struct permanent_update_t : std::false_type {};
+// permanent update that restores the components with their cached inverse update
+struct restore_update_t : std::false_type {};
 
 template <typename T>
-concept cache_type_c = std::same_as<T, cached_update_t> || std::same_as<T, permanent_update_t>;
+concept cache_type_c =
+    std::same_as<T, cached_update_t> || std::same_as<T, permanent_update_t> || std::same_as<T, restore_update_t>;
 
 struct MainModelOptions {
     static constexpr Idx sequential = -1;
@@ -22,12 +25,21 @@ struct MainModelOptions {
     CalculationMethod calculation_method{CalculationMethod::default_method};
     OptimizerType optimizer_type{OptimizerType::no_optimization};
     OptimizerStrategy optimizer_strategy{OptimizerStrategy::fast_any};
+    bool tap_sensitivity_search{false};
 
     double err_tol{1e-8};
     Idx max_iter{20};
     Idx threading{sequential};
+    Idx batch_chunk_size{0};
+    Idx linear_panel_size{1};
+    Idx sparse_solver_threading{sequential};
+    Idx island_threading{sequential};
+    bool warm_start{false};
+    bool flat_start{false}; // ignore the initial voltages of the nodes
+    SparseOrderingMethod sparse_ordering{SparseOrderingMethod::minimum_degree};
 
     ShortCircuitVoltageScaling short_circuit_voltage_scaling{ShortCircuitVoltageScaling::maximum};
+    bool short_circuit_sweep{false};
 };
 
 } // namespace power_grid_model
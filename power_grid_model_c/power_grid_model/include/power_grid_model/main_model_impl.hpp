@@ -8,14 +8,17 @@
 
 // main include
 #include "batch_parameter.hpp"
+#include "batch_reduction.hpp"
 #include "calculation_parameters.hpp"
 #include "container.hpp"
 #include "main_model_fwd.hpp"
 #include "topology.hpp"
 
 // common
+#include "common/batch_pipeline.hpp"
 #include "common/common.hpp"
 #include "common/exception.hpp"
+#include "common/thread_pool.hpp"
 #include "common/timer.hpp"
 
 // component include
@@ -39,9 +42,13 @@
 #include "main_core/update.hpp"
 
 // stl library
+#include <algorithm>
+#include <array>
+#include <exception>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <span>
-#include <thread>
 
 namespace power_grid_model {
 
@@ -78,6 +85,32 @@ template <> struct output_type_getter<SolverOutput<asymmetric_t>> {
     using type = meta_data::asym_output_getter_s;
 };
 
+// batch result that writes the output of each scenario to its own position in the result data
+//    a batch result provides a thread result for each thread of the batch calculation, with
+//        data(): the result data to which the calculation of a scenario writes its output
+//        position(scenario): the position in the result data to write the output of the scenario to
+//        add_scenario(scenario): called after the output of the scenario is written
+//    and merges the thread result when the thread is done, see BatchReductionResult for a reducing batch result
+class BatchResultData {
+  public:
+    explicit BatchResultData(MutableDataset const& result_data) : result_data_{&result_data} {}
+
+    BatchResultData thread_result() const { return *this; }
+    static void merge(BatchResultData const& /* thread_result */) {}
+
+    MutableDataset const& data() const { return *result_data_; }
+    static constexpr Idx position(Idx scenario) { return scenario; }
+    static constexpr void add_scenario(Idx /* scenario */) {}
+
+  private:
+    MutableDataset const* result_data_;
+};
+
+// the scenarios of a batch calculation are calculated one by one, see MainModelImpl::batch_calculation_
+struct NoBatchPanel {
+    template <typename... Args> constexpr Idx operator()(Args const&... /* args */) const { return 0; }
+};
+
 struct power_flow_t {};
 struct state_estimation_t {};
 struct short_circuit_t {};
@@ -161,11 +194,16 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     using Options = MainModelOptions;
 
     // constructor with data
+    //    threading is used to construct the model and the topology, as for the batch calculation
+    //        < 0 sequential, = 0 number of hardware threads, > 0 specified number of threads
+    //    the resulting model does not depend on the threading
     explicit MainModelImpl(double system_frequency, ConstDataset const& input_data,
-                           MathSolverDispatcher const& math_solver_dispatcher, Idx pos = 0)
+                           MathSolverDispatcher const& math_solver_dispatcher, Idx pos = 0,
+                           Idx threading = sequential)
         : system_frequency_{system_frequency},
           meta_data_{&input_data.meta_data()},
-          math_solver_dispatcher_{&math_solver_dispatcher} {
+          math_solver_dispatcher_{&math_solver_dispatcher},
+          construction_threading_{threading} {
         assert(input_data.get_description().dataset->name == std::string_view("input"));
         add_components(input_data, pos);
         set_construction_complete();
@@ -206,7 +244,8 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     template <std::derived_from<Base> CompType, std::forward_iterator ForwardIterator>
     void add_component(ForwardIterator begin, ForwardIterator end) {
         assert(!construction_complete_);
-        main_core::add_component<CompType>(state_, begin, end, system_frequency_);
+        main_core::add_component<CompType>(state_, begin, end, system_frequency_,
+                                           get_n_threads(std::distance(begin, end), construction_threading_));
     }
 
     void add_components(ConstDataset const& input_data, Idx pos = 0) {
@@ -235,9 +274,19 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             main_core::update::update_inverse<CompType>(
                 state_, begin, end, std::back_inserter(std::get<comp_index>(cached_inverse_update_)), sequence_idx);
         }
+        if constexpr (std::derived_from<CompType, Regulator>) {
+            if (changes_regulator_status<CompType>(begin, end, sequence_idx)) {
+                regulator_order_.reset();
+            }
+        }
 
-        UpdateChange const changed = main_core::update::update_component<CompType>(
-            state_, begin, end, std::back_inserter(std::get<comp_index>(parameter_changed_components_)), sequence_idx);
+        auto changed_it = std::back_inserter(std::get<comp_index>(parameter_changed_components_));
+        UpdateChange changed;
+        if constexpr (std::same_as<CacheType, restore_update_t>) {
+            changed = main_core::update::restore_component<CompType>(state_, begin, end, changed_it, sequence_idx);
+        } else {
+            changed = main_core::update::update_component<CompType>(state_, begin, end, changed_it, sequence_idx);
+        }
 
         // update, get changed variable
         update_state(changed);
@@ -364,7 +413,44 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         main_core::utils::run_functor_with_all_types_return_void<ComponentType...>(get_index_func);
     }
 
+    // topology of the math models for the current state of the components, it is built if it is not up to date
+    main_core::MathTopologyCache math_topology() {
+        assert(construction_complete_);
+        if (!is_topology_up_to_date_) {
+            rebuild_topology();
+        }
+        return {.math_topology = state_.math_topology, .topo_comp_coup = state_.topo_comp_coup};
+    }
+
+    // restore the topology of the math models as returned by math_topology() of a model with the same components in
+    // the same state, e.g. from a model snapshot
+    //    the topology is checked to be consistent with the components, see main_core::is_consistent_math_topology
+    void restore_math_topology(main_core::MathTopologyCache topology) {
+        assert(construction_complete_);
+        if (!main_core::is_consistent_math_topology(*state_.comp_topo, topology)) {
+            throw SerializationError{"The restored topology does not match the components of the model!\n"};
+        }
+        auto const n_math_topologies = static_cast<Idx>(topology.math_topology.size());
+        reset_solvers();
+        state_.math_topology = std::move(topology.math_topology);
+        state_.topo_comp_coup = std::move(topology.topo_comp_coup);
+        n_math_solvers_ = n_math_topologies;
+        is_topology_up_to_date_ = true;
+    }
+
   private:
+    // number of elements of a given component type
+    Idx component_count(std::string_view component_type) const {
+        Idx result{};
+        main_core::utils::run_functor_with_all_types_return_void<ComponentType...>(
+            [&state = this->state_, component_type, &result]<typename CT>() {
+                if (component_type == CT::name) {
+                    result = state.components.template size<CT>();
+                }
+            });
+        return result;
+    }
+
     // Entry point for main_model.hpp
     main_core::utils::SequenceIdx<ComponentType...> get_all_sequence_idx_map(ConstDataset const& update_data) {
         auto const components_to_update = get_components_to_update(update_data);
@@ -374,12 +460,42 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             state_, update_data, 0, components_to_update, update_independence, false);
     }
 
+    // the topology is rebuilt at the next calculation if the fill-reducing ordering changes
+    void set_sparse_ordering(SparseOrderingMethod sparse_ordering) {
+        if (sparse_ordering != sparse_ordering_) {
+            sparse_ordering_ = sparse_ordering;
+            is_topology_up_to_date_ = false;
+        }
+    }
+
+    // the topology after the update is known to be the same as the one the topology and the math solvers were last
+    // built for, e.g. because the scenarios only differ in the parameters
+    //    the parameters still need to be updated
+    void reuse_topology() {
+        assert(construction_complete_);
+        is_topology_up_to_date_ = true;
+    }
+
+    template <std::derived_from<Regulator> CompType, std::forward_iterator ForwardIterator>
+    bool changes_regulator_status(ForwardIterator begin, ForwardIterator end,
+                                  std::span<Idx2D const> sequence_idx) const {
+        auto sequence = sequence_idx.begin();
+        return std::any_of(begin, end, [this, &sequence](typename CompType::UpdateType const& update_data) {
+            auto const& regulator = main_core::get_component<CompType>(state_, *sequence++);
+            return !is_nan(update_data.status) && static_cast<bool>(update_data.status) != regulator.status();
+        });
+    }
+
     void update_state(UpdateChange const& changes) {
         // if topology changed, everything is not up to date
         // if only param changed, set param to not up to date
         is_topology_up_to_date_ = is_topology_up_to_date_ && !changes.topo;
         is_sym_parameter_up_to_date_ = is_sym_parameter_up_to_date_ && !changes.topo && !changes.param;
         is_asym_parameter_up_to_date_ = is_asym_parameter_up_to_date_ && !changes.topo && !changes.param;
+        // the order of the regulated transformers only depends on the statuses of the components and the regulators
+        if (changes.topo) {
+            regulator_order_.reset();
+        }
     }
 
     template <typename CompType> void restore_component(SequenceIdxView const& sequence_idx) {
@@ -389,7 +505,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         auto const& component_sequence = std::get<component_index>(sequence_idx);
 
         if (!cached_inverse_update.empty()) {
-            update_component<CompType, permanent_update_t>(cached_inverse_update, component_sequence);
+            update_component<CompType, restore_update_t>(cached_inverse_update, component_sequence);
             cached_inverse_update.clear();
         }
     }
@@ -414,75 +530,137 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     template <solver_output_type SolverOutputType, typename MathSolverType, typename YBus, typename InputType,
               typename PrepareInputFn, typename SolveFn>
         requires std::invocable<std::remove_cvref_t<PrepareInputFn>, Idx /*n_math_solvers*/> &&
-                 std::invocable<std::remove_cvref_t<SolveFn>, MathSolverType&, YBus const&, InputType const&> &&
+                 std::invocable<std::remove_cvref_t<SolveFn>, MathSolverType&, YBus const&, InputType const&,
+                                CalculationInfo&> &&
                  std::same_as<std::invoke_result_t<PrepareInputFn, Idx /*n_math_solvers*/>, std::vector<InputType>> &&
-                 std::same_as<std::invoke_result_t<SolveFn, MathSolverType&, YBus const&, InputType const&>,
+                 std::same_as<std::invoke_result_t<SolveFn, MathSolverType&, YBus const&, InputType const&,
+                                                   CalculationInfo&>,
                               SolverOutputType>
-    std::vector<SolverOutputType> calculate_(PrepareInputFn&& prepare_input, SolveFn&& solve) {
+    std::vector<SolverOutputType> calculate_(PrepareInputFn&& prepare_input, SolveFn&& solve, Idx island_threads = 1) {
         using sym = typename SolverOutputType::sym;
 
         assert(construction_complete_);
         calculation_info_ = CalculationInfo{};
         // prepare
         auto const& input = [this, prepare_input_ = std::forward<PrepareInputFn>(prepare_input)] {
-            Timer const timer(calculation_info_, 2100, "Prepare");
+            Timer const timer(calculation_info_, LogEvent::prepare);
             prepare_solvers<sym>();
             assert(is_topology_up_to_date_ && is_parameter_up_to_date<sym>());
             return prepare_input_(n_math_solvers_);
         }();
         // calculate
-        return [this, &input, solve_ = std::forward<SolveFn>(solve)] {
-            Timer const timer(calculation_info_, 2200, "Math Calculation");
+        return [this, &input, solve_ = std::forward<SolveFn>(solve), island_threads] {
+            Timer const timer(calculation_info_, LogEvent::math_calculation);
             auto& solvers = get_solvers<sym>();
             auto& y_bus_vec = get_y_bus<sym>();
             std::vector<SolverOutputType> solver_output;
+            if (Idx const n_workers = std::min(island_threads, n_math_solvers_); n_workers > 1) {
+                solver_output.resize(n_math_solvers_);
+                std::vector<CalculationInfo> infos(n_math_solvers_);
+                std::vector<std::exception_ptr> exceptions(n_math_solvers_);
+                for_each_island_largest_first(n_workers, [&](Idx i) {
+                    try {
+                        solver_output[i] = solve_(solvers[i], y_bus_vec[i], input[i], infos[i]);
+                    } catch (...) {
+                        exceptions[i] = std::current_exception();
+                    }
+                });
+                // same result and error as the sequential calculation
+                for (Idx i = 0; i != n_math_solvers_; ++i) {
+                    if (exceptions[i]) {
+                        std::rethrow_exception(exceptions[i]);
+                    }
+                    calculation_info_.merge(infos[i]);
+                }
+                return solver_output;
+            }
             solver_output.reserve(n_math_solvers_);
             for (Idx i = 0; i != n_math_solvers_; ++i) {
-                solver_output.emplace_back(solve_(solvers[i], y_bus_vec[i], input[i]));
+                solver_output.emplace_back(solve_(solvers[i], y_bus_vec[i], input[i], calculation_info_));
             }
             return solver_output;
         }();
     }
 
-    template <symmetry_tag sym> auto calculate_power_flow_(double err_tol, Idx max_iter) {
-        return [this, err_tol, max_iter](MainModelState const& state,
-                                         CalculationMethod calculation_method) -> std::vector<SolverOutput<sym>> {
+    // run func(math_model_idx) for all math models on n_workers threads
+    //    the math models with the most buses are started first, so that a large island does not end up last
+    template <typename Func> void for_each_island_largest_first(Idx n_workers, Func const& func) const {
+        IdxVector order(n_math_solvers_);
+        std::iota(order.begin(), order.end(), Idx{0});
+        std::ranges::stable_sort(order, std::ranges::greater{},
+                                 [this](Idx i) { return state_.math_topology[i]->n_bus(); });
+        ChunkCursor islands{n_math_solvers_, 1};
+        ThreadPool::global().parallel_run(n_workers, [&islands, &order, &func](Idx /* worker_idx */) {
+            while (auto const chunk = islands.next()) {
+                for (Idx const idx : *chunk) {
+                    func(order[idx]);
+                }
+            }
+        });
+    }
+
+    template <symmetry_tag sym>
+    auto calculate_power_flow_(double err_tol, Idx max_iter, Idx sparse_solver_threads = 1,
+                               bool warm_start = false, Idx island_threads = 1, bool flat_start = false) {
+        return [this, err_tol, max_iter, sparse_solver_threads, warm_start, island_threads, flat_start](
+                   MainModelState const& state, CalculationMethod calculation_method) -> std::vector<SolverOutput<sym>> {
             return calculate_<SolverOutput<sym>, MathSolverProxy<sym>, YBus<sym>, PowerFlowInput<sym>>(
-                [&state](Idx n_math_solvers) { return prepare_power_flow_input<sym>(state, n_math_solvers); },
-                [this, err_tol, max_iter, calculation_method](MathSolverProxy<sym>& solver, YBus<sym> const& y_bus,
-                                                              PowerFlowInput<sym> const& input) {
-                    return solver.get().run_power_flow(input, err_tol, max_iter, calculation_info_, calculation_method,
-                                                       y_bus);
-                });
+                [&state, flat_start](Idx n_math_solvers) {
+                    return prepare_power_flow_input<sym>(state, n_math_solvers, flat_start);
+                },
+                [err_tol, max_iter, sparse_solver_threads, warm_start, calculation_method](
+                    MathSolverProxy<sym>& solver, YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
+                    CalculationInfo& calculation_info) {
+                    auto& math_solver = solver.get();
+                    math_solver.set_sparse_solver_threads(sparse_solver_threads);
+                    math_solver.set_warm_start(warm_start);
+                    return math_solver.run_power_flow(input, err_tol, max_iter, calculation_info, calculation_method,
+                                                      y_bus);
+                },
+                island_threads);
         };
     }
 
-    template <symmetry_tag sym> auto calculate_state_estimation_(double err_tol, Idx max_iter) {
-        return [this, err_tol, max_iter](MainModelState const& state,
-                                         CalculationMethod calculation_method) -> std::vector<SolverOutput<sym>> {
+    template <symmetry_tag sym>
+    auto calculate_state_estimation_(double err_tol, Idx max_iter, Idx sparse_solver_threads = 1,
+                                     Idx island_threads = 1) {
+        return [this, err_tol, max_iter, sparse_solver_threads, island_threads](
+                   MainModelState const& state, CalculationMethod calculation_method) -> std::vector<SolverOutput<sym>> {
             return calculate_<SolverOutput<sym>, MathSolverProxy<sym>, YBus<sym>, StateEstimationInput<sym>>(
                 [&state](Idx n_math_solvers) { return prepare_state_estimation_input<sym>(state, n_math_solvers); },
-                [this, err_tol, max_iter, calculation_method](MathSolverProxy<sym>& solver, YBus<sym> const& y_bus,
-                                                              StateEstimationInput<sym> const& input) {
-                    return solver.get().run_state_estimation(input, err_tol, max_iter, calculation_info_,
-                                                             calculation_method, y_bus);
-                });
+                [err_tol, max_iter, sparse_solver_threads, calculation_method](
+                    MathSolverProxy<sym>& solver, YBus<sym> const& y_bus, StateEstimationInput<sym> const& input,
+                    CalculationInfo& calculation_info) {
+                    auto& math_solver = solver.get();
+                    math_solver.set_sparse_solver_threads(sparse_solver_threads);
+                    return math_solver.run_state_estimation(input, err_tol, max_iter, calculation_info,
+                                                            calculation_method, y_bus);
+                },
+                island_threads);
         };
     }
 
-    template <symmetry_tag sym> auto calculate_short_circuit_(ShortCircuitVoltageScaling voltage_scaling) {
-        return [this,
-                voltage_scaling](MainModelState const& /*state*/,
-                                 CalculationMethod calculation_method) -> std::vector<ShortCircuitSolverOutput<sym>> {
+    template <symmetry_tag sym>
+    auto calculate_short_circuit_(ShortCircuitVoltageScaling voltage_scaling, Idx sparse_solver_threads = 1,
+                                  bool sweep = false, Idx island_threads = 1) {
+        return [this, voltage_scaling, sparse_solver_threads, sweep, island_threads](
+                   MainModelState const& /*state*/,
+                   CalculationMethod calculation_method) -> std::vector<ShortCircuitSolverOutput<sym>> {
             return calculate_<ShortCircuitSolverOutput<sym>, MathSolverProxy<sym>, YBus<sym>, ShortCircuitInput>(
                 [this, voltage_scaling](Idx /* n_math_solvers */) {
                     assert(is_topology_up_to_date_ && is_parameter_up_to_date<sym>());
                     return prepare_short_circuit_input<sym>(voltage_scaling);
                 },
-                [this, calculation_method](MathSolverProxy<sym>& solver, YBus<sym> const& y_bus,
-                                           ShortCircuitInput const& input) {
-                    return solver.get().run_short_circuit(input, calculation_info_, calculation_method, y_bus);
-                });
+                [sparse_solver_threads, sweep, calculation_method](MathSolverProxy<sym>& solver,
+                                                                   YBus<sym> const& y_bus,
+                                                                   ShortCircuitInput const& input,
+                                                                   CalculationInfo& calculation_info) {
+                    auto& math_solver = solver.get();
+                    math_solver.set_sparse_solver_threads(sparse_solver_threads);
+                    math_solver.set_short_circuit_sweep(sweep);
+                    return math_solver.run_short_circuit(input, calculation_info, calculation_method, y_bus);
+                },
+                island_threads);
         };
     }
 
@@ -491,21 +669,37 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
 
     The calculation function should be able to run standalone.
     It should output to the provided result_data if the trailing argument is not ignore_output.
+    The output of the scenarios is collected by the batch result, see BatchResultData.
 
     threading
         < 0 sequential
         = 0 parallel, use number of hardware threads
         > 0 specify number of parallel threads
+    chunk_size
+        <= 0 automatic
+        > 0 number of consecutive scenarios a thread claims at a time
+    panel_size
+        <= 1 the scenarios are calculated one by one
+        > 1 up to panel_size consecutive scenarios of a chunk with the topology of the model are calculated together
+            by calculate_panel, see batch_panel_calculation
     raise a BatchCalculationError if any of the calculations in the batch raised an exception
     */
-    template <typename Calculate>
+    template <typename Calculate, typename BatchResult, typename CalculatePanel = NoBatchPanel>
         requires std::invocable<std::remove_cvref_t<Calculate>, MainModelImpl&, MutableDataset const&, Idx>
-    BatchParameter batch_calculation_(Calculate&& calculation_fn, MutableDataset const& result_data,
-                                      ConstDataset const& update_data, Idx threading = sequential) {
+    BatchParameter batch_calculation_(Calculate&& calculation_fn, BatchResult& results,
+                                      ConstDataset const& update_data, Idx threading = sequential,
+                                      Idx chunk_size = 0, Idx panel_size = 1,
+                                      CalculatePanel calculate_panel = {}) {
+        scenario_calculation_info_.clear();
+
         // if the update dataset is empty without any component
         // execute one power flow in the current instance, no batch calculation is needed
         if (update_data.empty()) {
-            std::forward<Calculate>(calculation_fn)(*this, result_data, 0);
+            auto thread_result = results.thread_result();
+            std::forward<Calculate>(calculation_fn)(*this, thread_result.data(), thread_result.position(0));
+            thread_result.add_scenario(0);
+            results.merge(thread_result);
+            scenario_calculation_info_.push_back(calculation_info_);
             return BatchParameter{};
         }
 
@@ -540,23 +734,33 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
 
         // lambda for sub batch calculation
         main_core::utils::SequenceIdx<ComponentType...> all_scenarios_sequence;
-        auto sub_batch = sub_batch_calculation_(std::forward<Calculate>(calculation_fn), result_data, update_data,
-                                                all_scenarios_sequence, exceptions, infos);
+        auto sub_batch = sub_batch_calculation_(std::forward<Calculate>(calculation_fn), results, update_data,
+                                                all_scenarios_sequence, exceptions, infos, panel_size,
+                                                std::move(calculate_panel));
 
-        batch_dispatch(sub_batch, n_scenarios, threading);
+        // the models of the scenarios share the component storage with this model, which is not modified in the batch
+        state_.components.set_share_storage_on_copy(true);
+        try {
+            batch_dispatch(sub_batch, n_scenarios, threading, chunk_size, panel_size);
+        } catch (...) {
+            state_.components.set_share_storage_on_copy(false);
+            throw;
+        }
+        state_.components.set_share_storage_on_copy(false);
 
-        handle_batch_exceptions(exceptions);
         calculation_info_ = main_core::merge_calculation_info(infos);
+        scenario_calculation_info_ = std::move(infos);
+        handle_batch_exceptions(exceptions);
 
         return BatchParameter{};
     }
 
-    template <typename Calculate>
+    template <typename Calculate, typename BatchResult, typename CalculatePanel>
         requires std::invocable<std::remove_cvref_t<Calculate>, MainModelImpl&, MutableDataset const&, Idx>
-    auto sub_batch_calculation_(Calculate&& calculation_fn, MutableDataset const& result_data,
-                                ConstDataset const& update_data,
+    auto sub_batch_calculation_(Calculate&& calculation_fn, BatchResult& results, ConstDataset const& update_data,
                                 main_core::utils::SequenceIdx<ComponentType...>& all_scenarios_sequence,
-                                std::vector<std::string>& exceptions, std::vector<CalculationInfo>& infos) {
+                                std::vector<std::string>& exceptions, std::vector<CalculationInfo>& infos,
+                                Idx panel_size, CalculatePanel calculate_panel) {
         // const ref of current instance
         MainModelImpl const& base_model = *this;
 
@@ -568,19 +772,35 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         all_scenarios_sequence = main_core::update::get_all_sequence_idx_map<ComponentType...>(
             state_, update_data, 0, components_to_update, update_independence, false);
 
+        // scenarios with the same topology are scheduled consecutively, so that they can share the topology and
+        // the math solvers of the thread
+        auto topology_groups = main_core::update::topology_grouping::group_scenarios_by_topology<ComponentType...>(
+            state_, update_data, narrow_cast<Idx>(exceptions.size()), components_to_update, update_independence);
+
         return [&base_model, &exceptions, &infos, calculation_fn_ = std::forward<Calculate>(calculation_fn),
-                &result_data, &update_data, &all_scenarios_sequence_ = std::as_const(all_scenarios_sequence),
-                components_to_update, update_independence](Idx start, Idx stride, Idx n_scenarios) {
-            assert(n_scenarios <= narrow_cast<Idx>(exceptions.size()));
-            assert(n_scenarios <= narrow_cast<Idx>(infos.size()));
+                &results, &update_data, &all_scenarios_sequence_ = std::as_const(all_scenarios_sequence),
+                components_to_update, update_independence, topology_groups_ = std::move(topology_groups),
+                panel_size, calculate_panel_ = std::move(calculate_panel)](ChunkCursor& chunks) {
+            // only copy the model if there is any work left for this thread
+            auto chunk = chunks.next();
+            if (!chunk) {
+                return;
+            }
+            Idx const start = topology_groups_.scenario_order[chunk->front()];
+            assert(chunk->back() < narrow_cast<Idx>(exceptions.size()));
+            assert(chunk->back() < narrow_cast<Idx>(infos.size()));
 
-            Timer const t_total(infos[start], 0000, "Total in thread");
+            Timer const t_total(infos[start], LogEvent::total_batch_calculation_in_thread);
 
-            auto const copy_model_functor = [&base_model, &infos](Idx scenario_idx) {
-                Timer const t_copy_model_functor(infos[scenario_idx], 1100, "Copy model");
+            // topology group for which the topology and the math solvers of the model are built, if any
+            Idx model_topology_group{na_Idx};
+            auto const copy_model_functor = [&base_model, &infos, &model_topology_group](Idx scenario_idx) {
+                Timer const t_copy_model_functor(infos[scenario_idx], LogEvent::copy_model);
+                model_topology_group = base_model.is_topology_up_to_date_ ? Idx{0} : na_Idx;
                 return MainModelImpl{base_model};
             };
             auto model = copy_model_functor(start);
+            auto thread_result = results.thread_result();
 
             auto current_scenario_sequence_cache = main_core::utils::SequenceIdx<ComponentType...>{};
             auto [setup, winddown] =
@@ -588,18 +808,95 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
                                         all_scenarios_sequence_, current_scenario_sequence_cache, infos);
 
             auto calculate_scenario = MainModelImpl::call_with<Idx>(
-                [&model, &calculation_fn_, &result_data, &infos](Idx scenario_idx) {
-                    calculation_fn_(model, result_data, scenario_idx);
+                [&model, &calculation_fn_, &thread_result, &infos, &model_topology_group,
+                 &topology_group_ = std::as_const(topology_groups_.group)](Idx scenario_idx) {
+                    if (topology_group_[scenario_idx] == model_topology_group) {
+                        model.reuse_topology();
+                    }
+                    model_topology_group = na_Idx;
+                    calculation_fn_(model, thread_result.data(), thread_result.position(scenario_idx));
+                    thread_result.add_scenario(scenario_idx);
+                    if (model.is_topology_up_to_date_) {
+                        model_topology_group = topology_group_[scenario_idx];
+                    }
                     infos[scenario_idx].merge(model.calculation_info_);
                 },
-                std::move(setup), std::move(winddown), scenario_exception_handler(model, exceptions, infos),
+                setup, winddown, scenario_exception_handler(model, exceptions, infos),
                 [&model, &copy_model_functor](Idx scenario_idx) { model = copy_model_functor(scenario_idx); });
 
-            for (Idx scenario_idx = start; scenario_idx < n_scenarios; scenario_idx += stride) {
-                Timer const t_total_single(infos[scenario_idx], 0100, "Total single calculation in thread");
+            // a panel of scenarios is only calculated together if the update of each of them succeeds
+            auto const with_scenario = [&setup, &winddown, &model, &copy_model_functor](Idx scenario_idx,
+                                                                                        auto const& func) {
+                bool success = true;
+                MainModelImpl::call_with<Idx>(
+                    [&func](Idx /* scenario_idx */) { func(); }, setup, winddown,
+                    [&success](Idx /* scenario_idx */) { success = false; },
+                    [&model, &copy_model_functor](Idx idx) { model = copy_model_functor(idx); })(scenario_idx);
+                return success;
+            };
+            // write the output of a scenario of a panel by write_output(target_data, pos)
+            auto const output_scenario = [&setup, &winddown, &model, &copy_model_functor, &thread_result,
+                                          &exceptions, &infos](Idx scenario_idx, auto const& write_output) {
+                MainModelImpl::call_with<Idx>(
+                    [&write_output, &thread_result](Idx idx) {
+                        write_output(thread_result.data(), thread_result.position(idx));
+                        thread_result.add_scenario(idx);
+                    },
+                    setup, winddown, scenario_exception_handler(model, exceptions, infos),
+                    [&model, &copy_model_functor](Idx idx) { model = copy_model_functor(idx); })(scenario_idx);
+            };
+            // the scenarios [order_begin, order_end) of the chunk in the topology group of the model
+            IdxVector panel_scenarios;
+            auto const calculate_panel = [&](Idx order_begin, Idx order_end) -> Idx {
+                panel_scenarios.clear();
+                for (Idx order_idx = order_begin;
+                     order_idx != order_end && std::ssize(panel_scenarios) != panel_size; ++order_idx) {
+                    Idx const scenario_idx = topology_groups_.scenario_order[order_idx];
+                    if (model_topology_group == na_Idx ||
+                        topology_groups_.group[scenario_idx] != model_topology_group) {
+                        break;
+                    }
+                    panel_scenarios.push_back(scenario_idx);
+                }
+                if (std::ssize(panel_scenarios) < 2) {
+                    return 0;
+                }
+                CalculationInfo panel_info;
+                Timer t_total_panel(panel_info, LogEvent::total_single_calculation_in_thread);
+                Idx const n_calculated = calculate_panel_(model, std::span<Idx const>{panel_scenarios},
+                                                          with_scenario, output_scenario);
+                t_total_panel.stop();
+                if (n_calculated == 0) {
+                    infos[panel_scenarios.front()].merge(panel_info);
+                    return 0;
+                }
+                // the calculated scenarios of the panel share its calculation info evenly, so the merged calculation
+                // info of the batch is the same as if the panel was attributed to a single scenario
+                panel_info.merge(model.calculation_info_);
+                CalculationInfo const scenario_info = panel_info.shared_by(n_calculated);
+                for (Idx const scenario_idx : std::span<Idx const>{panel_scenarios}.first(n_calculated)) {
+                    infos[scenario_idx].merge(scenario_info);
+                }
+                return n_calculated;
+            };
+
+            do {
+                for (Idx order_idx = chunk->front(); order_idx != chunk->back() + 1;) {
+                    if (panel_size > 1) {
+                        if (Idx const n_calculated = calculate_panel(order_idx, chunk->back() + 1); n_calculated > 0) {
+                            order_idx += n_calculated;
+                            continue;
+                        }
+                    }
+                    Idx const scenario_idx = topology_groups_.scenario_order[order_idx];
+                    Timer const t_total_single(infos[scenario_idx], LogEvent::total_single_calculation_in_thread);
 
-                calculate_scenario(scenario_idx);
-            }
+                    calculate_scenario(scenario_idx);
+                    ++order_idx;
+                }
+            } while ((chunk = chunks.next()));
+
+            results.merge(thread_result);
         };
     }
 
@@ -607,27 +904,37 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     //    specified threading < 0
     //    use hardware threads, but it is either unknown (0) or only has one thread (1)
     //    specified threading = 1
-    template <typename RunSubBatchFn>
-        requires std::invocable<std::remove_cvref_t<RunSubBatchFn>, Idx /*start*/, Idx /*stride*/, Idx /*n_scenarios*/>
-    static void batch_dispatch(RunSubBatchFn sub_batch, Idx n_scenarios, Idx threading) {
-        // run batches sequential or parallel
-        auto const hardware_thread = static_cast<Idx>(std::thread::hardware_concurrency());
+    static Idx get_n_threads(Idx n_scenarios, Idx threading) {
+        auto const hardware_thread = ThreadPool::hardware_concurrency();
         if (threading < 0 || threading == 1 || (threading == 0 && hardware_thread < 2)) {
-            // run all in sequential
-            sub_batch(0, 1, n_scenarios);
-        } else {
-            // create parallel threads
-            Idx const n_thread = std::min(threading == 0 ? hardware_thread : threading, n_scenarios);
-            std::vector<std::thread> threads;
-            threads.reserve(n_thread);
-            for (Idx thread_number = 0; thread_number < n_thread; ++thread_number) {
-                // compute each sub batch with stride
-                threads.emplace_back(sub_batch, thread_number, n_thread, n_scenarios);
-            }
-            for (auto& thread : threads) {
-                thread.join();
-            }
+            return 1;
+        }
+        return std::max(std::min(threading == 0 ? hardware_thread : threading, n_scenarios), Idx{1});
+    }
+
+    // the automatic chunk size gives each thread several chunks, so that threads that finish early
+    // can take over the remaining work of slower threads, and fits at least one panel of scenarios
+    static Idx get_chunk_size(Idx n_scenarios, Idx n_threads, Idx chunk_size, Idx panel_size = 1) {
+        constexpr Idx chunks_per_thread = 4;
+        if (n_threads == 1) {
+            return n_scenarios;
+        }
+        if (chunk_size > 0) {
+            return chunk_size;
         }
+        return std::max({n_scenarios / (n_threads * chunks_per_thread), panel_size, Idx{1}});
+    }
+
+    // the threads of the process-wide thread pool claim chunks of scenarios until all scenarios are processed
+    template <typename RunSubBatchFn>
+        requires std::invocable<std::remove_cvref_t<RunSubBatchFn>, ChunkCursor&>
+    static void batch_dispatch(RunSubBatchFn sub_batch, Idx n_scenarios, Idx threading, Idx chunk_size,
+                               Idx panel_size = 1) {
+        Idx const n_threads = get_n_threads(n_scenarios, threading);
+        ChunkCursor chunks{n_scenarios, get_chunk_size(n_scenarios, n_threads, chunk_size, panel_size)};
+        ThreadPool::global().parallel_run(n_threads, [&sub_batch, &chunks](Idx /* thread_number */) {
+            sub_batch(chunks);
+        });
     }
 
     template <typename... Args, typename RunFn, typename SetupFn, typename WinddownFn, typename HandleExceptionFn,
@@ -682,14 +989,14 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         return std::make_pair(
             [&model, &update_data, scenario_sequence, &current_scenario_sequence_cache, &components_to_store,
              do_update_cache_ = std::move(do_update_cache), &infos](Idx scenario_idx) {
-                Timer const t_update_model(infos[scenario_idx], 1200, "Update model");
+                Timer const t_update_model(infos[scenario_idx], LogEvent::update_model);
                 current_scenario_sequence_cache = main_core::update::get_all_sequence_idx_map<ComponentType...>(
                     model.state_, update_data, scenario_idx, components_to_store, do_update_cache_, true);
 
                 model.template update_components<cached_update_t>(update_data, scenario_idx, scenario_sequence());
             },
             [&model, scenario_sequence, &current_scenario_sequence_cache, &infos](Idx scenario_idx) {
-                Timer const t_update_model(infos[scenario_idx], 1201, "Restore model");
+                Timer const t_update_model(infos[scenario_idx], LogEvent::restore_model);
 
                 model.restore_components(scenario_sequence());
                 std::ranges::for_each(current_scenario_sequence_cache,
@@ -733,35 +1040,51 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     // Calculate with optimization, e.g., automatic tap changer
     template <calculation_type_tag calculation_type, symmetry_tag sym> auto calculate(Options const& options) {
         auto const calculator = [this, &options] {
+            // same threading semantics as the batch calculation
+            //    the number of pivots and math models is not known at this point
+            Idx const sparse_solver_threads =
+                get_n_threads(std::numeric_limits<Idx>::max(), options.sparse_solver_threading);
+            Idx const island_threads = get_n_threads(std::numeric_limits<Idx>::max(), options.island_threading);
             if constexpr (std::derived_from<calculation_type, power_flow_t>) {
-                return calculate_power_flow_<sym>(options.err_tol, options.max_iter);
+                return calculate_power_flow_<sym>(options.err_tol, options.max_iter, sparse_solver_threads,
+                                                  options.warm_start, island_threads, options.flat_start);
             }
             assert(options.optimizer_type == OptimizerType::no_optimization);
             if constexpr (std::derived_from<calculation_type, state_estimation_t>) {
-                return calculate_state_estimation_<sym>(options.err_tol, options.max_iter);
+                return calculate_state_estimation_<sym>(options.err_tol, options.max_iter, sparse_solver_threads,
+                                                        island_threads);
             }
             if constexpr (std::derived_from<calculation_type, short_circuit_t>) {
-                return calculate_short_circuit_<sym>(options.short_circuit_voltage_scaling);
+                return calculate_short_circuit_<sym>(options.short_circuit_voltage_scaling, sparse_solver_threads,
+                                                     options.short_circuit_sweep, island_threads);
             }
             throw UnreachableHit{"MainModelImpl::calculate", "Unknown calculation type"};
         }();
 
-        SearchMethod const& search_method = options.optimizer_strategy == OptimizerStrategy::any
-                                                ? SearchMethod::linear_search
-                                                : SearchMethod::binary_search;
+        SearchMethod const search_method = [&options] {
+            switch (options.optimizer_strategy) {
+            case OptimizerStrategy::any:
+                return options.tap_sensitivity_search ? SearchMethod::sensitivity_search : SearchMethod::linear_search;
+            case OptimizerStrategy::fast_any:
+                return options.tap_sensitivity_search ? SearchMethod::sensitivity_search : SearchMethod::binary_search;
+            default:
+                return SearchMethod::binary_search;
+            }
+        }();
 
         return optimizer::get_optimizer<MainModelState, ConstDataset>(
                    options.optimizer_type, options.optimizer_strategy, calculator,
                    [this](ConstDataset const& update_data) {
                        this->update_components<permanent_update_t>(update_data);
                    },
-                   *meta_data_, search_method)
+                   *meta_data_, search_method, &regulator_order_)
             ->optimize(state_, options.calculation_method);
     }
 
     // Single calculation, propagating the results to result_data
     void calculate(Options options, MutableDataset const& result_data, Idx pos = 0) {
         assert(construction_complete_);
+        set_sparse_ordering(options.sparse_ordering);
 
         if (options.calculation_type == CalculationType::short_circuit) {
             auto const faults = state_.components.template citer<Fault>();
@@ -784,22 +1107,214 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             *this, options, result_data, pos);
     }
 
+    // calculation of a scenario of a batch calculation
+    static auto batch_scenario_calculation(Options const& options) {
+        return [&options](MainModelImpl& model, MutableDataset const& target_data, Idx pos) {
+            auto sub_opt = options; // copy
+            sub_opt.err_tol = pos != ignore_output ? options.err_tol : std::numeric_limits<double>::max();
+            sub_opt.max_iter = pos != ignore_output ? options.max_iter : 1;
+            // the model copies of the threads should not start from the voltages of this rough calculation
+            sub_opt.warm_start = pos != ignore_output && options.warm_start;
+
+            model.calculate(sub_opt, target_data, pos);
+        };
+    }
+
+    // number of consecutive scenarios of a batch calculation that are calculated together, see
+    // batch_panel_calculation
+    //    only the power flow with the linear methods without optimizer solves the scenarios of a panel together
+    static Idx get_panel_size(Options const& options) {
+        using enum CalculationMethod;
+        bool const is_linear_power_flow =
+            options.calculation_type == CalculationType::power_flow &&
+            options.optimizer_type == OptimizerType::no_optimization &&
+            (options.calculation_method == linear || options.calculation_method == linear_current);
+        return is_linear_power_flow ? std::max(options.linear_panel_size, Idx{1}) : Idx{1};
+    }
+
+    // calculation of a panel of consecutive scenarios of a batch calculation with the topology of the model
+    //    returns the number of scenarios at the start of the panel that are calculated, see
+    //    calculate_power_flow_panel_; the others are calculated one by one
+    static auto batch_panel_calculation(Options const& options) {
+        return [&options](MainModelImpl& model, std::span<Idx const> scenarios, auto const& with_scenario,
+                          auto const& output_scenario) -> Idx {
+            return calculation_symmetry_func_selector(
+                options.calculation_symmetry, [&model, &options, scenarios, &with_scenario,
+                                               &output_scenario]<symmetry_tag sym>() -> Idx {
+                    auto const math_output = model.calculate_power_flow_panel_<sym>(options, scenarios, with_scenario);
+                    for (Idx idx = 0; idx != std::ssize(math_output); ++idx) {
+                        output_scenario(scenarios[idx],
+                                        [&model, &output = math_output[idx]](MutableDataset const& target, Idx pos) {
+                                            model.output_result(output, target, pos);
+                                        });
+                    }
+                    return std::ssize(math_output);
+                });
+        };
+    }
+
+    // power flow of a panel of scenarios with the topology and the parameters of the model, solved together per math
+    // model, see MathSolver::run_power_flow_panel
+    //    with_scenario(scenario_idx, func) calls func() with the update of the scenario applied, and returns false if
+    //    the update or the restore of the scenario failed
+    //    the panel ends before the first scenario that changes the parameters, or of which the update failed
+    //    returns the math output of the scenarios of the panel, or nothing if the solver failed, so that the scenarios
+    //    are calculated (and their errors are reported) one by one; any other error is propagated
+    template <symmetry_tag sym, typename WithScenarioFn>
+    std::vector<MathOutput<std::vector<SolverOutput<sym>>>>
+    calculate_power_flow_panel_(Options const& options, std::span<Idx const> scenarios,
+                                WithScenarioFn const& with_scenario) {
+        assert(construction_complete_);
+        calculation_info_ = CalculationInfo{};
+
+        // input of each math model, for each scenario of the panel
+        std::vector<std::vector<PowerFlowInput<sym>>> inputs(n_math_solvers_);
+        Idx n_scenarios{};
+        {
+            Timer const timer(calculation_info_, LogEvent::prepare);
+            for (Idx const scenario_idx : scenarios) {
+                std::vector<PowerFlowInput<sym>> scenario_input;
+                bool const success = with_scenario(scenario_idx, [this, &options, &scenario_input] {
+                    reuse_topology();
+                    if (is_parameter_up_to_date<sym>() &&
+                        last_updated_calculation_symmetry_mode_ == is_symmetric_v<sym>) {
+                        scenario_input = prepare_power_flow_input<sym>(state_, n_math_solvers_, options.flat_start);
+                    }
+                });
+                if (!success || std::ssize(scenario_input) != n_math_solvers_ || !is_topology_up_to_date_) {
+                    break;
+                }
+                for (Idx i = 0; i != n_math_solvers_; ++i) {
+                    inputs[i].push_back(std::move(scenario_input[i]));
+                }
+                ++n_scenarios;
+            }
+        }
+
+        std::vector<MathOutput<std::vector<SolverOutput<sym>>>> math_output(n_scenarios);
+        try {
+            Timer const timer(calculation_info_, LogEvent::math_calculation);
+            Idx const sparse_solver_threads =
+                get_n_threads(std::numeric_limits<Idx>::max(), options.sparse_solver_threading);
+            auto& solvers = get_solvers<sym>();
+            auto& y_bus_vec = get_y_bus<sym>();
+            for (Idx i = 0; i != n_math_solvers_; ++i) {
+                auto& math_solver = solvers[i].get();
+                math_solver.set_sparse_solver_threads(sparse_solver_threads);
+                math_solver.set_warm_start(options.warm_start);
+                auto solver_output =
+                    math_solver.run_power_flow_panel(inputs[i], options.err_tol, options.max_iter, calculation_info_,
+                                                     options.calculation_method, y_bus_vec[i]);
+                for (Idx idx = 0; idx != n_scenarios; ++idx) {
+                    math_output[idx].solver_output.push_back(std::move(solver_output[idx]));
+                }
+            }
+        } catch (SparseMatrixError const&) {
+            return {};
+        } catch (IterationDiverge const&) {
+            return {};
+        }
+        return math_output;
+    }
+
+    // name of the output dataset of the calculation
+    static std::string_view output_dataset_name(Options const& options) {
+        if (options.calculation_type == CalculationType::short_circuit) {
+            return "sc_output";
+        }
+        return options.calculation_symmetry == CalculationSymmetry::symmetric ? "sym_output" : "asym_output";
+    }
+
   public:
     // Batch calculation, propagating the results to result_data
     BatchParameter calculate(Options const& options, MutableDataset const& result_data,
                              ConstDataset const& update_data) {
-        return batch_calculation_(
-            [&options](MainModelImpl& model, MutableDataset const& target_data, Idx pos) {
-                auto sub_opt = options; // copy
-                sub_opt.err_tol = pos != ignore_output ? options.err_tol : std::numeric_limits<double>::max();
-                sub_opt.max_iter = pos != ignore_output ? options.max_iter : 1;
+        set_sparse_ordering(options.sparse_ordering);
+        BatchResultData results{result_data};
+        return batch_calculation_(batch_scenario_calculation(options), results, update_data, options.threading,
+                                  options.batch_chunk_size, get_panel_size(options), batch_panel_calculation(options));
+    }
 
-                model.calculate(sub_opt, target_data, pos);
+    // Batch calculation, reducing the output of all scenarios as requested by reduction instead of writing the
+    // output of each scenario. The reduced values of the successful scenarios are also written if some scenarios
+    // failed.
+    BatchParameter calculate(Options const& options, BatchReduction const& reduction,
+                             ConstDataset const& update_data) {
+        if (std::string_view{reduction.dataset().name} != output_dataset_name(options)) {
+            throw DatasetError{"The dataset of the batch reduction does not match the output of the calculation!\n"};
+        }
+        set_sparse_ordering(options.sparse_ordering);
+        std::vector<Idx> n_elements;
+        n_elements.reserve(reduction.requests().size());
+        for (auto const& request : reduction.requests()) {
+            n_elements.push_back(component_count(request.component->name));
+        }
+
+        BatchReductionResult results{reduction, std::move(n_elements)};
+        try {
+            batch_calculation_(batch_scenario_calculation(options), results, update_data, options.threading,
+                               options.batch_chunk_size, get_panel_size(options), batch_panel_calculation(options));
+        } catch (BatchCalculationError const&) {
+            results.write_results();
+            throw;
+        }
+        results.write_results();
+        return BatchParameter{};
+    }
+
+    // Batch calculation in chunks of consecutive scenarios, overlapped with producing the update data of the next
+    // chunk and consuming the results of the previous chunk, see run_batch_pipeline
+    //    produce(slot, begin, end) returns the update data and the result data of the scenarios [begin, end)
+    //    consume(slot, begin, end) is called when the results of the scenarios [begin, end) are written
+    // The failed scenarios and the profile of the scenarios refer to the whole batch.
+    template <typename Produce, typename Consume>
+        requires std::invocable<Produce&, Idx, Idx, Idx> && std::invocable<Consume&, Idx, Idx, Idx>
+    void calculate_pipelined(Options const& options, Idx n_scenarios, Idx chunk_size, Produce produce,
+                             Consume consume) {
+        std::array<std::optional<std::pair<ConstDataset, MutableDataset>>, batch_pipeline_n_slots> chunks;
+        std::vector<CalculationInfo> infos;
+        std::string combined_error_message;
+        IdxVector failed_scenarios;
+        std::vector<std::string> err_msgs;
+
+        run_batch_pipeline(
+            n_scenarios, chunk_size,
+            [&produce, &chunks](Idx slot, Idx begin, Idx end) { chunks[slot].emplace(produce(slot, begin, end)); },
+            [this, &options, &chunks, &infos, &combined_error_message, &failed_scenarios,
+             &err_msgs](Idx slot, Idx begin, Idx end) {
+                auto const& [update_data, result_data] = *chunks[slot];
+                if (update_data.batch_size() != end - begin || result_data.batch_size() != end - begin) {
+                    throw DatasetError{"The batch size of the update and result data of a chunk should be equal to "
+                                       "the number of scenarios in the chunk!\n"};
+                }
+                try {
+                    calculate(options, result_data, update_data);
+                } catch (BatchCalculationError const& e) {
+                    for (Idx idx = 0; idx != static_cast<Idx>(e.failed_scenarios().size()); ++idx) {
+                        Idx const scenario = begin + e.failed_scenarios()[idx];
+                        combined_error_message +=
+                            "Error in batch #" + std::to_string(scenario) + ": " + e.err_msgs()[idx];
+                        failed_scenarios.push_back(scenario);
+                        err_msgs.push_back(e.err_msgs()[idx]);
+                    }
+                }
+                infos.insert(infos.end(), scenario_calculation_info_.cbegin(), scenario_calculation_info_.cend());
             },
-            result_data, update_data, options.threading);
+            [&consume, &chunks](Idx slot, Idx begin, Idx end) {
+                consume(slot, begin, end);
+                chunks[slot].reset();
+            });
+
+        calculation_info_ = main_core::merge_calculation_info(infos);
+        scenario_calculation_info_ = std::move(infos);
+        if (!combined_error_message.empty()) {
+            throw BatchCalculationError(combined_error_message, std::move(failed_scenarios), std::move(err_msgs));
+        }
     }
 
     CalculationInfo calculation_info() const { return calculation_info_; }
+    // profile of each scenario of the last calculation
+    std::vector<CalculationInfo> const& scenario_calculation_info() const { return scenario_calculation_info_; }
 
     void check_no_experimental_features_used(Options const& options) const {
         if (options.calculation_type == CalculationType::state_estimation &&
@@ -828,9 +1343,19 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             };
 
             if (result_data.is_columnar(CT::name)) {
+                // a columnar buffer without any attribute buffer requests no output of this component
+                if (!result_data.is_columnar(CT::name, true)) {
+                    return;
+                }
                 auto const span =
                     result_data.get_columnar_buffer_span<typename output_type_getter<SolverOutputType>::type, CT>(pos);
-                process_output_span(span);
+                if (std::empty(span)) {
+                    return;
+                }
+                // the rows are produced block by block, and only the requested attributes are written column-wise
+                typename std::remove_cvref_t<decltype(span)>::BlockWriter writer{span};
+                this->output_result<CT>(math_output, writer.begin());
+                writer.flush();
             } else {
                 auto const span =
                     result_data.get_buffer_span<typename output_type_getter<SolverOutputType>::type, CT>(pos);
@@ -838,16 +1363,20 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             }
         };
 
-        Timer const t_output(calculation_info_, 3000, "Produce output");
+        Timer const t_output(calculation_info_, LogEvent::produce_output);
         main_core::utils::run_functor_with_all_types_return_void<ComponentType...>(output_func);
     }
 
     mutable CalculationInfo calculation_info_; // needs to be first due to padding override
                                                // may be changed in const functions for metrics
 
+    std::vector<CalculationInfo> scenario_calculation_info_;
+
     double system_frequency_;
     meta_data::MetaData const* meta_data_;
     MathSolverDispatcher const* math_solver_dispatcher_;
+    Idx construction_threading_{sequential};
+    SparseOrderingMethod sparse_ordering_{SparseOrderingMethod::minimum_degree};
 
     MainModelState state_;
     // math model
@@ -858,6 +1387,8 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     bool is_asym_parameter_up_to_date_{false};
     bool is_accumulated_component_updated_{true};
     bool last_updated_calculation_symmetry_mode_{false};
+    // ranking of the regulated transformers for the automatic tap changing, shared by the copies of this model
+    optimizer::tap_position_optimizer::RegulatorOrderCache regulator_order_;
 
     OwnedUpdateDataset cached_inverse_update_{};
     UpdateChange cached_state_changes_{};
@@ -923,7 +1454,9 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
                        state_.components.template citer<Source>().end(), comp_conn.source_connected.begin(),
                        [](Source const& source) { return source.status(); });
         // re build
-        Topology topology{*state_.comp_topo, comp_conn};
+        Topology topology{*state_.comp_topo, comp_conn, sparse_ordering_};
+        topology.set_n_threads(
+            get_n_threads(static_cast<Idx>(state_.comp_topo->source_node_idx.size()), construction_threading_));
         std::tie(state_.math_topology, state_.topo_comp_coup) = topology.build_topology();
         n_math_solvers_ = static_cast<Idx>(state_.math_topology.size());
         is_topology_up_to_date_ = true;
@@ -931,7 +1464,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         is_asym_parameter_up_to_date_ = false;
     }
 
-    template <symmetry_tag sym> std::vector<MathModelParam<sym>> get_math_param() {
+    template <symmetry_tag sym> std::vector<MathModelParam<sym>> get_math_param() const {
         std::vector<MathModelParam<sym>> math_param(n_math_solvers_);
         for (Idx i = 0; i != n_math_solvers_; ++i) {
             math_param[i].branch_param.resize(state_.math_topology[i]->n_branch());
@@ -1035,6 +1568,75 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
 
         return math_param_increment;
     }
+    // update the parameters of the current y bus in place, recalculating only those of the changed components
+    //    the cost of recalculation is proportional to the number of changed components instead of to the grid size,
+    //    e.g. for a tap change of the automatic tap changing
+    template <symmetry_tag sym> void update_changed_math_param() {
+        using MathParamRefs = std::vector<std::reference_wrapper<MathModelParam<sym>>>;
+        using UpdateMathParam = void (*)(MathParamRefs const&, MainModelState const&, Idx2D const&);
+
+        static constexpr std::array<UpdateMathParam, main_core::utils::n_types<ComponentType...>> update_math_params{
+            [](MathParamRefs const& math_param, MainModelState const& state, Idx2D const& changed_component_idx) {
+                if constexpr (std::derived_from<ComponentType, Branch>) {
+                    Idx2D const math_idx =
+                        state.topo_comp_coup
+                            ->branch[main_core::get_component_sequence_idx<Branch>(state, changed_component_idx)];
+                    if (math_idx.group == isolated_component) {
+                        return;
+                    }
+                    math_param[math_idx.group].get().branch_param[math_idx.pos] =
+                        main_core::get_component<ComponentType>(state, changed_component_idx)
+                            .template calc_param<sym>();
+                } else if constexpr (std::derived_from<ComponentType, Branch3>) {
+                    Idx2DBranch3 const math_idx =
+                        state.topo_comp_coup
+                            ->branch3[main_core::get_component_sequence_idx<Branch3>(state, changed_component_idx)];
+                    if (math_idx.group == isolated_component) {
+                        return;
+                    }
+                    auto const branch3_param =
+                        main_core::get_component<ComponentType>(state, changed_component_idx)
+                            .template calc_param<sym>();
+                    for (size_t branch2 = 0; branch2 < 3; ++branch2) {
+                        math_param[math_idx.group].get().branch_param[math_idx.pos[branch2]] = branch3_param[branch2];
+                    }
+                } else if constexpr (std::same_as<ComponentType, Shunt>) {
+                    Idx2D const math_idx =
+                        state.topo_comp_coup
+                            ->shunt[main_core::get_component_sequence_idx<Shunt>(state, changed_component_idx)];
+                    if (math_idx.group == isolated_component) {
+                        return;
+                    }
+                    math_param[math_idx.group].get().shunt_param[math_idx.pos] =
+                        main_core::get_component<Shunt>(state, changed_component_idx).template calc_param<sym>();
+                } else if constexpr (std::same_as<ComponentType, Source>) {
+                    Idx2D const math_idx =
+                        state.topo_comp_coup
+                            ->source[main_core::get_component_sequence_idx<Source>(state, changed_component_idx)];
+                    if (math_idx.group == isolated_component) {
+                        return;
+                    }
+                    math_param[math_idx.group].get().source_param[math_idx.pos] =
+                        main_core::get_component<Source>(state, changed_component_idx).template math_param<sym>();
+                }
+            }...};
+
+        std::vector<YBus<sym>>& y_bus_vec = get_y_bus<sym>();
+        assert(std::ssize(y_bus_vec) == n_math_solvers_);
+
+        MathParamRefs math_param;
+        math_param.reserve(n_math_solvers_);
+        std::ranges::transform(y_bus_vec, std::back_inserter(math_param),
+                               [](YBus<sym>& y_bus) { return std::ref(y_bus.math_model_param_to_update()); });
+
+        for (size_t i = 0; i < main_core::utils::n_types<ComponentType...>; ++i) {
+            auto const& changed_type_components = parameter_changed_components_[i];
+            auto const& update_type_math_param = update_math_params[i];
+            for (auto const& changed_component : changed_type_components) {
+                update_type_math_param(math_param, state_, changed_component);
+            }
+        }
+    }
 
     /** This is a heavily templated member function because it operates on many different variables of many
      *different types, but the essence is ever the same: filling one member (vector) of the calculation calc_input
@@ -1140,7 +1742,8 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     }
 
     template <symmetry_tag sym>
-    static std::vector<PowerFlowInput<sym>> prepare_power_flow_input(MainModelState const& state, Idx n_math_solvers) {
+    static std::vector<PowerFlowInput<sym>> prepare_power_flow_input(MainModelState const& state, Idx n_math_solvers,
+                                                                     bool flat_start = false) {
         std::vector<PowerFlowInput<sym>> pf_input(n_math_solvers);
         for (Idx i = 0; i != n_math_solvers; ++i) {
             pf_input[i].s_injection.resize(state.math_topology[i]->n_load_gen());
@@ -1152,6 +1755,18 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         prepare_input<PowerFlowInput<sym>, ComplexValue<sym>, &PowerFlowInput<sym>::s_injection, GenericLoadGen>(
             state, state.topo_comp_coup->load_gen, pf_input);
 
+        // the initial voltages are only passed if any node specifies one and the calculation does not start flat
+        auto const nodes = state.components.template citer<Node>();
+        if (!flat_start &&
+            std::ranges::any_of(nodes, [](Node const& node) { return !is_nan(node.calc_param<symmetric_t>()); })) {
+            for (Idx i = 0; i != n_math_solvers; ++i) {
+                pf_input[i].u_init.resize(state.math_topology[i]->n_bus(),
+                                          ComplexValue<sym>{DoubleComplex{nan, nan}});
+            }
+            prepare_input<PowerFlowInput<sym>, ComplexValue<sym>, &PowerFlowInput<sym>::u_init, Node>(
+                state, state.topo_comp_coup->node, pf_input);
+        }
+
         return pf_input;
     }
 
@@ -1241,13 +1856,14 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     template <symmetry_tag sym>
     std::vector<ShortCircuitInput> prepare_short_circuit_input(ShortCircuitVoltageScaling voltage_scaling) {
         // TODO(mgovers) split component mapping from actual preparing
+        auto const& components = state_.components;
         std::vector<IdxVector> topo_fault_indices(state_.math_topology.size());
         std::vector<IdxVector> topo_bus_indices(state_.math_topology.size());
 
-        for (Idx fault_idx{0}; fault_idx < state_.components.template size<Fault>(); ++fault_idx) {
-            auto const& fault = state_.components.template get_item_by_seq<Fault>(fault_idx);
+        for (Idx fault_idx{0}; fault_idx < components.template size<Fault>(); ++fault_idx) {
+            auto const& fault = components.template get_item_by_seq<Fault>(fault_idx);
             if (fault.status()) {
-                auto const node_idx = state_.components.template get_seq<Node>(fault.get_fault_object());
+                auto const node_idx = components.template get_seq<Node>(fault.get_fault_object());
                 auto const topo_bus_idx = state_.topo_comp_coup->node[node_idx];
 
                 if (topo_bus_idx.group >= 0) { // Consider non-isolated objects only
@@ -1257,7 +1873,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             }
         }
 
-        auto fault_coup = std::vector<Idx2D>(state_.components.template size<Fault>(),
+        auto fault_coup = std::vector<Idx2D>(components.template size<Fault>(),
                                              Idx2D{.group = isolated_component, .pos = not_connected});
         std::vector<ShortCircuitInput> sc_input(n_math_solvers_);
 
@@ -1269,19 +1885,19 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             }
 
             sc_input[i].fault_buses = {from_dense, std::move(map.indvector), state_.math_topology[i]->n_bus()};
-            sc_input[i].faults.resize(state_.components.template size<Fault>());
+            sc_input[i].faults.resize(components.template size<Fault>());
             sc_input[i].source.resize(state_.math_topology[i]->n_source());
         }
 
         state_.comp_coup = ComponentToMathCoupling{.fault = std::move(fault_coup)};
 
         prepare_input<ShortCircuitInput, FaultCalcParam, &ShortCircuitInput::faults, Fault>(
-            state_, state_.comp_coup.fault, sc_input, [this](Fault const& fault) {
-                return state_.components.template get_item<Node>(fault.get_fault_object()).u_rated();
+            state_, state_.comp_coup.fault, sc_input, [&components](Fault const& fault) {
+                return components.template get_item<Node>(fault.get_fault_object()).u_rated();
             });
         prepare_input<ShortCircuitInput, DoubleComplex, &ShortCircuitInput::source, Source>(
-            state_, state_.topo_comp_coup->source, sc_input, [this, voltage_scaling](Source const& source) {
-                return std::pair{state_.components.template get_item<Node>(source.node()).u_rated(), voltage_scaling};
+            state_, state_.topo_comp_coup->source, sc_input, [&components, voltage_scaling](Source const& source) {
+                return std::pair{components.template get_item<Node>(source.node()).u_rated(), voltage_scaling};
             });
 
         return sc_input;
@@ -1342,19 +1958,14 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             std::ranges::transform(state_.math_topology, std::back_inserter(solvers), [this](auto const& math_topo) {
                 return MathSolverProxy<sym>{math_solver_dispatcher_, math_topo};
             });
-            for (Idx idx = 0; idx < n_math_solvers_; ++idx) {
-                get_y_bus<sym>()[idx].register_parameters_changed_callback(
-                    [solver = std::ref(solvers[idx])](bool changed) {
-                        solver.get().get().parameters_changed(changed);
-                    });
-            }
+            main_core::register_parameters_changed_callbacks(get_y_bus<sym>(), solvers);
         } else if (!is_parameter_up_to_date<sym>()) {
-            std::vector<MathModelParam<sym>> const math_params = get_math_param<sym>();
-            std::vector<MathModelParamIncrement> const math_param_increments = get_math_param_increment<sym>();
             if (last_updated_calculation_symmetry_mode_ == is_symmetric_v<sym>) {
-                main_core::update_y_bus(math_state_, math_params, math_param_increments);
+                // only the components changed since the last calculation of this symmetry need new parameters
+                update_changed_math_param<sym>();
+                main_core::update_y_bus<sym>(math_state_, get_math_param_increment<sym>());
             } else {
-                main_core::update_y_bus(math_state_, math_params);
+                main_core::update_y_bus(math_state_, get_math_param<sym>());
             }
         }
         // else do nothing, set everything up to date
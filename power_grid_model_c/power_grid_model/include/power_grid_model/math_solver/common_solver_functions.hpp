@@ -10,6 +10,9 @@
 #include "../calculation_parameters.hpp"
 #include "../common/exception.hpp"
 
+#include <cassert>
+#include <concepts>
+
 namespace power_grid_model::math_solver::detail {
 
 template <symmetry_tag sym>
@@ -47,6 +50,73 @@ inline void prepare_linear_matrix_and_rhs(YBus<sym> const& y_bus, PowerFlowInput
     }
 }
 
+// current injected by a load/gen at the bus voltage, according to its type
+template <symmetry_tag sym>
+inline ComplexValue<sym> load_gen_current(ComplexValue<sym> const& s_injection, LoadGenType type,
+                                          ComplexValue<sym> const& u) {
+    switch (type) {
+        using enum LoadGenType;
+
+    case const_pq:
+        // I_inj_i = conj(S_inj_j/U_i) for constant PQ type
+        return conj(s_injection / u);
+    case const_y:
+        // I_inj_i = conj((S_inj_j * abs(U_i)^2) / U_i) = conj((S_inj_j) * U_i for const impedance type
+        return conj(s_injection) * u;
+    case const_i:
+        // I_inj_i = conj(S_inj_j*abs(U_i)/U_i) for const current type
+        return conj(s_injection * cabs(u) / u);
+    default:
+        throw MissingCaseForEnumError("Injection current calculation", type);
+    }
+}
+
+// flat start: the averaged u_ref of all sources, with the phase shift of each bus
+template <symmetry_tag sym>
+inline void make_flat_start(PowerFlowInput<sym> const& input, DenseGroupedIdxVector const& sources_per_bus,
+                            DoubleVector const& phase_shift, ComplexValueVector<sym>& output_u) {
+    // average u_ref of all sources
+    DoubleComplex const u_ref = [&]() {
+        DoubleComplex sum_u_ref = 0.0;
+        for (auto const& [bus, sources] : enumerated_zip_sequence(sources_per_bus)) {
+            for (Idx const source : sources) {
+                sum_u_ref += input.source[source] * std::exp(1.0i * -phase_shift[bus]); // offset phase shift
+            }
+        }
+        return sum_u_ref / static_cast<double>(input.source.size());
+    }();
+
+    // assign u_ref as flat start
+    for (Idx i = 0; i != static_cast<Idx>(output_u.size()); ++i) {
+        // consider phase shift
+        output_u[i] = ComplexValue<sym>{u_ref * std::exp(1.0i * phase_shift[i])};
+    }
+}
+
+// solve the right hand sides of a panel of n_rhs calculations with the same pre-factorized matrix
+//    column(k) is the vector of calculation k, which contains the right hand side on entry and the solution on exit
+//    see SparseLUSolver::solve_panel_with_prefactorized_matrix
+template <symmetry_tag sym, typename SparseSolver, std::invocable<Idx> ColumnFn>
+inline void solve_panel(SparseSolver& sparse_solver, ComplexTensorVector<sym> const& lu_matrix,
+                        typename SparseSolver::BlockPermArray const& perm, Idx n_rhs, ColumnFn const& column) {
+    assert(n_rhs > 0);
+    Idx const n_bus = static_cast<Idx>(column(0).size());
+    ComplexValueVector<sym> panel(n_bus * n_rhs);
+    for (Idx k = 0; k != n_rhs; ++k) {
+        ComplexValueVector<sym> const& rhs = column(k);
+        for (Idx bus = 0; bus != n_bus; ++bus) {
+            panel[bus * n_rhs + k] = rhs[bus];
+        }
+    }
+    sparse_solver.solve_panel_with_prefactorized_matrix(lu_matrix, perm, panel, panel, n_rhs);
+    for (Idx k = 0; k != n_rhs; ++k) {
+        ComplexValueVector<sym>& x = column(k);
+        for (Idx bus = 0; bus != n_bus; ++bus) {
+            x[bus] = panel[bus * n_rhs + k];
+        }
+    }
+}
+
 template <symmetry_tag sym> inline void copy_y_bus(YBus<sym> const& y_bus, ComplexTensorVector<sym>& mat_data) {
     ComplexTensorVector<sym> const& ydata = y_bus.admittance();
     std::transform(y_bus.map_lu_y_bus().cbegin(), y_bus.map_lu_y_bus().cend(), mat_data.begin(), [&](Idx k) {
@@ -0,0 +1,256 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+/*
+Fast Decoupled Power Flow
+
+Description:
+    Newton-Raphson with the Jacobian replaced by two constant real matrices.
+    If the X/R ratio of the branches is high and the angle differences are small,
+    the active power mainly depends on the angles and the reactive power on the magnitudes:
+        dP / V = B' * dtheta
+        dQ / V = B'' * dV
+    B' and B'' only depend on the admittance matrix, so they are factorized once per topology and parameter set.
+    Every iteration only needs the power mismatch and forward and backward substitutions.
+
+    Only symmetric calculations are supported: in the phase domain, the mutual coupling between the phases
+    (120 degrees apart) does not decouple.
+
+Matrices:
+    The angles are relative to the flat start, i.e. the phase shift of the transformers is rotated out of the
+    admittance matrix:
+        Y'_ij = Y_ij * exp(1j * (phase_shift_j - phase_shift_i))
+    B'' = -imag(Y'), including the source admittances
+    B' = -imag(Y') without the shunts, i.e. the diagonal is the negative sum of the off-diagonal entries in the row,
+         plus the source admittances
+    The source admittance connects the bus to the fixed source voltage, so it is kept in both matrices.
+
+Steps:
+    Initialize U with averaged u_ref, ie source voltage and phase shifts accounted
+    Initialize solver
+    while maximum deviation > error tolerance
+        Calculate the power mismatch dS = U * conj(I_inj - Y * U) with U of previous iteration
+        Solve B' * dtheta = dP / V using prefactorization, update the angles
+        Calculate the power mismatch with the updated angles
+        Solve B'' * dV = dQ / V using prefactorization, update the magnitudes
+        Find maximum deviation in voltage buses U
+    Calculate output values from U result
+
+    Initialize solver:
+        Build and prefactorize B' and B'' if the parameters changed, ie y bus values changes
+        Only the pivots affected by the changed entries of B' and B'' are factorized again
+
+    Calculating Injected current:
+        I_inj is the current injected by the loads and sources, as in the iterative current method
+        Y * U includes the source admittance, the sources inject y_ref * u_ref
+
+Nomenclature:
+    I_inj : Injected current
+    S : Power
+    Y : Y bus matrix
+    U : Bus Voltage
+    V : Bus Voltage magnitude
+    theta : Bus Voltage angle
+*/
+
+#include "common_solver_functions.hpp"
+#include "iterative_pf_solver.hpp"
+#include "sparse_lu_solver.hpp"
+#include "y_bus.hpp"
+
+#include "../calculation_parameters.hpp"
+#include "../common/common.hpp"
+#include "../common/exception.hpp"
+#include "../common/three_phase_tensor.hpp"
+#include "../common/timer.hpp"
+
+namespace power_grid_model::math_solver {
+
+// hide implementation in inside namespace
+namespace fast_decoupled_pf {
+
+// solver
+template <symmetry_tag sym_type>
+    requires is_symmetric_v<sym_type>
+class FastDecoupledPFSolver : public IterativePFSolver<sym_type, FastDecoupledPFSolver<sym_type>> {
+  public:
+    using sym = sym_type;
+
+    using SparseSolverType = SparseLUSolver<double, double, double>;
+    using BlockPermArray = typename SparseSolverType::BlockPermArray;
+
+    static constexpr auto is_iterative = true;
+
+    FastDecoupledPFSolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> const& topo_ptr)
+        : IterativePFSolver<sym, FastDecoupledPFSolver>{y_bus, topo_ptr},
+          rotation_(y_bus.size()),
+          u_(y_bus.size()),
+          rhs_(y_bus.size()),
+          b_p_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu(),
+                      y_bus.shared_lu_symbolic()},
+          b_pp_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu(),
+                       y_bus.shared_lu_symbolic()} {
+        std::ranges::transform(*this->phase_shift_, rotation_.begin(),
+                               [](double phase_shift) { return std::exp(1.0i * phase_shift); });
+    }
+
+    // Build and prefactorize B' and B'' if the y bus changed
+    void initialize_derived_solver(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
+                                   SolverOutput<sym>& output, CalculationInfo& calculation_info) {
+        this->initialize_voltage(input, output.u, [this, &input, &output] {
+            detail::make_flat_start(input, *this->sources_per_bus_, *this->phase_shift_, output.u);
+        });
+
+        if (parameters_changed_) {
+            auto const [b_p_matrix, b_pp_matrix] = build_b_matrices(y_bus);
+            // reuse the previous factorizations, which may be shared with copies of this solver
+            DoubleVector b_p = b_p_ ? *b_p_ : DoubleVector{};
+            DoubleVector b_pp = b_pp_ ? *b_pp_ : DoubleVector{};
+            BlockPermArray perm_p(this->n_bus_);
+            BlockPermArray perm_pp(this->n_bus_);
+            b_p_solver_.refactorize(b_p_matrix, b_p_matrix_, b_p, perm_p);
+            b_pp_solver_.refactorize(b_pp_matrix, b_pp_matrix_, b_pp, perm_pp);
+            // move pre-factorized version into shared ptr
+            b_p_ = std::make_shared<DoubleVector const>(std::move(b_p));
+            b_pp_ = std::make_shared<DoubleVector const>(std::move(b_pp));
+            perm_p_ = std::make_shared<BlockPermArray const>(std::move(perm_p));
+            perm_pp_ = std::make_shared<BlockPermArray const>(std::move(perm_pp));
+        }
+        parameters_changed_ = false;
+        b_p_solver_.log_factorizations(calculation_info);
+        b_pp_solver_.log_factorizations(calculation_info);
+    }
+
+    // Calculate the active power mismatch of the previous iteration
+    //    the y bus and input are kept for the reactive power mismatch of the second half iteration
+    void prepare_matrix_and_rhs(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
+                                ComplexValueVector<sym> const& u) {
+        y_bus_ = &y_bus;
+        input_ = &input;
+        u_ = u;
+        calculate_mismatch(y_bus, input, [](DoubleComplex const& s) { return real(s); });
+    }
+
+    // Solve the angle correction, then update the reactive power mismatch and solve the magnitude correction
+    void solve_matrix(CalculationInfo& /* calculation_info */) {
+        b_p_solver_.solve_with_prefactorized_matrix(*b_p_, *perm_p_, rhs_, rhs_);
+        for (Idx bus_number = 0; bus_number != this->n_bus_; ++bus_number) {
+            u_[bus_number] = u_[bus_number] * exp(1.0i * rhs_[bus_number]);
+        }
+
+        calculate_mismatch(*y_bus_, *input_, [](DoubleComplex const& s) { return imag(s); });
+        b_pp_solver_.solve_with_prefactorized_matrix(*b_pp_, *perm_pp_, rhs_, rhs_);
+        for (Idx bus_number = 0; bus_number != this->n_bus_; ++bus_number) {
+            double const v = cabs(u_[bus_number]);
+            u_[bus_number] = u_[bus_number] * ((v + rhs_[bus_number]) / v);
+        }
+    }
+
+    // Find maximum deviation in voltage among all buses
+    double iterate_unknown(ComplexValueVector<sym>& u) {
+        double max_dev = 0.0;
+        // loop all buses
+        for (Idx bus_number = 0; bus_number != this->n_bus_; ++bus_number) {
+            // Get maximum iteration for a bus
+            double const dev = max_val(cabs(u_[bus_number] - u[bus_number]));
+            // Keep maximum deviation of all buses, a diverged voltage has an infinite deviation
+            max_dev = std::isnan(dev) ? std::numeric_limits<double>::infinity() : std::max(dev, max_dev);
+            // assign updated values
+            u[bus_number] = u_[bus_number];
+        }
+        return max_dev;
+    }
+
+    void parameters_changed(bool changed) { parameters_changed_ = parameters_changed_ || changed; }
+
+    void set_sparse_solver_threads(Idx n_threads) {
+        b_p_solver_.set_n_threads(n_threads);
+        b_pp_solver_.set_n_threads(n_threads);
+    }
+
+  private:
+    ComplexVector rotation_;
+    ComplexVector u_;
+    DoubleVector rhs_;
+    // pre-factorized B' and B''
+    SparseSolverType b_p_solver_;
+    SparseSolverType b_pp_solver_;
+    std::shared_ptr<DoubleVector const> b_p_;
+    std::shared_ptr<DoubleVector const> b_pp_;
+    // the matrices of the factorizations in b_p_ and b_pp_
+    DoubleVector b_p_matrix_;
+    DoubleVector b_pp_matrix_;
+    std::shared_ptr<BlockPermArray const> perm_p_;
+    std::shared_ptr<BlockPermArray const> perm_pp_;
+    bool parameters_changed_ = true;
+    // only valid during an iteration
+    YBus<sym> const* y_bus_{};
+    PowerFlowInput<sym> const* input_{};
+
+    std::pair<DoubleVector, DoubleVector> build_b_matrices(YBus<sym> const& y_bus) const {
+        ComplexVector y_data(y_bus.nnz_lu());
+        detail::copy_y_bus<sym>(y_bus, y_data);
+
+        IdxVector const& row_indptr = y_bus.row_indptr_lu();
+        IdxVector const& col_indices = y_bus.col_indices_lu();
+        IdxVector const& bus_entry = y_bus.lu_diag();
+
+        DoubleVector b_p(y_bus.nnz_lu());
+        DoubleVector b_pp(y_bus.nnz_lu());
+        for (Idx row = 0; row != this->n_bus_; ++row) {
+            double off_diagonal_sum{};
+            for (Idx entry = row_indptr[row]; entry != row_indptr[row + 1]; ++entry) {
+                Idx const col = col_indices[entry];
+                b_pp[entry] = -imag(y_data[entry] * conj(rotation_[row]) * rotation_[col]);
+                if (col != row) {
+                    b_p[entry] = b_pp[entry];
+                    off_diagonal_sum += b_pp[entry];
+                }
+            }
+            b_p[bus_entry[row]] = -off_diagonal_sum;
+        }
+
+        auto const& source_param = y_bus.math_model_param().source_param;
+        for (auto const& [bus_number, sources] : enumerated_zip_sequence(*this->sources_per_bus_)) {
+            for (Idx const source_number : sources) {
+                DoubleComplex const y_ref = source_param[source_number].template y_ref<sym>();
+                b_p[bus_entry[bus_number]] -= imag(y_ref);
+                b_pp[bus_entry[bus_number]] -= imag(y_ref);
+            }
+        }
+        return {std::move(b_p), std::move(b_pp)};
+    }
+
+    // rhs = part(dS) / V, with dS = U * conj(I_inj - Y * U)
+    template <typename PartFunc>
+    void calculate_mismatch(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input, PartFunc const& part) {
+        std::vector<LoadGenType> const& load_gen_type = *this->load_gen_type_;
+        auto const& source_param = y_bus.math_model_param().source_param;
+        for (auto const& [bus_number, load_gens, sources] :
+             enumerated_zip_sequence(*this->load_gens_per_bus_, *this->sources_per_bus_)) {
+            DoubleComplex const& u = u_[bus_number];
+            DoubleComplex i_mismatch{0.0};
+            for (Idx const load_number : load_gens) {
+                i_mismatch +=
+                    detail::load_gen_current<sym>(input.s_injection[load_number], load_gen_type[load_number], u);
+            }
+            for (Idx const source_number : sources) {
+                DoubleComplex const y_ref = source_param[source_number].template y_ref<sym>();
+                i_mismatch += y_ref * (input.source[source_number] - u);
+            }
+            for (Idx entry = y_bus.row_indptr()[bus_number]; entry != y_bus.row_indptr()[bus_number + 1]; ++entry) {
+                i_mismatch -= y_bus.admittance()[entry] * u_[y_bus.col_indices()[entry]];
+            }
+            rhs_[bus_number] = part(u * conj(i_mismatch)) / cabs(u);
+        }
+    }
+};
+
+} // namespace fast_decoupled_pf
+
+using fast_decoupled_pf::FastDecoupledPFSolver;
+
+} // namespace power_grid_model::math_solver
@@ -17,6 +17,7 @@ Prefactorization:
     If the Y bus matrix does not change, then there is no need for factorizing it again to solve linear equations.
     Hence it is done only once in the first iteration and same result is used in subsequent iterations.
     Same factorization is also used in subsequent batches
+    If the Y bus matrix changes in a few entries, only the pivots affected by the change are factorized again
 
 Steps:
     Initialize U with averaged u_ref, ie source voltage and phase shifts accounted
@@ -64,6 +65,8 @@ Nomenclature:
 #include "../common/three_phase_tensor.hpp"
 #include "../common/timer.hpp"
 
+#include <span>
+
 namespace power_grid_model::math_solver {
 
 // hide implementation in inside namespace
@@ -83,12 +86,15 @@ class IterativeCurrentPFSolver : public IterativePFSolver<sym_type, IterativeCur
     IterativeCurrentPFSolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> const& topo_ptr)
         : IterativePFSolver<sym, IterativeCurrentPFSolver>{y_bus, topo_ptr},
           rhs_u_(y_bus.size()),
-          sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()} {}
+          sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu(),
+                         y_bus.shared_lu_symbolic()} {}
 
     // Add source admittance to Y bus and set variable for prepared y bus to true
     void initialize_derived_solver(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
-                                   SolverOutput<sym>& output) {
-        make_flat_start(input, output.u);
+                                   SolverOutput<sym>& output, CalculationInfo& calculation_info) {
+        this->initialize_voltage(input, output.u, [this, &input, &output] {
+            detail::make_flat_start(input, *this->sources_per_bus_, *this->phase_shift_, output.u);
+        });
 
         auto const& sources_per_bus = *this->sources_per_bus_;
         IdxVector const& bus_entry = y_bus.lu_diag();
@@ -106,14 +112,16 @@ class IterativeCurrentPFSolver : public IterativePFSolver<sym_type, IterativeCur
                         y_bus.math_model_param().source_param[source_number].template y_ref<sym>();
                 }
             }
-            // prefactorize
-            BlockPermArray perm(this->n_bus_);
-            sparse_solver_.prefactorize(mat_data, perm);
+            // prefactorize, reusing the previous factorization which may be shared with copies of this solver
+            ComplexTensorVector<sym> lu_matrix = mat_data_ ? *mat_data_ : ComplexTensorVector<sym>{};
+            BlockPermArray perm = perm_ ? *perm_ : BlockPermArray(this->n_bus_);
+            sparse_solver_.refactorize(mat_data, matrix_, lu_matrix, perm);
             // move pre-factorized version into shared ptr
-            mat_data_ = std::make_shared<ComplexTensorVector<sym> const>(std::move(mat_data));
+            mat_data_ = std::make_shared<ComplexTensorVector<sym> const>(std::move(lu_matrix));
             perm_ = std::make_shared<BlockPermArray const>(std::move(perm));
         }
         parameters_changed_ = false;
+        sparse_solver_.log_factorizations(calculation_info);
     }
 
     // Prepare matrix calculates injected current ie. RHS of solver for each iteration.
@@ -134,7 +142,9 @@ class IterativeCurrentPFSolver : public IterativePFSolver<sym_type, IterativeCur
 
     // Solve the linear equations I_inj = YU
     // inplace
-    void solve_matrix() { sparse_solver_.solve_with_prefactorized_matrix(*mat_data_, *perm_, rhs_u_, rhs_u_); }
+    void solve_matrix(CalculationInfo& /* calculation_info */) {
+        sparse_solver_.solve_with_prefactorized_matrix(*mat_data_, *perm_, rhs_u_, rhs_u_);
+    }
 
     // Find maximum deviation in voltage among all buses
     double iterate_unknown(ComplexValueVector<sym>& u) {
@@ -151,10 +161,58 @@ class IterativeCurrentPFSolver : public IterativePFSolver<sym_type, IterativeCur
         return max_dev;
     }
 
+    // one iteration for a panel of inputs, as in the linear current method
+    //    the matrix does not depend on the input, so the right hand sides of all inputs are solved together
+    //    the output of each input is the same as with run_power_flow with one iteration and without warm start
+    std::vector<SolverOutput<sym>> run_linear_current_panel(YBus<sym> const& y_bus,
+                                                            std::span<PowerFlowInput<sym> const> inputs,
+                                                            CalculationInfo& calculation_info) {
+        Idx const n_inputs = std::ssize(inputs);
+        std::vector<SolverOutput<sym>> outputs(n_inputs);
+        // right hand side of each input, solved in place
+        std::vector<ComplexValueVector<sym>> rhs(n_inputs);
+
+        Timer main_timer{calculation_info, LogEvent::math_solver};
+        for (Idx idx = 0; idx != n_inputs; ++idx) {
+            outputs[idx].u.resize(this->n_bus_);
+            {
+                Timer const sub_timer{calculation_info, LogEvent::initialize_calculation};
+                initialize_derived_solver(y_bus, inputs[idx], outputs[idx], calculation_info);
+            }
+            Timer const sub_timer{calculation_info, LogEvent::prepare_matrices};
+            prepare_matrix_and_rhs(y_bus, inputs[idx], outputs[idx].u);
+            rhs[idx] = rhs_u_;
+        }
+        if (n_inputs > 0) {
+            Timer const sub_timer{calculation_info, LogEvent::solve_sparse_linear_equation};
+            detail::solve_panel<sym>(sparse_solver_, *mat_data_, *perm_, n_inputs,
+                                     [&rhs](Idx k) -> auto& { return rhs[k]; });
+        }
+        {
+            Timer const sub_timer{calculation_info, LogEvent::calculate_math_result};
+            for (Idx idx = 0; idx != n_inputs; ++idx) {
+                outputs[idx].u = std::move(rhs[idx]);
+                this->calculate_result(y_bus, inputs[idx], outputs[idx]);
+            }
+        }
+        // Manually stop timers to avoid the iteration statistics to be included in the timing.
+        main_timer.stop();
+
+        for (Idx idx = 0; idx != n_inputs; ++idx) {
+            calculation_info.add(LogEvent::iterations, 1.0);
+            calculation_info.add(LogEvent::max_num_iter, 1.0);
+        }
+        return outputs;
+    }
+
     void parameters_changed(bool changed) { parameters_changed_ = parameters_changed_ || changed; }
 
+    void set_sparse_solver_threads(Idx n_threads) { sparse_solver_.set_n_threads(n_threads); }
+
   private:
     ComplexValueVector<sym> rhs_u_;
+    // the matrix of the factorization in mat_data_
+    ComplexTensorVector<sym> matrix_;
     std::shared_ptr<ComplexTensorVector<sym> const> mat_data_;
     // sparse solver
     SparseSolverType sparse_solver_;
@@ -164,26 +222,8 @@ class IterativeCurrentPFSolver : public IterativePFSolver<sym_type, IterativeCur
     void add_loads(IdxRange const& load_gens, Idx bus_number, PowerFlowInput<sym> const& input,
                    std::vector<LoadGenType> const& load_gen_type, ComplexValueVector<sym> const& u) {
         for (Idx const load_number : load_gens) {
-            // load type
-            LoadGenType const type = load_gen_type[load_number];
-            switch (type) {
-                using enum LoadGenType;
-
-            case const_pq:
-                // I_inj_i = conj(S_inj_j/U_i) for constant PQ type
-                rhs_u_[bus_number] += conj(input.s_injection[load_number] / u[bus_number]);
-                break;
-            case const_y:
-                // I_inj_i = conj((S_inj_j * abs(U_i)^2) / U_i) = conj((S_inj_j) * U_i for const impedance type
-                rhs_u_[bus_number] += conj(input.s_injection[load_number]) * u[bus_number];
-                break;
-            case const_i:
-                // I_inj_i = conj(S_inj_j*abs(U_i)/U_i) for const current type
-                rhs_u_[bus_number] += conj(input.s_injection[load_number] * cabs(u[bus_number]) / u[bus_number]);
-                break;
-            default:
-                throw MissingCaseForEnumError("Injection current calculation", type);
-            }
+            rhs_u_[bus_number] += detail::load_gen_current<sym>(input.s_injection[load_number],
+                                                                load_gen_type[load_number], u[bus_number]);
         }
     }
 
@@ -195,26 +235,6 @@ class IterativeCurrentPFSolver : public IterativePFSolver<sym_type, IterativeCur
                                       ComplexValue<sym>{input.source[source_number]});
         }
     }
-
-    void make_flat_start(PowerFlowInput<sym> const& input, ComplexValueVector<sym>& output_u) {
-        std::vector<double> const& phase_shift = *this->phase_shift_;
-        // average u_ref of all sources
-        DoubleComplex const u_ref = [&]() {
-            DoubleComplex sum_u_ref = 0.0;
-            for (auto const& [bus, sources] : enumerated_zip_sequence(*this->sources_per_bus_)) {
-                for (Idx const source : sources) {
-                    sum_u_ref += input.source[source] * std::exp(1.0i * -phase_shift[bus]); // offset phase shift
-                }
-            }
-            return sum_u_ref / static_cast<double>(input.source.size());
-        }();
-
-        // assign u_ref as flat start
-        for (Idx i = 0; i != this->n_bus_; ++i) {
-            // consider phase shift
-            output_u[i] = ComplexValue<sym>{u_ref * std::exp(1.0i * phase_shift[i])};
-        }
-    }
 };
 
 } // namespace iterative_current_pf
@@ -79,7 +79,8 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
           math_topo_{std::move(topo_ptr)},
           data_gain_(y_bus.nnz_lu()),
           x_rhs_(y_bus.size()),
-          sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
+          sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu(),
+                         y_bus.shared_lu_symbolic()},
           perm_(y_bus.size()) {}
 
     SolverOutput<sym> run_state_estimation(YBus<sym> const& y_bus, StateEstimationInput<sym> const& input,
@@ -92,22 +93,22 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
         output.bus_injection.resize(n_bus_);
         double max_dev = std::numeric_limits<double>::max();
 
-        main_timer = Timer(calculation_info, 2220, "Math solver");
+        main_timer = Timer(calculation_info, LogEvent::math_solver);
 
         // preprocess measured value
-        sub_timer = Timer(calculation_info, 2221, "Pre-process measured value");
+        sub_timer = Timer(calculation_info, LogEvent::preprocess_measured_value);
         MeasuredValues<sym> const measured_values{y_bus.shared_topology(), input};
         auto const observability_result =
             necessary_observability_check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
 
         // prepare matrix
-        sub_timer = Timer(calculation_info, 2222, "Prepare matrix, including pre-factorization");
+        sub_timer = Timer(calculation_info, LogEvent::prepare_matrix_including_prefactorization);
         prepare_matrix(y_bus, measured_values);
-        // prefactorize
-        sparse_solver_.prefactorize(data_gain_, perm_, observability_result.use_perturbation());
+        // prefactorize, only the pivots affected by a change since the previous calculation are factorized again
+        sparse_solver_.refactorize(data_gain_, gain_matrix_, lu_gain_, perm_, observability_result.use_perturbation());
 
         // initialize voltage with initial angle
-        sub_timer = Timer(calculation_info, 2223, "Initialize voltages");
+        sub_timer = Timer(calculation_info, LogEvent::initialize_voltages);
         RealValue<sym> const mean_angle_shift = measured_values.mean_angle_shift();
         for (Idx bus = 0; bus != n_bus_; ++bus) {
             output.u[bus] = exp(1.0i * (mean_angle_shift + math_topo_->phase_shift[bus]));
@@ -119,29 +120,32 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
             if (num_iter++ == max_iter) {
                 throw IterationDiverge{max_iter, max_dev, err_tol};
             }
-            sub_timer = Timer(calculation_info, 2224, "Calculate rhs");
+            sub_timer = Timer(calculation_info, LogEvent::calculate_rhs);
             prepare_rhs(y_bus, measured_values, output.u);
             // solve with prefactorization
-            sub_timer = Timer(calculation_info, 2225, "Solve sparse linear equation (pre-factorized)");
-            sparse_solver_.solve_with_prefactorized_matrix(data_gain_, perm_, x_rhs_, x_rhs_);
-            sub_timer = Timer(calculation_info, 2226, "Iterate unknown");
+            sub_timer = Timer(calculation_info, LogEvent::solve_sparse_linear_equation_prefactorized);
+            sparse_solver_.solve_with_prefactorized_matrix(lu_gain_, perm_, x_rhs_, x_rhs_);
+            sub_timer = Timer(calculation_info, LogEvent::iterate_unknown_se);
             max_dev = iterate_unknown(output.u, measured_values.has_angle());
         };
 
         // calculate math result
-        sub_timer = Timer(calculation_info, 2227, "Calculate math result");
+        sub_timer = Timer(calculation_info, LogEvent::calculate_math_result_se);
         detail::calculate_se_result<sym>(y_bus, measured_values, output);
 
-        // Manually stop timers to avoid "Max number of iterations" to be included in the timing.
+        // Manually stop timers to avoid the iteration statistics to be included in the timing.
         sub_timer.stop();
         main_timer.stop();
 
-        auto const key = Timer::make_key(2228, "Max number of iterations");
-        calculation_info[key] = std::max(calculation_info[key], static_cast<double>(num_iter));
+        calculation_info.add(LogEvent::iterations, static_cast<double>(num_iter));
+        calculation_info.add(LogEvent::max_num_iter_se, static_cast<double>(num_iter));
+        sparse_solver_.log_factorizations(calculation_info);
 
         return output;
     }
 
+    void set_sparse_solver_threads(Idx n_threads) { sparse_solver_.set_n_threads(n_threads); }
+
   private:
     // array selection function pointer
     static constexpr std::array has_branch_power_{&MeasuredValues<sym>::has_branch_from_power,
@@ -159,6 +163,9 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
 
     // data for gain matrix
     std::vector<ILSEGainBlock<sym>> data_gain_;
+    // the gain matrix of the previous calculation and its factorization
+    std::vector<ILSEGainBlock<sym>> gain_matrix_;
+    std::vector<ILSEGainBlock<sym>> lu_gain_;
     // unknown and rhs
     std::vector<ILSERhs<sym>> x_rhs_;
     // solver
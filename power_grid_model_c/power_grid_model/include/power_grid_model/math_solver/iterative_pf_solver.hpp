@@ -27,20 +27,20 @@ template <symmetry_tag sym, typename DerivedSolver> class IterativePFSolver {
     SolverOutput<sym> run_power_flow(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input, double err_tol,
                                      Idx max_iter, CalculationInfo& calculation_info) {
         // get derived reference for derived solver class
-        auto derived_solver = static_cast<DerivedSolver&>(*this);
+        auto& derived_solver = static_cast<DerivedSolver&>(*this);
 
         // prepare
         SolverOutput<sym> output;
         output.u.resize(n_bus_);
         double max_dev = std::numeric_limits<double>::infinity();
 
-        Timer main_timer{calculation_info, 2220, "Math solver"};
+        Timer main_timer{calculation_info, LogEvent::math_solver};
 
         // initialize
         {
-            Timer const sub_timer{calculation_info, 2221, "Initialize calculation"};
+            Timer const sub_timer{calculation_info, LogEvent::initialize_calculation};
             // Further initialization specific to the derived solver
-            derived_solver.initialize_derived_solver(y_bus, input, output);
+            derived_solver.initialize_derived_solver(y_bus, input, output, calculation_info);
         }
 
         // start calculation
@@ -52,31 +52,35 @@ template <symmetry_tag sym, typename DerivedSolver> class IterativePFSolver {
             }
             {
                 // Prepare the matrices of linear equations to be solved
-                Timer const sub_timer{calculation_info, 2222, "Prepare the matrices"};
+                Timer const sub_timer{calculation_info, LogEvent::prepare_matrices};
                 derived_solver.prepare_matrix_and_rhs(y_bus, input, output.u);
             }
             {
                 // Solve the linear equations
-                Timer const sub_timer{calculation_info, 2223, "Solve sparse linear equation"};
-                derived_solver.solve_matrix();
+                Timer const sub_timer{calculation_info, LogEvent::solve_sparse_linear_equation};
+                derived_solver.solve_matrix(calculation_info);
             }
             {
                 // Calculate maximum deviation of voltage at any bus
-                Timer const sub_timer{calculation_info, 2224, "Iterate unknown"};
+                Timer const sub_timer{calculation_info, LogEvent::iterate_unknown};
                 max_dev = derived_solver.iterate_unknown(output.u);
             }
         }
 
+        if (warm_start_) {
+            warm_start_u_ = output.u;
+        }
+
         // calculate math result
         {
-            Timer const sub_timer{calculation_info, 2225, "Calculate math result"};
+            Timer const sub_timer{calculation_info, LogEvent::calculate_math_result};
             calculate_result(y_bus, input, output);
         }
-        // Manually stop timers to avoid "Max number of iterations" to be included in the timing.
+        // Manually stop timers to avoid the iteration statistics to be included in the timing.
         main_timer.stop();
 
-        auto const key = Timer::make_key(2226, "Max number of iterations");
-        calculation_info[key] = std::max(calculation_info[key], static_cast<double>(num_iter));
+        calculation_info.add(LogEvent::iterations, static_cast<double>(num_iter));
+        calculation_info.add(LogEvent::max_num_iter, static_cast<double>(num_iter));
 
         return output;
     }
@@ -86,8 +90,18 @@ template <symmetry_tag sym, typename DerivedSolver> class IterativePFSolver {
                                     [this](Idx i) { return (*load_gen_type_)[i]; });
     }
 
+    // start the next calculation from the voltages of the last converged calculation
+    void set_warm_start(bool warm_start) {
+        warm_start_ = warm_start;
+        if (!warm_start_) {
+            warm_start_u_.clear();
+        }
+    }
+
   private:
     Idx n_bus_;
+    bool warm_start_{false};
+    ComplexValueVector<sym> warm_start_u_;
     std::shared_ptr<DoubleVector const> phase_shift_;
     std::shared_ptr<SparseGroupedIdxVector const> load_gens_per_bus_;
     std::shared_ptr<DenseGroupedIdxVector const> sources_per_bus_;
@@ -98,6 +112,31 @@ template <symmetry_tag sym, typename DerivedSolver> class IterativePFSolver {
           load_gens_per_bus_{topo_ptr, &topo_ptr->load_gens_per_bus},
           sources_per_bus_{topo_ptr, &topo_ptr->sources_per_bus},
           load_gen_type_{topo_ptr, &topo_ptr->load_gen_type} {}
+
+    // Initialize the voltages with the specified initial voltages, or else the voltages of the last converged
+    // calculation if warm start is enabled.
+    // The default start voltage of the derived solver is only calculated if the voltage of any bus is still unknown.
+    template <std::invocable DefaultStartFn>
+    void initialize_voltage(PowerFlowInput<sym> const& input, ComplexValueVector<sym>& u,
+                            DefaultStartFn&& default_start) const {
+        auto const is_specified = [](ComplexValue<sym> const& u_init) { return !is_nan(real(u_init)); };
+        bool const has_warm_start = warm_start_u_.size() == static_cast<size_t>(n_bus_);
+        bool const has_u_init = !input.u_init.empty();
+
+        if (!has_warm_start && !(has_u_init && std::ranges::all_of(input.u_init, is_specified))) {
+            std::forward<DefaultStartFn>(default_start)();
+        }
+        if (!has_warm_start && !has_u_init) {
+            return;
+        }
+        for (Idx bus = 0; bus != n_bus_; ++bus) {
+            if (has_u_init && is_specified(input.u_init[bus])) {
+                u[bus] = input.u_init[bus];
+            } else if (has_warm_start) {
+                u[bus] = warm_start_u_[bus];
+            }
+        }
+    }
 };
 
 } // namespace power_grid_model::math_solver
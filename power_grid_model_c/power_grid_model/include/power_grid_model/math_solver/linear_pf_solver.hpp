@@ -39,6 +39,8 @@ if there are sources
 #include "../common/three_phase_tensor.hpp"
 #include "../common/timer.hpp"
 
+#include <span>
+
 namespace power_grid_model::math_solver {
 
 namespace linear_pf {
@@ -59,7 +61,8 @@ template <symmetry_tag sym_type> class LinearPFSolver {
           load_gens_per_bus_{topo_ptr, &topo_ptr->load_gens_per_bus},
           sources_per_bus_{topo_ptr, &topo_ptr->sources_per_bus},
           mat_data_(y_bus.nnz_lu()),
-          sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
+          sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu(),
+                         y_bus.shared_lu_symbolic()},
           perm_(n_bus_) {}
 
     SolverOutput<sym> run_power_flow(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
@@ -68,26 +71,77 @@ template <symmetry_tag sym_type> class LinearPFSolver {
         SolverOutput<sym> output;
         output.u.resize(n_bus_);
 
-        Timer const main_timer(calculation_info, 2220, "Math solver");
+        Timer const main_timer(calculation_info, LogEvent::math_solver);
 
         // prepare matrix
-        Timer sub_timer(calculation_info, 2221, "Prepare matrix");
-        detail::copy_y_bus<sym>(y_bus, mat_data_);
+        Timer sub_timer(calculation_info, LogEvent::prepare_matrix);
         prepare_matrix_and_rhs(y_bus, input, output);
 
         // solve
         // u vector will have I_injection for slack bus for now
-        sub_timer = Timer(calculation_info, 2222, "Solve sparse linear equation");
-        sparse_solver_.prefactorize_and_solve(mat_data_, perm_, output.u, output.u);
+        sub_timer = Timer(calculation_info, LogEvent::solve_sparse_linear_equation_linear_pf);
+        // the first calculation factorizes in place, the next ones only factorize the pivots affected by a change of
+        // the matrix since the previous calculation again
+        sparse_solver_.prefactorize_or_refactorize(mat_data_, matrix_, lu_matrix_, perm_);
+        sparse_solver_.solve_with_prefactorized_matrix(lu_matrix_, perm_, output.u, output.u);
+        sparse_solver_.log_factorizations(calculation_info);
 
         // calculate math result
-        sub_timer = Timer(calculation_info, 2223, "Calculate math result");
+        sub_timer = Timer(calculation_info, LogEvent::calculate_math_result_linear_pf);
         calculate_result(y_bus, input, output);
 
         // output
         return output;
     }
 
+    // power flow of a panel of inputs, e.g. consecutive scenarios of a batch calculation
+    //    consecutive inputs with the same matrix share its factorization, and their right hand sides are solved
+    //    together; the output of each input is the same as with run_power_flow
+    std::vector<SolverOutput<sym>> run_power_flow_panel(YBus<sym> const& y_bus,
+                                                        std::span<PowerFlowInput<sym> const> inputs,
+                                                        CalculationInfo& calculation_info) {
+        Idx const n_inputs = std::ssize(inputs);
+        std::vector<SolverOutput<sym>> outputs(n_inputs);
+
+        Timer const main_timer(calculation_info, LogEvent::math_solver);
+
+        // solve the inputs [panel_begin, panel_end) with the current factorization
+        Idx panel_begin = 0;
+        auto const solve_panel = [this, &y_bus, &inputs, &outputs, &panel_begin,
+                                  &calculation_info](Idx panel_end) {
+            if (panel_end == panel_begin) {
+                return;
+            }
+            Timer sub_timer(calculation_info, LogEvent::solve_sparse_linear_equation_linear_pf);
+            detail::solve_panel<sym>(sparse_solver_, lu_matrix_, perm_, panel_end - panel_begin,
+                                     [&outputs, panel_begin](Idx k) -> auto& { return outputs[panel_begin + k].u; });
+            sub_timer = Timer(calculation_info, LogEvent::calculate_math_result_linear_pf);
+            for (Idx idx = panel_begin; idx != panel_end; ++idx) {
+                calculate_result(y_bus, inputs[idx], outputs[idx]);
+            }
+        };
+
+        for (Idx idx = 0; idx != n_inputs; ++idx) {
+            {
+                Timer const sub_timer(calculation_info, LogEvent::prepare_matrix);
+                outputs[idx].u.resize(n_bus_);
+                prepare_matrix_and_rhs(y_bus, inputs[idx], outputs[idx]);
+            }
+            if (idx == 0 || !SparseSolverType::same_matrix(mat_data_, matrix_)) {
+                solve_panel(idx);
+                Timer const sub_timer(calculation_info, LogEvent::solve_sparse_linear_equation_linear_pf);
+                sparse_solver_.refactorize(mat_data_, matrix_, lu_matrix_, perm_);
+                panel_begin = idx;
+            }
+        }
+        solve_panel(n_inputs);
+        sparse_solver_.log_factorizations(calculation_info);
+
+        return outputs;
+    }
+
+    void set_sparse_solver_threads(Idx n_threads) { sparse_solver_.set_n_threads(n_threads); }
+
   private:
     Idx n_bus_;
     // shared topo data
@@ -95,11 +149,18 @@ template <symmetry_tag sym_type> class LinearPFSolver {
     std::shared_ptr<DenseGroupedIdxVector const> sources_per_bus_;
     // sparse linear equation
     ComplexTensorVector<sym> mat_data_;
+    // the matrix of the previous calculation and its factorization
+    //    the matrix is only kept from the second calculation on, see prefactorize_or_refactorize
+    ComplexTensorVector<sym> matrix_;
+    ComplexTensorVector<sym> lu_matrix_;
     // sparse solver
     SparseSolverType sparse_solver_;
     BlockPermArray perm_;
 
     void prepare_matrix_and_rhs(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input, SolverOutput<sym>& output) {
+        // the matrix is empty after it is factorized in place
+        mat_data_.resize(y_bus.nnz_lu());
+        detail::copy_y_bus<sym>(y_bus, mat_data_);
         detail::prepare_linear_matrix_and_rhs(y_bus, input, *load_gens_per_bus_, *sources_per_bus_, output, mat_data_);
     }
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "fast_decoupled_pf_solver.hpp"
 #include "iterative_current_pf_solver.hpp"
 #include "iterative_linear_se_solver.hpp"
 #include "linear_pf_solver.hpp"
@@ -20,6 +21,8 @@
 #include "../common/timer.hpp"
 
 #include <optional>
+#include <span>
+#include <vector>
 
 namespace power_grid_model {
 
@@ -53,11 +56,37 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
             return run_power_flow_linear_current(input, err_tol, max_iter, calculation_info, y_bus);
         case iterative_current:
             return run_power_flow_iterative_current(input, err_tol, max_iter, calculation_info, y_bus);
+        case fast_decoupled:
+            return run_power_flow_fast_decoupled(input, err_tol, max_iter, calculation_info, y_bus);
         default:
             throw InvalidCalculationMethod{};
         }
     }
 
+    std::vector<SolverOutput<sym>> run_power_flow_panel(std::span<PowerFlowInput<sym> const> inputs, double err_tol,
+                                                        Idx max_iter, CalculationInfo& calculation_info,
+                                                        CalculationMethod calculation_method,
+                                                        YBus<sym> const& y_bus) final {
+        using enum CalculationMethod;
+
+        // set method to always linear if all load_gens have const_y
+        if (all_const_y_ || calculation_method == linear) {
+            return get_linear_pf_solver(calculation_info, y_bus).run_power_flow_panel(y_bus, inputs, calculation_info);
+        }
+        // with warm start, each input starts from the result of the previous one
+        if (calculation_method == linear_current && !warm_start_) {
+            return get_iterative_current_pf_solver(calculation_info, y_bus)
+                .run_linear_current_panel(y_bus, inputs, calculation_info);
+        }
+        std::vector<SolverOutput<sym>> outputs;
+        outputs.reserve(inputs.size());
+        for (auto const& input : inputs) {
+            outputs.push_back(
+                run_power_flow(input, err_tol, max_iter, calculation_info, calculation_method, y_bus));
+        }
+        return outputs;
+    }
+
     SolverOutput<sym> run_state_estimation(StateEstimationInput<sym> const& input, double err_tol, Idx max_iter,
                                            CalculationInfo& calculation_info, CalculationMethod calculation_method,
                                            YBus<sym> const& y_bus) final {
@@ -85,11 +114,13 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
 
         // construct model if needed
         if (!iec60909_sc_solver_.has_value()) {
-            Timer const timer(calculation_info, 2210, "Create math solver");
+            Timer const timer(calculation_info, LogEvent::create_math_solver);
             iec60909_sc_solver_.emplace(y_bus, topo_ptr_);
         }
 
         // call calculation
+        iec60909_sc_solver_->set_sparse_solver_threads(sparse_solver_threads_);
+        iec60909_sc_solver_->set_sweep(short_circuit_sweep_);
         return iec60909_sc_solver_.value().run_short_circuit(y_bus, input);
     }
 
@@ -97,6 +128,7 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
         newton_raphson_pf_solver_.reset();
         linear_pf_solver_.reset();
         iterative_current_pf_solver_.reset();
+        fast_decoupled_pf_solver_.reset();
         iterative_linear_se_solver_.reset();
     }
 
@@ -104,14 +136,30 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
         if (iterative_current_pf_solver_.has_value()) {
             iterative_current_pf_solver_->parameters_changed(changed);
         }
+        if (fast_decoupled_pf_solver_.has_value()) {
+            fast_decoupled_pf_solver_->parameters_changed(changed);
+        }
+        if (iec60909_sc_solver_.has_value()) {
+            iec60909_sc_solver_->parameters_changed(changed);
+        }
     }
 
+    void set_sparse_solver_threads(Idx n_threads) final { sparse_solver_threads_ = n_threads; }
+
+    void set_warm_start(bool warm_start) final { warm_start_ = warm_start; }
+
+    void set_short_circuit_sweep(bool sweep) final { short_circuit_sweep_ = sweep; }
+
   private:
     std::shared_ptr<MathModelTopology const> topo_ptr_;
     bool all_const_y_; // if all the load_gen is const element_admittance (impedance) type
+    Idx sparse_solver_threads_{1};
+    bool warm_start_{false};
+    bool short_circuit_sweep_{false};
     std::optional<NewtonRaphsonPFSolver<sym>> newton_raphson_pf_solver_;
     std::optional<LinearPFSolver<sym>> linear_pf_solver_;
     std::optional<IterativeCurrentPFSolver<sym>> iterative_current_pf_solver_;
+    std::optional<FastDecoupledPFSolver<symmetric_t>> fast_decoupled_pf_solver_; // only used for symmetric
     std::optional<IterativeLinearSESolver<sym>> iterative_linear_se_solver_;
     std::optional<NewtonRaphsonSESolver<sym>> newton_raphson_se_solver_;
     std::optional<ShortCircuitSolver<sym>> iec60909_sc_solver_;
@@ -119,28 +167,61 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
     SolverOutput<sym> run_power_flow_newton_raphson(PowerFlowInput<sym> const& input, double err_tol, Idx max_iter,
                                                     CalculationInfo& calculation_info, YBus<sym> const& y_bus) {
         if (!newton_raphson_pf_solver_.has_value()) {
-            Timer const timer(calculation_info, 2210, "Create math solver");
+            Timer const timer(calculation_info, LogEvent::create_math_solver);
             newton_raphson_pf_solver_.emplace(y_bus, topo_ptr_);
         }
+        newton_raphson_pf_solver_->set_sparse_solver_threads(sparse_solver_threads_);
+        newton_raphson_pf_solver_->set_warm_start(warm_start_);
         return newton_raphson_pf_solver_.value().run_power_flow(y_bus, input, err_tol, max_iter, calculation_info);
     }
 
-    SolverOutput<sym> run_power_flow_linear(PowerFlowInput<sym> const& input, double /* err_tol */, Idx /* max_iter */,
-                                            CalculationInfo& calculation_info, YBus<sym> const& y_bus) {
+    // construct model if needed
+    LinearPFSolver<sym>& get_linear_pf_solver(CalculationInfo& calculation_info, YBus<sym> const& y_bus) {
         if (!linear_pf_solver_.has_value()) {
-            Timer const timer(calculation_info, 2210, "Create math solver");
+            Timer const timer(calculation_info, LogEvent::create_math_solver);
             linear_pf_solver_.emplace(y_bus, topo_ptr_);
         }
-        return linear_pf_solver_.value().run_power_flow(y_bus, input, calculation_info);
+        linear_pf_solver_->set_sparse_solver_threads(sparse_solver_threads_);
+        return linear_pf_solver_.value();
     }
 
-    SolverOutput<sym> run_power_flow_iterative_current(PowerFlowInput<sym> const& input, double err_tol, Idx max_iter,
-                                                       CalculationInfo& calculation_info, YBus<sym> const& y_bus) {
+    IterativeCurrentPFSolver<sym>& get_iterative_current_pf_solver(CalculationInfo& calculation_info,
+                                                                   YBus<sym> const& y_bus) {
         if (!iterative_current_pf_solver_.has_value()) {
-            Timer const timer(calculation_info, 2210, "Create math solver");
+            Timer const timer(calculation_info, LogEvent::create_math_solver);
             iterative_current_pf_solver_.emplace(y_bus, topo_ptr_);
         }
-        return iterative_current_pf_solver_.value().run_power_flow(y_bus, input, err_tol, max_iter, calculation_info);
+        iterative_current_pf_solver_->set_sparse_solver_threads(sparse_solver_threads_);
+        iterative_current_pf_solver_->set_warm_start(warm_start_);
+        return iterative_current_pf_solver_.value();
+    }
+
+    SolverOutput<sym> run_power_flow_linear(PowerFlowInput<sym> const& input, double /* err_tol */, Idx /* max_iter */,
+                                            CalculationInfo& calculation_info, YBus<sym> const& y_bus) {
+        return get_linear_pf_solver(calculation_info, y_bus).run_power_flow(y_bus, input, calculation_info);
+    }
+
+    SolverOutput<sym> run_power_flow_iterative_current(PowerFlowInput<sym> const& input, double err_tol, Idx max_iter,
+                                                       CalculationInfo& calculation_info, YBus<sym> const& y_bus) {
+        return get_iterative_current_pf_solver(calculation_info, y_bus)
+            .run_power_flow(y_bus, input, err_tol, max_iter, calculation_info);
+    }
+
+    SolverOutput<sym> run_power_flow_fast_decoupled(PowerFlowInput<sym> const& input, double err_tol, Idx max_iter,
+                                                    CalculationInfo& calculation_info, YBus<sym> const& y_bus) {
+        // the phases do not decouple in an asymmetric calculation
+        if constexpr (is_symmetric_v<sym>) {
+            if (!fast_decoupled_pf_solver_.has_value()) {
+                Timer const timer(calculation_info, LogEvent::create_math_solver);
+                fast_decoupled_pf_solver_.emplace(y_bus, topo_ptr_);
+            }
+            fast_decoupled_pf_solver_->set_sparse_solver_threads(sparse_solver_threads_);
+            fast_decoupled_pf_solver_->set_warm_start(warm_start_);
+            return fast_decoupled_pf_solver_.value().run_power_flow(y_bus, input, err_tol, max_iter,
+                                                                    calculation_info);
+        } else {
+            throw InvalidCalculationMethod{};
+        }
     }
 
     SolverOutput<sym> run_power_flow_linear_current(PowerFlowInput<sym> const& input, double /* err_tol */,
@@ -155,11 +236,12 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
                                                             YBus<sym> const& y_bus) {
         // construct model if needed
         if (!iterative_linear_se_solver_.has_value()) {
-            Timer const timer(calculation_info, 2210, "Create math solver");
+            Timer const timer(calculation_info, LogEvent::create_math_solver);
             iterative_linear_se_solver_.emplace(y_bus, topo_ptr_);
         }
 
         // call calculation
+        iterative_linear_se_solver_->set_sparse_solver_threads(sparse_solver_threads_);
         return iterative_linear_se_solver_.value().run_state_estimation(y_bus, input, err_tol, max_iter,
                                                                         calculation_info);
     }
@@ -169,11 +251,12 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
                                                           YBus<sym> const& y_bus) {
         // construct model if needed
         if (!newton_raphson_se_solver_.has_value()) {
-            Timer const timer(calculation_info, 2210, "Create math solver");
+            Timer const timer(calculation_info, LogEvent::create_math_solver);
             newton_raphson_se_solver_.emplace(y_bus, topo_ptr_);
         }
 
         // call calculation
+        newton_raphson_se_solver_->set_sparse_solver_threads(sparse_solver_threads_);
         return newton_raphson_se_solver_.value().run_state_estimation(y_bus, input, err_tol, max_iter,
                                                                       calculation_info);
     }
@@ -13,7 +13,10 @@
 #include "../common/three_phase_tensor.hpp"
 #include "../common/timer.hpp"
 
+#include <atomic>
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace power_grid_model {
 
@@ -32,6 +35,14 @@ template <symmetry_tag sym> class MathSolverBase {
     virtual SolverOutput<sym> run_power_flow(PowerFlowInput<sym> const& input, double err_tol, Idx max_iter,
                                              CalculationInfo& calculation_info, CalculationMethod calculation_method,
                                              YBus<sym> const& y_bus) = 0;
+    // power flow of a panel of inputs of the same math model and parameters, e.g. consecutive scenarios of a batch
+    //    the linear methods solve the inputs together, the other methods one by one
+    //    the output of each input is the same as with run_power_flow
+    virtual std::vector<SolverOutput<sym>> run_power_flow_panel(std::span<PowerFlowInput<sym> const> inputs,
+                                                                double err_tol, Idx max_iter,
+                                                                CalculationInfo& calculation_info,
+                                                                CalculationMethod calculation_method,
+                                                                YBus<sym> const& y_bus) = 0;
     virtual SolverOutput<sym> run_state_estimation(StateEstimationInput<sym> const& input, double err_tol, Idx max_iter,
                                                    CalculationInfo& calculation_info,
                                                    CalculationMethod calculation_method, YBus<sym> const& y_bus) = 0;
@@ -41,6 +52,12 @@ template <symmetry_tag sym> class MathSolverBase {
                                                             YBus<sym> const& y_bus) = 0;
     virtual void clear_solver() = 0;
     virtual void parameters_changed(bool changed) = 0;
+    // number of threads used by the sparse LU solver of a single calculation
+    virtual void set_sparse_solver_threads(Idx n_threads) = 0;
+    // start the iterative power flow from the voltages of the last converged calculation
+    virtual void set_warm_start(bool warm_start) = 0;
+    // factorize the network without faults once and solve the short circuit of each fault configuration from it
+    virtual void set_short_circuit_sweep(bool sweep) = 0;
 
   protected:
     MathSolverBase() = default;
@@ -81,30 +98,28 @@ class MathSolverDispatcher {
     Config<asymmetric_t> asym_config_;
 };
 
+// copies of the proxy share the solver until the solver is accessed mutably (copy-on-write)
+// in this way copying a model is cheap, and only the solvers that are actually used are cloned
 template <symmetry_tag sym> class MathSolverProxy {
   public:
     explicit MathSolverProxy(MathSolverDispatcher const* dispatcher,
                              std::shared_ptr<MathModelTopology const> const& topo_ptr)
         : dispatcher_{dispatcher}, solver_{dispatcher_->get_config<sym>().create(topo_ptr)} {}
-    MathSolverProxy(MathSolverProxy const& other) : dispatcher_{other.dispatcher_}, solver_{other.get().clone()} {}
-    MathSolverProxy& operator=(MathSolverProxy const& other) {
-        if (this != &other) {
-            solver_.reset();
-            dispatcher_ = other.dispatcher_;
-            solver_.reset(other.get().clone());
+
+    MathSolverBase<sym>& get() {
+        if (solver_.use_count() > 1) {
+            solver_.reset(solver_->clone());
+        } else {
+            // synchronize with the release of the other owners that were reading the solver
+            std::atomic_thread_fence(std::memory_order_acquire);
         }
-        return *this;
+        return *solver_;
     }
-    MathSolverProxy(MathSolverProxy&& other) noexcept = default;
-    MathSolverProxy& operator=(MathSolverProxy&& other) noexcept = default;
-    ~MathSolverProxy() = default;
-
-    MathSolverBase<sym>& get() { return *solver_; }
     MathSolverBase<sym> const& get() const { return *solver_; }
 
   private:
     MathSolverDispatcher const* dispatcher_{};
-    std::unique_ptr<MathSolverBase<sym>> solver_;
+    std::shared_ptr<MathSolverBase<sym>> solver_;
 };
 
 } // namespace math_solver
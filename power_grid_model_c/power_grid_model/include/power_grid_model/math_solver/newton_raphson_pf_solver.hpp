@@ -155,6 +155,12 @@ J.L -= -dQ_cal_m/dV
 #include "../common/three_phase_tensor.hpp"
 #include "../common/timer.hpp"
 
+// explicit AVX kernel of the asymmetric jacobian blocks, selected at runtime when the cpu supports it
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(_MSC_VER)
+#define POWER_GRID_MODEL_AVX_JACOBIAN_KERNEL
+#include <immintrin.h>
+#endif
+
 namespace power_grid_model::math_solver {
 
 // hide implementation in inside namespace
@@ -199,6 +205,110 @@ template <symmetry_tag sym> class PFJacBlock : public Block<double, sym, true, 2
     GetterType<1, 1> l() { return this->template get_val<1, 1>(); }
 };
 
+/// @brief power_flow_ij = (ui @* conj(uj))  .* conj(yij)
+/// Hij = diag(Vi) * ( Gij .* sin(theta_ij) - Bij .* cos(theta_ij) ) * diag(Vj)
+/// = imaginary(power_flow_ij)
+/// Nij = diag(Vi) * ( Gij .* cos(theta_ij) + Bij .* sin(theta_ij) ) * diag(Vj)
+/// = real(power_flow_ij)
+/// Mij = -Nij
+/// Lij = Hij
+/// The complex products are expanded in separate real and imaginary parts.
+/// For the asymmetric 3x3 blocks, this keeps the arithmetic in plain real arrays which vectorize well,
+///     instead of interleaved complex numbers, and writes the result directly into the jacobian.
+template <symmetry_tag sym>
+inline void calculate_hnml_scalar(PFJacBlock<sym>& block, ComplexTensor<sym> const& yij, ComplexValue<sym> const& ui,
+                                  ComplexValue<sym> const& uj) {
+    RealValue<sym> const ui_re = real(ui);
+    RealValue<sym> const ui_im = imag(ui);
+    RealValue<sym> const uj_re = real(uj);
+    RealValue<sym> const uj_im = imag(uj);
+    RealTensor<sym> const g = real(yij);
+    RealTensor<sym> const b = imag(yij);
+    // ui @* conj(uj)
+    RealTensor<sym> const u_outer_re = vector_outer_product(ui_re, uj_re) + vector_outer_product(ui_im, uj_im);
+    RealTensor<sym> const u_outer_im = vector_outer_product(ui_im, uj_re) - vector_outer_product(ui_re, uj_im);
+    // (ui @* conj(uj)) .* conj(yij)
+    block.n() = u_outer_re * g + u_outer_im * b;
+    block.h() = u_outer_im * g - u_outer_re * b;
+    block.m() = -block.n();
+    block.l() = block.h();
+}
+
+#ifdef POWER_GRID_MODEL_AVX_JACOBIAN_KERNEL
+// split three complex values into the real parts and the imaginary parts of the phases
+//     the phases are the first three lanes, the fourth lane is zero
+__attribute__((target("avx"))) inline void split_phases(DoubleComplex const* x, __m256d& re, __m256d& im) {
+    auto const* const data = reinterpret_cast<double const*>(x);
+    __m256d const x_02 = _mm256_set_m128d(_mm_loadu_pd(data + 4), _mm_loadu_pd(data)); // re0 im0 re2 im2
+    __m256d const x_1 = _mm256_set_m128d(_mm_setzero_pd(), _mm_loadu_pd(data + 2));    // re1 im1 0 0
+    re = _mm256_unpacklo_pd(x_02, x_1);
+    im = _mm256_unpackhi_pd(x_02, x_1);
+}
+
+/// @brief same as calculate_hnml_scalar for the asymmetric blocks, computing one column of H and N per step
+/// The operations are the same as in the scalar version, without fused multiply-add,
+///     so both give the same result.
+__attribute__((target("avx"))) inline void calculate_hnml_avx(PFJacBlock<asymmetric_t>& block,
+                                                              ComplexTensor<asymmetric_t> const& yij,
+                                                              ComplexValue<asymmetric_t> const& ui,
+                                                              ComplexValue<asymmetric_t> const& uj) {
+    // column major 6x6 block [[H, N], [M, L]] and column major 3x3 admittance
+    static_assert(PFJacBlock<asymmetric_t>::RowsAtCompileTime == 6 && !PFJacBlock<asymmetric_t>::IsRowMajor);
+    static_assert(ComplexTensor<asymmetric_t>::RowsAtCompileTime == 3 && !ComplexTensor<asymmetric_t>::IsRowMajor);
+    constexpr Idx n_phase = 3;
+    constexpr Idx n_row = 2 * n_phase;
+
+    __m256i const phase_mask = _mm256_setr_epi64x(-1, -1, -1, 0);
+    __m256d const sign_mask = _mm256_set1_pd(-0.0);
+    __m256d ui_re;
+    __m256d ui_im;
+    split_phases(ui.data(), ui_re, ui_im);
+    auto const* const uj_data = reinterpret_cast<double const*>(uj.data());
+    double* const block_data = block.data();
+
+    for (Idx col = 0; col != n_phase; ++col) {
+        __m256d const uj_re = _mm256_broadcast_sd(uj_data + 2 * col);
+        __m256d const uj_im = _mm256_broadcast_sd(uj_data + 2 * col + 1);
+        __m256d g;
+        __m256d b;
+        split_phases(yij.data() + n_phase * col, g, b);
+        // ui @* conj(uj)
+        __m256d const u_outer_re = _mm256_add_pd(_mm256_mul_pd(ui_re, uj_re), _mm256_mul_pd(ui_im, uj_im));
+        __m256d const u_outer_im = _mm256_sub_pd(_mm256_mul_pd(ui_im, uj_re), _mm256_mul_pd(ui_re, uj_im));
+        // (ui @* conj(uj)) .* conj(yij)
+        __m256d const n = _mm256_add_pd(_mm256_mul_pd(u_outer_re, g), _mm256_mul_pd(u_outer_im, b));
+        __m256d const h = _mm256_sub_pd(_mm256_mul_pd(u_outer_im, g), _mm256_mul_pd(u_outer_re, b));
+        // column col holds H and M = -N, column col + 3 holds N and L = H
+        double* const left = block_data + n_row * col;
+        double* const right = block_data + n_row * (col + n_phase);
+        _mm256_maskstore_pd(left, phase_mask, h);
+        _mm256_maskstore_pd(left + n_phase, phase_mask, _mm256_xor_pd(n, sign_mask));
+        _mm256_maskstore_pd(right, phase_mask, n);
+        _mm256_maskstore_pd(right + n_phase, phase_mask, h);
+    }
+}
+
+inline bool cpu_supports_avx() {
+    static bool const supported = __builtin_cpu_supports("avx") != 0;
+    return supported;
+}
+#endif
+
+// jacobian block of a branch or a diagonal entry, the asymmetric blocks use the AVX kernel when available
+template <symmetry_tag sym>
+inline void calculate_hnml(PFJacBlock<sym>& block, ComplexTensor<sym> const& yij, ComplexValue<sym> const& ui,
+                           ComplexValue<sym> const& uj) {
+#ifdef POWER_GRID_MODEL_AVX_JACOBIAN_KERNEL
+    if constexpr (is_asymmetric_v<sym>) {
+        if (cpu_supports_avx()) {
+            calculate_hnml_avx(block, yij, ui, uj);
+            return;
+        }
+    }
+#endif
+    calculate_hnml_scalar(block, yij, ui, uj);
+}
+
 // solver
 template <symmetry_tag sym_type>
 class NewtonRaphsonPFSolver : public IterativePFSolver<sym_type, NewtonRaphsonPFSolver<sym_type>> {
@@ -216,23 +326,28 @@ class NewtonRaphsonPFSolver : public IterativePFSolver<sym_type, NewtonRaphsonPF
           data_jac_(y_bus.nnz_lu()),
           x_(y_bus.size()),
           del_x_pq_(y_bus.size()),
-          sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
+          sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu(),
+                         y_bus.shared_lu_symbolic()},
           perm_(y_bus.size()) {}
 
     // Initilize the unknown variable in polar form
     void initialize_derived_solver(YBus<sym> const& y_bus, PowerFlowInput<sym> const& input,
-                                   SolverOutput<sym>& output) {
-        using LinearSparseSolverType = SparseLUSolver<ComplexTensor<sym>, ComplexValue<sym>, ComplexValue<sym>>;
-
-        ComplexTensorVector<sym> linear_mat_data(y_bus.nnz_lu());
-        LinearSparseSolverType linear_sparse_solver{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(),
-                                                    y_bus.shared_diag_lu()};
-        typename LinearSparseSolverType::BlockPermArray linear_perm(y_bus.size());
-
-        detail::copy_y_bus<sym>(y_bus, linear_mat_data);
-        detail::prepare_linear_matrix_and_rhs(y_bus, input, *this->load_gens_per_bus_, *this->sources_per_bus_, output,
-                                              linear_mat_data);
-        linear_sparse_solver.prefactorize_and_solve(linear_mat_data, linear_perm, output.u, output.u);
+                                   SolverOutput<sym>& output, CalculationInfo& calculation_info) {
+        this->initialize_voltage(input, output.u, [this, &y_bus, &input, &output, &calculation_info] {
+            using LinearSparseSolverType = SparseLUSolver<ComplexTensor<sym>, ComplexValue<sym>, ComplexValue<sym>>;
+
+            ComplexTensorVector<sym> linear_mat_data(y_bus.nnz_lu());
+            LinearSparseSolverType linear_sparse_solver{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(),
+                                                        y_bus.shared_diag_lu(), y_bus.shared_lu_symbolic()};
+            typename LinearSparseSolverType::BlockPermArray linear_perm(y_bus.size());
+            linear_sparse_solver.set_n_threads(sparse_solver_.n_threads());
+
+            detail::copy_y_bus<sym>(y_bus, linear_mat_data);
+            detail::prepare_linear_matrix_and_rhs(y_bus, input, *this->load_gens_per_bus_, *this->sources_per_bus_,
+                                                  output, linear_mat_data);
+            linear_sparse_solver.prefactorize_and_solve(linear_mat_data, linear_perm, output.u, output.u);
+            linear_sparse_solver.log_factorizations(calculation_info);
+        });
 
         // get magnitude and angle of start voltage
         for (Idx i = 0; i != this->n_bus_; ++i) {
@@ -258,7 +373,10 @@ class NewtonRaphsonPFSolver : public IterativePFSolver<sym_type, NewtonRaphsonPF
     }
 
     // Solve the linear Equations
-    void solve_matrix() { sparse_solver_.prefactorize_and_solve(data_jac_, perm_, del_x_pq_, del_x_pq_); }
+    void solve_matrix(CalculationInfo& calculation_info) {
+        sparse_solver_.prefactorize_and_solve(data_jac_, perm_, del_x_pq_, del_x_pq_);
+        sparse_solver_.log_factorizations(calculation_info);
+    }
 
     // Get maximum deviation among all bus voltages
     double iterate_unknown(ComplexValueVector<sym>& u) {
@@ -281,6 +399,8 @@ class NewtonRaphsonPFSolver : public IterativePFSolver<sym_type, NewtonRaphsonPF
         return max_dev;
     }
 
+    void set_sparse_solver_threads(Idx n_threads) { sparse_solver_.set_n_threads(n_threads); }
+
   private:
     // data for jacobian
     std::vector<PFJacBlock<sym>> data_jac_;
@@ -296,24 +416,6 @@ class NewtonRaphsonPFSolver : public IterativePFSolver<sym_type, NewtonRaphsonPF
     // permutation array
     BlockPermArray perm_;
 
-    /// @brief power_flow_ij = (ui @* conj(uj))  .* conj(yij)
-    /// Hij = diag(Vi) * ( Gij .* sin(theta_ij) - Bij .* cos(theta_ij) ) * diag(Vj)
-    /// = imaginary(power_flow_ij)
-    /// Nij = diag(Vi) * ( Gij .* cos(theta_ij) + Bij .* sin(theta_ij) ) * diag(Vj)
-    /// = real(power_flow_ij)
-    /// Mij = -Nij
-    /// Lij = Hij
-    static PFJacBlock<sym> calculate_hnml(ComplexTensor<sym> const& yij, ComplexValue<sym> const& ui,
-                                          ComplexValue<sym> const& uj) {
-        PFJacBlock<sym> block{};
-        ComplexTensor<sym> const power_flow_ij = vector_outer_product(ui, conj(uj)) * conj(yij);
-        block.h() = imag(power_flow_ij);
-        block.n() = real(power_flow_ij);
-        block.m() = -block.n();
-        block.l() = block.h();
-        return block;
-    }
-
     void prepare_matrix_and_rhs_from_network_perspective(YBus<sym> const& y_bus, ComplexValueVector<sym> const& u,
                                                          IdxVector const& bus_entry) {
         IdxVector const& indptr = y_bus.row_indptr_lu();
@@ -337,7 +439,7 @@ class NewtonRaphsonPFSolver : public IterativePFSolver<sym_type, NewtonRaphsonPF
                 }
                 Idx const j = indices[k];
                 // incomplete jacobian
-                data_jac_[k] = calculate_hnml(ydata[k_y_bus], u[row], u[j]);
+                calculate_hnml(data_jac_[k], ydata[k_y_bus], u[row], u[j]);
                 // accumulate negative power injection
                 // -P = sum(-N)
                 del_x_pq_[row].p() -= sum_row(data_jac_[k].n());
@@ -416,8 +518,10 @@ class NewtonRaphsonPFSolver : public IterativePFSolver<sym_type, NewtonRaphsonPF
             ComplexTensor<sym> const y_ref = y_bus.math_model_param().source_param[source_number].template y_ref<sym>();
             ComplexValue<sym> const u_ref{input.source[source_number]};
             // calculate block, um = ui, us = uref
-            PFJacBlock<sym> block_mm = calculate_hnml(y_ref, u[bus_number], u[bus_number]);
-            PFJacBlock<sym> block_ms = calculate_hnml(-y_ref, u[bus_number], u_ref);
+            PFJacBlock<sym> block_mm;
+            PFJacBlock<sym> block_ms;
+            calculate_hnml(block_mm, y_ref, u[bus_number], u[bus_number]);
+            calculate_hnml(block_ms, -y_ref, u[bus_number], u_ref);
             // P_cal_m = (Nmm + Nms) * I
             RealValue<sym> const p_cal = sum_row(block_mm.n() + block_ms.n());
             // Q_cal_m = (Hmm + Hms) * I
@@ -28,7 +28,8 @@ template <symmetry_tag sym> class ShortCircuitSolver {
           n_source_{topo_ptr->n_source()},
           sources_per_bus_{topo_ptr, &topo_ptr->sources_per_bus},
           mat_data_(y_bus.nnz_lu()),
-          sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
+          sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu(),
+                         y_bus.shared_lu_symbolic()},
           perm_{static_cast<BlockPermArray>(n_bus_)} {}
 
     ShortCircuitSolverOutput<sym> run_short_circuit(YBus<sym> const& y_bus, ShortCircuitInput const& input) {
@@ -47,12 +48,22 @@ template <symmetry_tag sym> class ShortCircuitSolver {
 
         IdxVector infinite_admittance_fault_counter(n_bus_);
 
-        detail::copy_y_bus<sym>(y_bus, mat_data_);
-
-        prepare_matrix_and_rhs(y_bus, input, output, infinite_admittance_fault_counter, fault_type, phase_1, phase_2);
-
-        // solve matrix
-        sparse_solver_.prefactorize_and_solve(mat_data_, perm_, output.u_bus, output.u_bus);
+        if (sweep_) {
+            solve_with_prefault_factorization(y_bus, input, output, infinite_admittance_fault_counter, fault_type,
+                                              phase_1, phase_2);
+        } else {
+            // the matrix is empty after it is factorized in place
+            mat_data_.resize(y_bus.nnz_lu());
+            detail::copy_y_bus<sym>(y_bus, mat_data_);
+
+            prepare_matrix_and_rhs(y_bus, input, output, infinite_admittance_fault_counter, fault_type, phase_1,
+                                   phase_2);
+
+            // solve matrix, the first calculation factorizes in place, the next ones only factorize the pivots
+            // affected by a change since the previous calculation again
+            sparse_solver_.prefactorize_or_refactorize(mat_data_, factorized_matrix_, lu_matrix_, perm_);
+            sparse_solver_.solve_with_prefactorized_matrix(lu_matrix_, perm_, output.u_bus, output.u_bus);
+        }
 
         // post processing
         calculate_result(y_bus, input, output, infinite_admittance_fault_counter, fault_type, phase_1, phase_2);
@@ -60,16 +71,199 @@ template <symmetry_tag sym> class ShortCircuitSolver {
         return output;
     }
 
+    void set_sparse_solver_threads(Idx n_threads) { sparse_solver_.set_n_threads(n_threads); }
+
+    // fault sweep: factorize the network without faults once and solve each fault configuration from it
+    void set_sweep(bool sweep) {
+        if (sweep_ != sweep) {
+            prefault_factorized_ = false;
+            factorized_matrix_ = {};
+            lu_matrix_ = {};
+        }
+        sweep_ = sweep;
+    }
+
+    void parameters_changed(bool changed) { prefault_factorized_ = prefault_factorized_ && !changed; }
+
   private:
+    static constexpr Idx n_phase = is_symmetric_v<sym> ? 1 : 3;
+
     Idx n_bus_;
     Idx n_source_;
     // shared topo data
     std::shared_ptr<DenseGroupedIdxVector const> sources_per_bus_;
     // sparse linear equation
+    //    in the fault sweep, this is the matrix without faults
     ComplexTensorVector<sym> mat_data_;
     // sparse solver
     SparseLUSolver<ComplexTensor<sym>, ComplexValue<sym>, ComplexValue<sym>> sparse_solver_;
     BlockPermArray perm_;
+    // the matrix of the previous factorization and the factorization
+    //    in the fault sweep, this is the matrix without faults
+    //    otherwise, the matrix is only kept from the second calculation on, see prefactorize_or_refactorize
+    ComplexTensorVector<sym> factorized_matrix_;
+    ComplexTensorVector<sym> lu_matrix_;
+    // fault sweep
+    bool sweep_{false};
+    bool prefault_factorized_{false};
+    // work arrays of the partial solves, zero outside of a solve
+    ComplexValueVector<sym> sparse_rhs_;
+    ComplexValueVector<sym> sparse_x_;
+
+    // column of the matrix changed by the faults
+    struct ChangedColumn {
+        Idx bus_number;
+        Idx phase;
+        IdxVector rows;
+        ComplexValueVector<sym> delta;
+    };
+
+    // The faults only change the columns of the fault buses and the right hand side: M = A + U * V^T,
+    //    with A the matrix without faults, U the changed columns and V^T x selecting the phases of the fault buses
+    //    in x. With the prefactorized A, the Woodbury identity gives the solution of M * x = b:
+    //        z = V^T * x = (I + V^T * A^-1 * U)^-1 * V^T * A^-1 * b
+    //        x = A^-1 * (b - U * z)
+    //    V^T * A^-1 * U and V^T * A^-1 * b are the Thevenin impedances and voltages at the fault buses. They only
+    //    need partial solves along the elimination tree, so a scenario costs one full solve.
+    //    The changed columns are obtained from the same fault assembly as the direct solve, so the result only
+    //    differs by round-off.
+    void solve_with_prefault_factorization(YBus<sym> const& y_bus, ShortCircuitInput const& input,
+                                           ShortCircuitSolverOutput<sym>& output,
+                                           IdxVector& infinite_admittance_fault_counter, FaultType const& fault_type,
+                                           IntS phase_1, IntS phase_2) {
+        IdxVector const& bus_entry = y_bus.lu_diag();
+        IdxVector const& row_indptr = y_bus.row_indptr_lu();
+        IdxVector const& col_indices = y_bus.col_indices_lu();
+        IdxVector const& lu_transpose_entry = y_bus.lu_transpose_entry();
+
+        if (!prefault_factorized_) {
+            mat_data_.resize(y_bus.nnz_lu());
+            detail::copy_y_bus<sym>(y_bus, mat_data_);
+            for (auto const& [bus_number, sources] : enumerated_zip_sequence(*sources_per_bus_)) {
+                detail::add_sources<sym>(sources, bus_number, y_bus, input.source, mat_data_[bus_entry[bus_number]],
+                                         output.u_bus[bus_number]);
+            }
+            sparse_solver_.refactorize(mat_data_, factorized_matrix_, lu_matrix_, perm_);
+            sparse_rhs_.assign(n_bus_, ComplexValue<sym>{});
+            sparse_x_.assign(n_bus_, ComplexValue<sym>{});
+            prefault_factorized_ = true;
+        }
+
+        // right hand side without faults
+        IdxVector rhs_rows;
+        for (auto const& [bus_number, sources] : enumerated_zip_sequence(*sources_per_bus_)) {
+            ComplexValue<sym>& u_bus = output.u_bus[bus_number];
+            u_bus = ComplexValue<sym>{};
+            for (Idx const source_number : sources) {
+                ComplexTensor<sym> const y_source =
+                    y_bus.math_model_param().source_param[source_number].template y_ref<sym>();
+                u_bus += dot(y_source, ComplexValue<sym>{input.source[source_number]});
+            }
+            if (!sources.empty()) {
+                rhs_rows.push_back(bus_number);
+            }
+        }
+
+        // changed columns of the faults, the matrix without faults is restored afterwards
+        IdxVector fault_rows;
+        std::vector<ChangedColumn> changed_columns;
+        ComplexTensorVector<sym> original_column;
+        for (auto const& [bus_number, faults] : enumerated_zip_sequence(input.fault_buses)) {
+            if (faults.empty()) {
+                continue;
+            }
+            fault_rows.push_back(bus_number);
+            Idx const row_begin = row_indptr[bus_number];
+            Idx const row_end = row_indptr[bus_number + 1];
+            original_column.clear();
+            for (Idx data_index = row_begin; data_index != row_end; ++data_index) {
+                original_column.push_back(mat_data_[lu_transpose_entry[data_index]]);
+            }
+            add_faults(faults, bus_number, y_bus, input, mat_data_[bus_entry[bus_number]], output.u_bus[bus_number],
+                       infinite_admittance_fault_counter, fault_type, phase_1, phase_2);
+            for (Idx phase = 0; phase != n_phase; ++phase) {
+                ChangedColumn column{.bus_number = bus_number, .phase = phase, .rows = {}, .delta = {}};
+                for (Idx data_index = row_begin; data_index != row_end; ++data_index) {
+                    ComplexValue<sym> const delta =
+                        tensor_column(mat_data_[lu_transpose_entry[data_index]], phase) -
+                        tensor_column(original_column[data_index - row_begin], phase);
+                    if (max_val(cabs(delta)) != 0.0) {
+                        column.rows.push_back(col_indices[data_index]);
+                        column.delta.push_back(delta);
+                    }
+                }
+                if (!column.rows.empty()) {
+                    changed_columns.push_back(std::move(column));
+                }
+            }
+            for (Idx data_index = row_begin; data_index != row_end; ++data_index) {
+                mat_data_[lu_transpose_entry[data_index]] = original_column[data_index - row_begin];
+            }
+        }
+        rhs_rows.insert(rhs_rows.end(), fault_rows.cbegin(), fault_rows.cend());
+
+        if (!changed_columns.empty()) {
+            // Thevenin voltages V^T * A^-1 * b and impedances I + V^T * A^-1 * U
+            auto const n_changed = static_cast<Idx>(changed_columns.size());
+            Eigen::VectorXcd z(n_changed);
+            Eigen::MatrixXcd capacitance = Eigen::MatrixXcd::Identity(n_changed, n_changed);
+            auto const gather = [this, &changed_columns, &fault_rows, n_changed](auto&& assign) {
+                for (Idx row = 0; row != n_changed; ++row) {
+                    auto const& column = changed_columns[row];
+                    assign(row, phase_value(sparse_x_[column.bus_number], column.phase));
+                }
+                for (Idx const bus_number : fault_rows) {
+                    sparse_x_[bus_number] = ComplexValue<sym>{};
+                }
+            };
+            sparse_solver_.solve_partial_with_prefactorized_matrix(lu_matrix_, perm_, output.u_bus, rhs_rows,
+                                                                   fault_rows, sparse_x_);
+            gather([&z](Idx row, DoubleComplex value) { z(row) = value; });
+            for (Idx col = 0; col != n_changed; ++col) {
+                auto const& column = changed_columns[col];
+                for (size_t entry = 0; entry != column.rows.size(); ++entry) {
+                    sparse_rhs_[column.rows[entry]] = column.delta[entry];
+                }
+                sparse_solver_.solve_partial_with_prefactorized_matrix(lu_matrix_, perm_, sparse_rhs_, column.rows,
+                                                                       fault_rows, sparse_x_);
+                gather([&capacitance, col](Idx row, DoubleComplex value) { capacitance(row, col) += value; });
+                for (Idx const row : column.rows) {
+                    sparse_rhs_[row] = ComplexValue<sym>{};
+                }
+            }
+            auto const lu = capacitance.fullPivLu();
+            if (!lu.isInvertible()) {
+                throw SparseMatrixError{};
+            }
+            z = lu.solve(z).eval();
+
+            // b - U * z
+            for (Idx col = 0; col != n_changed; ++col) {
+                auto const& column = changed_columns[col];
+                for (size_t entry = 0; entry != column.rows.size(); ++entry) {
+                    output.u_bus[column.rows[entry]] -= z(col) * column.delta[entry];
+                }
+            }
+        }
+
+        sparse_solver_.solve_with_prefactorized_matrix(lu_matrix_, perm_, output.u_bus, output.u_bus);
+    }
+
+    static ComplexValue<sym> tensor_column(ComplexTensor<sym> const& tensor, [[maybe_unused]] Idx phase) {
+        if constexpr (is_symmetric_v<sym>) {
+            return tensor;
+        } else {
+            return tensor.col(phase);
+        }
+    }
+
+    static DoubleComplex phase_value(ComplexValue<sym> const& value, [[maybe_unused]] Idx phase) {
+        if constexpr (is_symmetric_v<sym>) {
+            return value;
+        } else {
+            return value(phase);
+        }
+    }
 
     void prepare_matrix_and_rhs(YBus<sym> const& y_bus, ShortCircuitInput const& input,
                                 ShortCircuitSolverOutput<sym>& output, IdxVector& infinite_admittance_fault_counter,
@@ -4,13 +4,19 @@
 
 #pragma once
 
+#include "../common/calculation_info.hpp"
 #include "../common/common.hpp"
 #include "../common/exception.hpp"
+#include "../common/thread_pool.hpp"
 #include "../common/three_phase_tensor.hpp"
 #include "../common/typing.hpp"
 
+#include <algorithm>
+#include <cassert>
 #include <memory>
+#include <numeric>
 #include <optional>
+#include <ranges>
 
 namespace power_grid_model::math_solver {
 
@@ -189,6 +195,93 @@ struct sparse_lu_entry_trait<Tensor, RHSVector, XVector> {
     using BlockPermArray = std::vector<BlockPerm>;
 };
 
+// symbolic LU factorization of a sparse matrix
+//    the structure should be symmetric and already contain all fill-ins, with sorted column indices per row
+//    it only depends on the structure, so it can be shared by all solvers of matrices with the same structure
+//    the numeric factorization is driven by the pre-computed index maps, without any search or allocation
+struct SparseLUSymbolic {
+    // for entry i at (row, col), transpose_entry[i] is the entry at (col, row)
+    IdxVector transpose_entry;
+    // for pivot k, the entries updated by the Schur complement are
+    //    update_target[update_indptr[k]:update_indptr[k + 1]]
+    // in the order of the entries L(l_row, k) below the pivot (outer loop)
+    // and the entries U(k, u_col) right of the pivot (inner loop)
+    // i.e. A(l_row, u_col) -= L(l_row, k) * U(k, u_col)
+    IdxVector update_indptr;
+    IdxVector update_target;
+    // level schedule of the elimination tree, the pivots of level i are
+    //    level_pivots[level_indptr[i]:level_indptr[i + 1]]
+    // the parent of a pivot is the first column right of the diagonal, so that it is always at a higher level
+    // pivots at the same level do not depend on each other and can be factorized and solved concurrently
+    IdxVector level_indptr;
+    IdxVector level_pivots;
+
+    SparseLUSymbolic() = default;
+    SparseLUSymbolic(IdxVector const& row_indptr, IdxVector const& col_indices, IdxVector const& diag_lu) {
+        Idx const size = static_cast<Idx>(row_indptr.size()) - 1;
+
+        // the entries of column k are visited in increasing row order,
+        // which matches the order of the entries in row k because the structure is symmetric
+        transpose_entry.resize(col_indices.size());
+        IdxVector col_position_idx(row_indptr.cbegin(), row_indptr.cend() - 1);
+        for (Idx row = 0; row != size; ++row) {
+            for (Idx idx = row_indptr[row]; idx != row_indptr[row + 1]; ++idx) {
+                Idx const transpose_idx = col_position_idx[col_indices[idx]]++;
+                assert(col_indices[transpose_idx] == row);
+                transpose_entry[idx] = transpose_idx;
+            }
+        }
+
+        update_indptr.resize(size + 1);
+        update_indptr[0] = 0;
+        for (Idx pivot_row_col = 0; pivot_row_col != size; ++pivot_row_col) {
+            Idx const pivot_idx = diag_lu[pivot_row_col];
+            Idx const row_end = row_indptr[pivot_row_col + 1];
+            for (Idx l_ref_idx = pivot_idx + 1; l_ref_idx < row_end; ++l_ref_idx) {
+                Idx const l_row = col_indices[l_ref_idx];
+                // search the target entries from (l_row, pivot_row_col) onwards
+                Idx a_idx = transpose_entry[l_ref_idx];
+                for (Idx u_idx = pivot_idx + 1; u_idx < row_end; ++u_idx) {
+                    Idx const u_col = col_indices[u_idx];
+                    auto const found = std::lower_bound(col_indices.cbegin() + a_idx,
+                                                        col_indices.cbegin() + row_indptr[l_row + 1], u_col);
+                    // it is guaranteed to have an entry at (l_row, u_col), if (pivot_row_col, u_col) is non-zero
+                    assert(found != col_indices.cbegin() + row_indptr[l_row + 1]);
+                    assert(*found == u_col);
+                    a_idx = narrow_cast<Idx>(std::distance(col_indices.cbegin(), found));
+                    update_target.push_back(a_idx);
+                }
+            }
+            update_indptr[pivot_row_col + 1] = static_cast<Idx>(update_target.size());
+        }
+
+        // the children have lower indices than their parent, so one forward sweep determines the levels
+        IdxVector level(size, 0);
+        Idx n_levels = size == 0 ? 0 : 1;
+        for (Idx pivot_row_col = 0; pivot_row_col != size; ++pivot_row_col) {
+            Idx const parent_idx = diag_lu[pivot_row_col] + 1;
+            if (parent_idx < row_indptr[pivot_row_col + 1]) {
+                Idx& parent_level = level[col_indices[parent_idx]];
+                parent_level = std::max(parent_level, level[pivot_row_col] + 1);
+                n_levels = std::max(n_levels, parent_level + 1);
+            }
+        }
+        // counting sort, the pivots are in increasing order within a level
+        level_indptr.assign(n_levels + 1, 0);
+        for (Idx const pivot_level : level) {
+            ++level_indptr[pivot_level + 1];
+        }
+        std::partial_sum(level_indptr.cbegin(), level_indptr.cend(), level_indptr.begin());
+        level_pivots.resize(size);
+        IdxVector level_position(level_indptr.cbegin(), level_indptr.cend() - 1);
+        for (Idx pivot_row_col = 0; pivot_row_col != size; ++pivot_row_col) {
+            level_pivots[level_position[level[pivot_row_col]]++] = pivot_row_col;
+        }
+    }
+
+    Idx n_levels() const { return static_cast<Idx>(level_indptr.size()) - 1; }
+};
+
 template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
   public:
     using entry_trait = sparse_lu_entry_trait<Tensor, RHSVector, XVector>;
@@ -200,14 +293,18 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
     using BlockPermArray = typename entry_trait::BlockPermArray;
     static constexpr Idx max_iterative_refinement = 5;
 
+    // the symbolic factorization is created if it is not provided
     SparseLUSolver(std::shared_ptr<IdxVector const> const& row_indptr, // indptr including fill-ins
                    std::shared_ptr<IdxVector const> col_indices,       // indices including fill-ins
-                   std::shared_ptr<IdxVector const> diag_lu)
+                   std::shared_ptr<IdxVector const> diag_lu,
+                   std::shared_ptr<SparseLUSymbolic const> symbolic = {})
         : size_{static_cast<Idx>(row_indptr->size()) - 1},
           nnz_{row_indptr->back()},
           row_indptr_{row_indptr},
           col_indices_{std::move(col_indices)},
-          diag_lu_{std::move(diag_lu)} {}
+          diag_lu_{std::move(diag_lu)},
+          symbolic_{symbolic ? std::move(symbolic)
+                             : std::make_shared<SparseLUSymbolic const>(*row_indptr_, *col_indices_, *diag_lu_)} {}
 
     // solve with new matrix data, need to factorize first
     void
@@ -232,6 +329,80 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
         }
     }
 
+    // solve with existing pre-factorization for a panel of n_rhs right hand sides
+    //    the right hand sides are stored row by row: entry k of row i is at i * n_rhs + k, so that each entry of the
+    //    factorization is loaded once and applied to all right hand sides in the forward and backward substitution
+    //    the solution of each right hand side is the same as with solve_with_prefactorized_matrix
+    //    rhs and x can be the same
+    void solve_panel_with_prefactorized_matrix(std::vector<Tensor> const& data,
+                                               BlockPermArray const& block_perm_array,
+                                               std::vector<RHSVector> const& rhs, std::vector<XVector>& x,
+                                               Idx n_rhs) {
+        assert(n_rhs > 0);
+        assert(static_cast<Idx>(rhs.size()) == size_ * n_rhs);
+        assert(static_cast<Idx>(x.size()) == size_ * n_rhs);
+        if (!has_pivot_perturbation_) {
+            solve_once(data, block_perm_array, rhs, x, n_rhs);
+            return;
+        }
+        // the iterative refinement is done per right hand side
+        std::vector<RHSVector> rhs_column(size_);
+        std::vector<XVector> x_column(size_);
+        for (Idx k = 0; k != n_rhs; ++k) {
+            for (Idx row = 0; row != size_; ++row) {
+                rhs_column[row] = rhs[row * n_rhs + k];
+            }
+            solve_with_refinement(data, block_perm_array, rhs_column, x_column);
+            for (Idx row = 0; row != size_; ++row) {
+                x[row * n_rhs + k] = x_column[row];
+            }
+        }
+    }
+
+    // solve with existing pre-factorization for a sparse right hand side, only calculating the requested rows
+    //    rhs is zero except at rhs_rows, x is a work array which is zero on entry
+    //    the non-zeros of the forward substitution are on the paths from rhs_rows to the root of the elimination
+    //    tree, and the solution at a row only depends on the rows on its path to the root in backward substitution
+    //    on exit, x contains the solution at x_rows and is zero elsewhere
+    void solve_partial_with_prefactorized_matrix(std::vector<Tensor> const& data,
+                                                 BlockPermArray const& block_perm_array,
+                                                 std::vector<RHSVector> const& rhs, IdxVector const& rhs_rows,
+                                                 IdxVector const& x_rows, std::vector<XVector>& x) const {
+        assert(!has_pivot_perturbation_);
+        IdxVector const forward_rows = elimination_tree_paths(rhs_rows);
+        IdxVector const backward_rows = elimination_tree_paths(x_rows);
+
+        for (Idx const row : forward_rows) {
+            forward_substitute(data, block_perm_array, rhs, x, row);
+        }
+        for (Idx const row : backward_rows | std::views::reverse) {
+            backward_substitute(data, x, row);
+        }
+
+        // restore permutation for block matrix, and reset the other visited rows
+        std::vector<XVector> result;
+        result.reserve(x_rows.size());
+        for (Idx const row : x_rows) {
+            if constexpr (is_block) {
+                result.push_back((block_perm_array[row].q * x[row].matrix()).array());
+            } else {
+                result.push_back(x[row]);
+            }
+        }
+        for (auto const* rows : {&forward_rows, &backward_rows}) {
+            for (Idx const row : *rows) {
+                if constexpr (is_block) {
+                    x[row] = XVector::Zero();
+                } else {
+                    x[row] = 0.0;
+                }
+            }
+        }
+        for (size_t i = 0; i != x_rows.size(); ++i) {
+            x[x_rows[i]] = result[i];
+        }
+    }
+
     // prefactorize in-place
     // the LU matrix has the form A = L * U
     // diagonals of L are one
@@ -246,178 +417,453 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
         }
         double const perturb_threshold = epsilon_perturbation * matrix_norm_;
 
+        if (n_threads_ > 1) {
+            prefactorize_level_scheduled(data, block_perm_array, perturb_threshold, use_pivot_perturbation);
+        } else {
+            prefactorize_sequential(data, block_perm_array, perturb_threshold, use_pivot_perturbation);
+        }
+        ++n_factorizations_;
+        // if no pivot perturbation happened, reset cache
+        if (!has_pivot_perturbation_) {
+            reset_matrix_cache();
+        } else {
+            ++n_pivot_perturbations_;
+        }
+    }
+
+    // factorize a new matrix, reusing the factorization of the previous matrix where possible
+    //    previous_matrix is the matrix that was factorized into lu_matrix and block_perm_array, or empty if there is
+    //    no previous factorization; on exit, lu_matrix and block_perm_array contain the factorization of matrix and
+    //    previous_matrix is a copy of matrix
+    //    the factorization of a pivot only depends on its own row and column and on the factorization of its
+    //    descendants in the elimination tree, so only the pivots of the changed entries and their ancestors are
+    //    factorized again. It falls back to a full factorization if more than half of the pivots are affected, or if
+    //    pivot perturbation is used
+    void refactorize(std::vector<Tensor> const& matrix, std::vector<Tensor>& previous_matrix,
+                     std::vector<Tensor>& lu_matrix, BlockPermArray& block_perm_array,
+                     bool use_pivot_perturbation = false) {
+        bool const incremental = !previous_matrix.empty() && !use_pivot_perturbation && !has_pivot_perturbation_;
+        std::vector<bool> const affected =
+            incremental ? changed_pivots(matrix, previous_matrix) : std::vector<bool>(size_, true);
+        Idx const n_affected = std::ranges::count(affected, true);
+
+        // a failed factorization leaves lu_matrix in an undefined state, so the next one should be a full one
+        previous_matrix.clear();
+        if (!incremental || 2 * n_affected > size_) {
+            lu_matrix = matrix;
+            prefactorize(lu_matrix, block_perm_array, use_pivot_perturbation);
+        } else if (n_affected > 0) {
+            prefactorize_partial(lu_matrix, block_perm_array, matrix, affected);
+        }
+        previous_matrix = matrix;
+    }
+
+    // factorize a matrix for a solver that may factorize a changed matrix again later
+    //    without a previous factorization, matrix is factorized in place and swapped into lu_matrix, leaving matrix
+    //    empty, so that a solver that factorizes once does not keep a copy of its matrix
+    //    once there is a previous factorization, i.e. from the second factorization on, this is refactorize
+    void prefactorize_or_refactorize(std::vector<Tensor>& matrix, std::vector<Tensor>& previous_matrix,
+                                     std::vector<Tensor>& lu_matrix, BlockPermArray& block_perm_array,
+                                     bool use_pivot_perturbation = false) {
+        if (!lu_matrix.empty()) {
+            refactorize(matrix, previous_matrix, lu_matrix, block_perm_array, use_pivot_perturbation);
+            return;
+        }
+        previous_matrix.clear();
+        prefactorize(matrix, block_perm_array, use_pivot_perturbation);
+        lu_matrix.swap(matrix);
+    }
+
+    // the matrices have the same entries, so that they can share a factorization
+    static bool same_matrix(std::vector<Tensor> const& matrix, std::vector<Tensor> const& other_matrix) {
+        return std::ranges::equal(matrix, other_matrix, [](Tensor const& value, Tensor const& other_value) {
+            return !entry_changed(value, other_value);
+        });
+    }
+
+    // number of threads used to factorize and solve
+    //    with more than one thread, the pivots at the same level of the elimination tree are processed concurrently
+    //    the factorized matrix and the solution are the same as with the sequential factorization and solve
+    void set_n_threads(Idx n_threads) { n_threads_ = std::max(n_threads, Idx{1}); }
+    Idx n_threads() const { return n_threads_; }
+
+    // log the number of factorizations, how many of them needed pivot perturbation, and the number of partial
+    // factorizations by refactorize, since the last call
+    void log_factorizations(CalculationInfo& calculation_info) {
+        calculation_info.add(LogEvent::factorizations, static_cast<double>(n_factorizations_));
+        calculation_info.add(LogEvent::pivot_perturbations, static_cast<double>(n_pivot_perturbations_));
+        calculation_info.add(LogEvent::partial_factorizations, static_cast<double>(n_partial_factorizations_));
+        n_factorizations_ = 0;
+        n_pivot_perturbations_ = 0;
+        n_partial_factorizations_ = 0;
+    }
+
+  private:
+    Idx size_;
+    Idx nnz_; // number of non zeroes (in block)
+    std::shared_ptr<IdxVector const> row_indptr_;
+    std::shared_ptr<IdxVector const> col_indices_;
+    std::shared_ptr<IdxVector const> diag_lu_;
+    std::shared_ptr<SparseLUSymbolic const> symbolic_;
+    // cache value for pivot perturbation for the factorize step
+    bool has_pivot_perturbation_{false};
+    double matrix_norm_{};
+    std::optional<std::vector<Tensor>> original_matrix_;
+    // cache value for iterative refinement for the solve step
+    std::optional<std::vector<XVector>> dx_;
+    std::optional<std::vector<RHSVector>> residual_;
+    std::optional<std::vector<RHSVector>> rhs_;
+    // statistics for profiling
+    Idx n_factorizations_{};
+    Idx n_pivot_perturbations_{};
+    Idx n_partial_factorizations_{};
+    // parallel factorization and solve
+    //    levels with fewer pivots per thread are processed sequentially, the work does not outweigh the overhead
+    Idx n_threads_{1};
+    static constexpr Idx min_pivots_per_thread = 32;
+
+    void prefactorize_sequential(std::vector<Tensor>& lu_matrix, BlockPermArray& block_perm_array,
+                                 double perturb_threshold, bool use_pivot_perturbation) {
         // local reference
         auto const& row_indptr = *row_indptr_;
         auto const& col_indices = *col_indices_;
         auto const& diag_lu = *diag_lu_;
-        // lu matrix inplace
-        std::vector<Tensor>& lu_matrix = data;
-
-        // column position idx per row for LU matrix
-        IdxVector col_position_idx(row_indptr.cbegin(), row_indptr.cend() - 1);
+        auto const& transpose_entry = symbolic_->transpose_entry;
+        auto const& update_indptr = symbolic_->update_indptr;
+        auto const& update_target = symbolic_->update_target;
 
         // start pivoting, it is always the diagonal
         for (Idx pivot_row_col = 0; pivot_row_col != size_; ++pivot_row_col) {
             Idx const pivot_idx = diag_lu[pivot_row_col];
 
-            // Dense LU factorize pivot for block matrix in-place
-            // A_pivot,pivot, becomes P_pivot^-1 * L_pivot * U_pivot * Q_pivot^-1
-            // return reference to pivot permutation
-            BlockPerm const& block_perm = [&]() -> std::conditional_t<is_block, BlockPerm const&, BlockPerm> {
-                if constexpr (is_block) {
-                    // use machine precision by default
-                    // record block permutation
-                    LUFactor::factorize_block_in_place(lu_matrix[pivot_idx].matrix(), block_perm_array[pivot_row_col],
-                                                       perturb_threshold, use_pivot_perturbation,
-                                                       has_pivot_perturbation_);
-                    return block_perm_array[pivot_row_col];
-                } else {
-                    if (use_pivot_perturbation) {
-                        // use machine precision by default
-                        // record pivot perturbation
-                        double abs_pivot = cabs(lu_matrix[pivot_idx]);
-                        perturb_pivot_if_needed(perturb_threshold, lu_matrix[pivot_idx], abs_pivot,
-                                                has_pivot_perturbation_);
-                    }
-                    if (!is_normal(lu_matrix[pivot_idx])) {
-                        throw SparseMatrixError{};
-                    }
-                    return {};
-                }
-            }();
+            auto const& block_perm = factorize_pivot(lu_matrix, block_perm_array, pivot_row_col, perturb_threshold,
+                                                     use_pivot_perturbation, has_pivot_perturbation_);
             // reference to pivot
             Tensor const& pivot = lu_matrix[pivot_idx];
 
-            // for block matrix
-            // permute rows of L's in the left of the pivot
-            // L_k,pivot = P_pivot * L_k,pivot    k < pivot
-            // permute columns of U's above the pivot
-            // U_pivot,k = U_pivot,k * Q_pivot    k < pivot
-            if constexpr (is_block) {
-                // loop rows and columns at the same time
-                // since the matrix is symmetric
-                for (Idx l_idx = row_indptr[pivot_row_col]; l_idx < pivot_idx; ++l_idx) {
-                    // permute rows of L_k,pivot
-                    lu_matrix[l_idx] = (block_perm.p * lu_matrix[l_idx].matrix()).array();
-                    // get row and idx of u
-                    Idx const u_row = col_indices[l_idx];
-                    Idx const u_idx = col_position_idx[u_row];
-                    // we should exactly find the current column
-                    assert(col_indices[u_idx] == pivot_row_col);
-                    // permute columns of U_pivot,k
-                    lu_matrix[u_idx] = (lu_matrix[u_idx].matrix() * block_perm.q).array();
-                    // increment column position
-                    ++col_position_idx[u_row];
-                }
-            }
-
-            // for block matrix
-            // calculate U blocks in the right of the pivot, in-place
-            // L_pivot * U_pivot,k = P_pivot * A_pivot,k       k > pivot
-            if constexpr (is_block) {
-                for (Idx u_idx = pivot_idx + 1; u_idx < row_indptr[pivot_row_col + 1]; ++u_idx) {
-                    Tensor& u = lu_matrix[u_idx];
-                    // permutation
-                    u = (block_perm.p * u.matrix()).array();
-                    // forward substitution, per row in u
-                    for (Idx block_row = 0; block_row < block_size; ++block_row) {
-                        for (Idx block_col = 0; block_col < block_row; ++block_col) {
-                            // forward substract
-                            u.row(block_row) -= pivot(block_row, block_col) * u.row(block_col);
-                        }
-                    }
-                }
-            }
+            permute_left_and_above_pivot(lu_matrix, pivot_row_col, block_perm);
+            calculate_u_right_of_pivot(lu_matrix, pivot_row_col, block_perm);
 
             // start to calculate L below the pivot and U at the right of the pivot column
             // because the matrix is symmetric,
             //    looking for col_indices at pivot_row_col, starting from the diagonal (pivot_row_col, pivot_row_col)
             //    we get also the non-zero row indices under the pivot
+            // the entries to update are pre-computed by the symbolic factorization
+            auto update_target_it = update_target.cbegin() + update_indptr[pivot_row_col];
             for (Idx l_ref_idx = pivot_idx + 1; l_ref_idx < row_indptr[pivot_row_col + 1]; ++l_ref_idx) {
                 // find index of l in corresponding row
-                Idx const l_row = col_indices[l_ref_idx];
-                Idx const l_idx = col_position_idx[l_row];
+                Idx const l_idx = transpose_entry[l_ref_idx];
                 // we should exactly find the current column
                 assert(col_indices[l_idx] == pivot_row_col);
                 // calculating l at (l_row, pivot_row_col)
-                if constexpr (is_block) {
-                    // for block matrix
-                    // calculate L blocks below the pivot, in-place
-                    // L_k,pivot * U_pivot = A_k_pivot * Q_pivot    k > pivot
-                    Tensor& l = lu_matrix[l_idx];
-                    // permutation
-                    l = (l.matrix() * block_perm.q).array();
-                    // forward substitution, per column in l
-                    // l0 = [l00, l10]^T
-                    // l1 = [l01, l11]^T
-                    // l = [l0, l1]
-                    // a = [a0, a1]
-                    // u = [[u00, u01]
-                    //      [0  , u11]]
-                    // l * u = a
-                    // l0 * u00 = a0
-                    // l0 * u01 + l1 * u11 = a1
-                    for (Idx block_col = 0; block_col < block_size; ++block_col) {
-                        for (Idx block_row = 0; block_row < block_col; ++block_row) {
-                            l.col(block_col) -= pivot(block_row, block_col) * l.col(block_row);
-                        }
-                        // divide diagonal
-                        l.col(block_col) = l.col(block_col) / pivot(block_col, block_col);
-                    }
-                } else {
-                    // for scalar matrix, just divide
-                    // L_k,pivot = A_k,pivot / U_pivot    k > pivot
-                    lu_matrix[l_idx] = lu_matrix[l_idx] / pivot;
-                }
+                calculate_l_below_pivot(lu_matrix[l_idx], pivot, block_perm);
                 Tensor const& l = lu_matrix[l_idx];
 
                 // for all entries in the right of (l_row, u_col)
                 //       A(l_row, u_col) = A(l_row, u_col) - l * U(pivot_row_col, u_col),
                 //          for u_col > pivot_row_col
                 // it can create fill-ins, but the fill-ins are pre-allocated
-                // it is garanteed to have an entry at (l_row, u_col), if (pivot_row_col, u_col) is non-zero
-                // starting A index from (l_row, pivot_row_col)
-                Idx a_idx = l_idx;
                 // loop all columns in the right of (pivot_row_col, pivot_row_col), at pivot_row
                 for (Idx u_idx = pivot_idx + 1; u_idx < row_indptr[pivot_row_col + 1]; ++u_idx) {
-                    Idx const u_col = col_indices[u_idx];
-                    assert(u_col > pivot_row_col);
-                    // search the a_idx to the u_col,
-                    auto const found = std::lower_bound(col_indices.cbegin() + a_idx,
-                                                        col_indices.cbegin() + row_indptr[l_row + 1], u_col);
-                    // should always found
-                    assert(found != col_indices.cbegin() + row_indptr[l_row + 1]);
-                    assert(*found == u_col);
-                    a_idx = narrow_cast<Idx>(std::distance(col_indices.cbegin(), found));
+                    assert(col_indices[u_idx] > pivot_row_col);
+                    Idx const a_idx = *update_target_it++;
+                    assert(col_indices[a_idx] == col_indices[u_idx]);
                     // subtract
                     lu_matrix[a_idx] -= dot(l, lu_matrix[u_idx]);
                 }
-                // iterate column position
-                ++col_position_idx[l_row];
             }
-            // iterate column position for the pivot
-            ++col_position_idx[pivot_row_col];
+            assert(update_target_it == update_target.cbegin() + update_indptr[pivot_row_col + 1]);
         }
-        // if no pivot perturbation happened, reset cache
-        if (!has_pivot_perturbation_) {
-            reset_matrix_cache();
+    }
+
+    static bool entry_changed(Tensor const& value, Tensor const& previous_value) {
+        if constexpr (is_block) {
+            return (value != previous_value).any();
+        } else {
+            return value != previous_value;
+        }
+    }
+
+    // the pivots of which the row or the column changed, and their ancestors in the elimination tree
+    std::vector<bool> changed_pivots(std::vector<Tensor> const& matrix,
+                                     std::vector<Tensor> const& previous_matrix) const {
+        auto const& row_indptr = *row_indptr_;
+        auto const& col_indices = *col_indices_;
+        auto const& diag_lu = *diag_lu_;
+        assert(matrix.size() == previous_matrix.size());
+
+        std::vector<bool> affected(size_, false);
+        for (Idx row = 0; row != size_; ++row) {
+            for (Idx idx = row_indptr[row]; idx != row_indptr[row + 1]; ++idx) {
+                if (!entry_changed(matrix[idx], previous_matrix[idx])) {
+                    continue;
+                }
+                // the entry belongs to the pivot of its lowest row or column
+                // the ancestors of an affected pivot are affected already
+                Idx pivot = std::min(row, col_indices[idx]);
+                while (!affected[pivot]) {
+                    affected[pivot] = true;
+                    Idx const parent_idx = diag_lu[pivot] + 1;
+                    if (parent_idx == row_indptr[pivot + 1]) {
+                        break;
+                    }
+                    pivot = col_indices[parent_idx];
+                }
+            }
+        }
+        return affected;
+    }
+
+    // factorize the affected pivots again, the factorization of the other pivots is kept
+    //    the affected pivots are closed under ancestors, so every unaffected pivot only depends on unaffected pivots
+    void prefactorize_partial(std::vector<Tensor>& lu_matrix, BlockPermArray& block_perm_array,
+                              std::vector<Tensor> const& matrix, std::vector<bool> const& affected) {
+        auto const& row_indptr = *row_indptr_;
+        auto const& col_indices = *col_indices_;
+        auto const& diag_lu = *diag_lu_;
+        auto const& transpose_entry = symbolic_->transpose_entry;
+
+        // start from the matrix in the rows and columns of the affected pivots
+        //    the entries L(pivot, m) and U(m, pivot) of an unaffected pivot m < pivot are kept, but the permutation
+        //    of the affected pivot is undone, because it is applied again when the pivot is factorized
+        for (Idx pivot_row_col = 0; pivot_row_col != size_; ++pivot_row_col) {
+            if (!affected[pivot_row_col]) {
+                continue;
+            }
+            Idx const pivot_idx = diag_lu[pivot_row_col];
+            if constexpr (is_block) {
+                BlockPerm const& block_perm = block_perm_array[pivot_row_col];
+                for (Idx l_idx = row_indptr[pivot_row_col]; l_idx < pivot_idx; ++l_idx) {
+                    if (!affected[col_indices[l_idx]]) {
+                        Idx const u_idx = transpose_entry[l_idx];
+                        lu_matrix[l_idx] = (block_perm.p.inverse() * lu_matrix[l_idx].matrix()).array();
+                        lu_matrix[u_idx] = (lu_matrix[u_idx].matrix() * block_perm.q.inverse()).array();
+                    }
+                }
+            }
+            for (Idx u_idx = pivot_idx; u_idx < row_indptr[pivot_row_col + 1]; ++u_idx) {
+                lu_matrix[u_idx] = matrix[u_idx];
+                lu_matrix[transpose_entry[u_idx]] = matrix[transpose_entry[u_idx]];
+            }
+        }
+
+        // the left-looking factorization of a pivot only reads its descendants, which are done before
+        for (Idx pivot_row_col = 0; pivot_row_col != size_; ++pivot_row_col) {
+            if (affected[pivot_row_col]) {
+                factorize_pivot_left_looking(lu_matrix, block_perm_array, pivot_row_col, 0.0, false,
+                                             has_pivot_perturbation_);
+            }
+        }
+        ++n_partial_factorizations_;
+    }
+
+    // left-looking variant of the factorization, scheduled per level of the elimination tree
+    //    a pivot only writes to its own row and column, and only reads the rows and columns of its descendants,
+    //    so that the pivots within a level can be processed concurrently
+    //    the updates are applied in the same order as in the sequential factorization
+    void prefactorize_level_scheduled(std::vector<Tensor>& lu_matrix, BlockPermArray& block_perm_array,
+                                      double perturb_threshold, bool use_pivot_perturbation) {
+        for (Idx level = 0; level != symbolic_->n_levels(); ++level) {
+            // the condition check of the pivot blocks only depends on the perturbations in the lower levels,
+            // which keeps the outcome independent of the scheduling within the level
+            bool const lower_levels_perturbed = has_pivot_perturbation_;
+            std::atomic<bool> level_perturbed{false};
+            for_each_pivot_in_level(level, [&](Idx pivot_row_col) {
+                bool has_pivot_perturbation = lower_levels_perturbed;
+                factorize_pivot_left_looking(lu_matrix, block_perm_array, pivot_row_col, perturb_threshold,
+                                             use_pivot_perturbation, has_pivot_perturbation);
+                if (has_pivot_perturbation) {
+                    level_perturbed.store(true, std::memory_order_relaxed);
+                }
+            });
+            has_pivot_perturbation_ = lower_levels_perturbed || level_perturbed.load(std::memory_order_relaxed);
+        }
+    }
+
+    void factorize_pivot_left_looking(std::vector<Tensor>& lu_matrix, BlockPermArray& block_perm_array,
+                                      Idx pivot_row_col, double perturb_threshold, bool use_pivot_perturbation,
+                                      bool& has_pivot_perturbation) const {
+        // local reference
+        auto const& row_indptr = *row_indptr_;
+        auto const& col_indices = *col_indices_;
+        auto const& diag_lu = *diag_lu_;
+        auto const& transpose_entry = symbolic_->transpose_entry;
+        auto const& update_indptr = symbolic_->update_indptr;
+        auto const& update_target = symbolic_->update_target;
+        Idx const pivot_idx = diag_lu[pivot_row_col];
+
+        // gather the updates of all previous pivots m, for which L(pivot_row_col, m) is non-zero, in increasing order
+        for (Idx l_idx = row_indptr[pivot_row_col]; l_idx < pivot_idx; ++l_idx) {
+            Idx const m = col_indices[l_idx];
+            Idx const u_idx = transpose_entry[l_idx];
+            Idx const m_u_begin = diag_lu[m] + 1;
+            Idx const n_u = row_indptr[m + 1] - m_u_begin;
+            Idx const pivot_pos = u_idx - m_u_begin;
+            auto const m_update_target = update_target.cbegin() + update_indptr[m];
+            Tensor const& l = lu_matrix[l_idx];
+            Tensor const& u = lu_matrix[u_idx];
+
+            // A(pivot_row_col, u_col) -= L(pivot_row_col, m) * U(m, u_col)    u_col >= pivot_row_col
+            for (Idx u_pos = pivot_pos; u_pos != n_u; ++u_pos) {
+                Idx const a_idx = m_update_target[pivot_pos * n_u + u_pos];
+                assert(col_indices[a_idx] == col_indices[m_u_begin + u_pos]);
+                lu_matrix[a_idx] -= dot(l, lu_matrix[m_u_begin + u_pos]);
+            }
+            // A(l_row, pivot_row_col) -= L(l_row, m) * U(m, pivot_row_col)    l_row > pivot_row_col
+            for (Idx l_pos = pivot_pos + 1; l_pos != n_u; ++l_pos) {
+                Idx const a_idx = m_update_target[l_pos * n_u + pivot_pos];
+                assert(col_indices[a_idx] == pivot_row_col);
+                lu_matrix[a_idx] -= dot(lu_matrix[transpose_entry[m_u_begin + l_pos]], u);
+            }
+        }
+
+        auto const& block_perm = factorize_pivot(lu_matrix, block_perm_array, pivot_row_col, perturb_threshold,
+                                                 use_pivot_perturbation, has_pivot_perturbation);
+        Tensor const& pivot = lu_matrix[pivot_idx];
+        permute_left_and_above_pivot(lu_matrix, pivot_row_col, block_perm);
+        calculate_u_right_of_pivot(lu_matrix, pivot_row_col, block_perm);
+        for (Idx l_ref_idx = pivot_idx + 1; l_ref_idx < row_indptr[pivot_row_col + 1]; ++l_ref_idx) {
+            calculate_l_below_pivot(lu_matrix[transpose_entry[l_ref_idx]], pivot, block_perm);
+        }
+    }
+
+    // run func(pivot_row_col) for all pivots in the level, concurrently if the level is wide enough
+    template <typename Func> void for_each_pivot_in_level(Idx level, Func const& func) const {
+        auto const& level_indptr = symbolic_->level_indptr;
+        auto const& level_pivots = symbolic_->level_pivots;
+        Idx const level_begin = level_indptr[level];
+        Idx const n_pivots = level_indptr[level + 1] - level_begin;
+        Idx const n_workers = std::min(n_threads_, n_pivots / min_pivots_per_thread);
+
+        if (n_workers <= 1) {
+            for (Idx idx = level_begin; idx != level_begin + n_pivots; ++idx) {
+                func(level_pivots[idx]);
+            }
+            return;
+        }
+        constexpr Idx chunks_per_thread = 4;
+        ChunkCursor chunks{n_pivots, n_pivots / (n_workers * chunks_per_thread)};
+        ThreadPool::global().parallel_run(n_workers, [&](Idx /* worker_idx */) {
+            while (auto const chunk = chunks.next()) {
+                for (Idx const idx : *chunk) {
+                    func(level_pivots[level_begin + idx]);
+                }
+            }
+        });
+    }
+
+    // Dense LU factorize pivot for block matrix in-place
+    // A_pivot,pivot, becomes P_pivot^-1 * L_pivot * U_pivot * Q_pivot^-1
+    // return reference to pivot permutation
+    std::conditional_t<is_block, BlockPerm const&, BlockPerm>
+    factorize_pivot(std::vector<Tensor>& lu_matrix, BlockPermArray& block_perm_array, Idx pivot_row_col,
+                    double perturb_threshold, bool use_pivot_perturbation, bool& has_pivot_perturbation) const {
+        Idx const pivot_idx = (*diag_lu_)[pivot_row_col];
+        if constexpr (is_block) {
+            // use machine precision by default
+            // record block permutation
+            LUFactor::factorize_block_in_place(lu_matrix[pivot_idx].matrix(), block_perm_array[pivot_row_col],
+                                               perturb_threshold, use_pivot_perturbation, has_pivot_perturbation);
+            return block_perm_array[pivot_row_col];
+        } else {
+            if (use_pivot_perturbation) {
+                // use machine precision by default
+                // record pivot perturbation
+                double abs_pivot = cabs(lu_matrix[pivot_idx]);
+                perturb_pivot_if_needed(perturb_threshold, lu_matrix[pivot_idx], abs_pivot, has_pivot_perturbation);
+            }
+            if (!is_normal(lu_matrix[pivot_idx])) {
+                throw SparseMatrixError{};
+            }
+            return {};
+        }
+    }
+
+    // for block matrix
+    // permute rows of L's in the left of the pivot
+    // L_k,pivot = P_pivot * L_k,pivot    k < pivot
+    // permute columns of U's above the pivot
+    // U_pivot,k = U_pivot,k * Q_pivot    k < pivot
+    void permute_left_and_above_pivot(std::vector<Tensor>& lu_matrix, Idx pivot_row_col,
+                                      BlockPerm const& block_perm) const {
+        if constexpr (is_block) {
+            auto const& row_indptr = *row_indptr_;
+            auto const& transpose_entry = symbolic_->transpose_entry;
+            // loop rows and columns at the same time
+            // since the matrix is symmetric
+            for (Idx l_idx = row_indptr[pivot_row_col]; l_idx < (*diag_lu_)[pivot_row_col]; ++l_idx) {
+                // permute rows of L_k,pivot
+                lu_matrix[l_idx] = (block_perm.p * lu_matrix[l_idx].matrix()).array();
+                // get idx of u
+                Idx const u_idx = transpose_entry[l_idx];
+                // we should exactly find the current column
+                assert((*col_indices_)[u_idx] == pivot_row_col);
+                // permute columns of U_pivot,k
+                lu_matrix[u_idx] = (lu_matrix[u_idx].matrix() * block_perm.q).array();
+            }
+        } else {
+            capturing::into_the_void(lu_matrix, pivot_row_col, block_perm);
+        }
+    }
+
+    // for block matrix
+    // calculate U blocks in the right of the pivot, in-place
+    // L_pivot * U_pivot,k = P_pivot * A_pivot,k       k > pivot
+    void calculate_u_right_of_pivot(std::vector<Tensor>& lu_matrix, Idx pivot_row_col,
+                                    BlockPerm const& block_perm) const {
+        if constexpr (is_block) {
+            Idx const pivot_idx = (*diag_lu_)[pivot_row_col];
+            Tensor const& pivot = lu_matrix[pivot_idx];
+            for (Idx u_idx = pivot_idx + 1; u_idx < (*row_indptr_)[pivot_row_col + 1]; ++u_idx) {
+                Tensor& u = lu_matrix[u_idx];
+                // permutation
+                u = (block_perm.p * u.matrix()).array();
+                // forward substitution, per row in u
+                for (Idx block_row = 0; block_row < block_size; ++block_row) {
+                    for (Idx block_col = 0; block_col < block_row; ++block_col) {
+                        // forward substract
+                        u.row(block_row) -= pivot(block_row, block_col) * u.row(block_col);
+                    }
+                }
+            }
+        } else {
+            capturing::into_the_void(lu_matrix, pivot_row_col, block_perm);
+        }
+    }
+
+    // calculate a single L entry below the pivot, in-place
+    static void calculate_l_below_pivot(Tensor& l, Tensor const& pivot, BlockPerm const& block_perm) {
+        if constexpr (is_block) {
+            // for block matrix
+            // calculate L blocks below the pivot, in-place
+            // L_k,pivot * U_pivot = A_k_pivot * Q_pivot    k > pivot
+            // permutation
+            l = (l.matrix() * block_perm.q).array();
+            // forward substitution, per column in l
+            // l0 = [l00, l10]^T
+            // l1 = [l01, l11]^T
+            // l = [l0, l1]
+            // a = [a0, a1]
+            // u = [[u00, u01]
+            //      [0  , u11]]
+            // l * u = a
+            // l0 * u00 = a0
+            // l0 * u01 + l1 * u11 = a1
+            for (Idx block_col = 0; block_col < block_size; ++block_col) {
+                for (Idx block_row = 0; block_row < block_col; ++block_row) {
+                    l.col(block_col) -= pivot(block_row, block_col) * l.col(block_row);
+                }
+                // divide diagonal
+                l.col(block_col) = l.col(block_col) / pivot(block_col, block_col);
+            }
+        } else {
+            // for scalar matrix, just divide
+            // L_k,pivot = A_k,pivot / U_pivot    k > pivot
+            capturing::into_the_void(block_perm);
+            l = l / pivot;
         }
     }
 
-  private:
-    Idx size_;
-    Idx nnz_; // number of non zeroes (in block)
-    std::shared_ptr<IdxVector const> row_indptr_;
-    std::shared_ptr<IdxVector const> col_indices_;
-    std::shared_ptr<IdxVector const> diag_lu_;
-    // cache value for pivot perturbation for the factorize step
-    bool has_pivot_perturbation_{false};
-    double matrix_norm_{};
-    std::optional<std::vector<Tensor>> original_matrix_;
-    // cache value for iterative refinement for the solve step
-    std::optional<std::vector<XVector>> dx_;
-    std::optional<std::vector<RHSVector>> residual_;
-    std::optional<std::vector<RHSVector>> rhs_;
 
     void solve_with_refinement(std::vector<Tensor> const& data,        // pre-factoirzed data, const ref
                                BlockPermArray const& block_perm_array, // pre-calculated permutation, const ref
@@ -568,36 +1014,80 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
         original_matrix_.reset();
     }
 
+    // solve the n_rhs right hand sides of a panel, stored row by row, see solve_panel_with_prefactorized_matrix
     void solve_once(std::vector<Tensor> const& data,        // pre-factoirzed data, const ref
                     BlockPermArray const& block_perm_array, // pre-calculated permutation, const ref
-                    std::vector<RHSVector> const& rhs, std::vector<XVector>& x) const {
-        // local reference
+                    std::vector<RHSVector> const& rhs, std::vector<XVector>& x, Idx n_rhs = 1) const {
+        auto const& lu_matrix = data;
+
+        if (n_threads_ > 1) {
+            // a row only depends on the rows of its descendants in forward substitution,
+            // and on the rows of its ancestors in backward substitution
+            Idx const n_levels = symbolic_->n_levels();
+            for (Idx level = 0; level != n_levels; ++level) {
+                for_each_pivot_in_level(
+                    level, [&](Idx row) { forward_substitute(lu_matrix, block_perm_array, rhs, x, row, n_rhs); });
+            }
+            for (Idx level = n_levels - 1; level != -1; --level) {
+                for_each_pivot_in_level(level, [&](Idx row) { backward_substitute(lu_matrix, x, row, n_rhs); });
+            }
+        } else {
+            // forward substitution with L
+            for (Idx row = 0; row != size_; ++row) {
+                forward_substitute(lu_matrix, block_perm_array, rhs, x, row, n_rhs);
+            }
+            // backward substitution with U
+            for (Idx row = size_ - 1; row != -1; --row) {
+                backward_substitute(lu_matrix, x, row, n_rhs);
+            }
+        }
+        // restore permutation for block matrix
+        if constexpr (is_block) {
+            for (Idx row = 0; row != size_; ++row) {
+                for (Idx k = row * n_rhs; k != (row + 1) * n_rhs; ++k) {
+                    x[k] = (block_perm_array[row].q * x[k].matrix()).array();
+                }
+            }
+        }
+    }
+
+    void forward_substitute(std::vector<Tensor> const& lu_matrix, BlockPermArray const& block_perm_array,
+                            std::vector<RHSVector> const& rhs, std::vector<XVector>& x, Idx row,
+                            Idx n_rhs = 1) const {
         auto const& row_indptr = *row_indptr_;
         auto const& col_indices = *col_indices_;
         auto const& diag_lu = *diag_lu_;
-        auto const& lu_matrix = data;
+        Idx const row_begin = row * n_rhs;
+        Idx const row_end = row_begin + n_rhs;
 
-        // forward substitution with L
-        for (Idx row = 0; row != size_; ++row) {
-            // permutation if needed
-            if constexpr (is_block) {
-                x[row] = (block_perm_array[row].p * rhs[row].matrix()).array();
-            } else {
-                x[row] = rhs[row];
+        // permutation if needed
+        if constexpr (is_block) {
+            for (Idx k = row_begin; k != row_end; ++k) {
+                x[k] = (block_perm_array[row].p * rhs[k].matrix()).array();
             }
+        } else {
+            capturing::into_the_void(block_perm_array);
+            for (Idx k = row_begin; k != row_end; ++k) {
+                x[k] = rhs[k];
+            }
+        }
 
-            // loop all columns until diagonal
-            for (Idx l_idx = row_indptr[row]; l_idx < diag_lu[row]; ++l_idx) {
-                Idx const col = col_indices[l_idx];
-                // never overshoot
-                assert(col < row);
-                // forward subtract
-                x[row] -= dot(lu_matrix[l_idx], x[col]);
+        // loop all columns until diagonal
+        for (Idx l_idx = row_indptr[row]; l_idx < diag_lu[row]; ++l_idx) {
+            Idx const col = col_indices[l_idx];
+            // never overshoot
+            assert(col < row);
+            // forward subtract
+            Tensor const& l = lu_matrix[l_idx];
+            for (Idx k = 0; k != n_rhs; ++k) {
+                x[row_begin + k] -= dot(l, x[col * n_rhs + k]);
             }
-            // forward substitution inside block, for block matrix
-            if constexpr (is_block) {
-                XVector& xb = x[row];
-                Tensor const& pivot = lu_matrix[diag_lu[row]];
+        }
+        // forward substitution inside block, for block matrix
+        if constexpr (is_block) {
+            Tensor const& pivot = lu_matrix[diag_lu[row]];
+            for (Idx k = row_begin; k != row_end; ++k) {
+                XVector& xb = x[k];
                 for (Idx br = 0; br < block_size; ++br) {
                     for (Idx bc = 0; bc < br; ++bc) {
                         xb(br) -= pivot(br, bc) * xb(bc);
@@ -605,22 +1095,57 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
                 }
             }
         }
+    }
+
+    // the rows on the paths from the given rows to the root of the elimination tree, in increasing order
+    //    the parent of a row is the first column right of the diagonal
+    IdxVector elimination_tree_paths(IdxVector const& rows) const {
+        auto const& row_indptr = *row_indptr_;
+        auto const& col_indices = *col_indices_;
+        auto const& diag_lu = *diag_lu_;
+
+        IdxVector result;
+        for (Idx row : rows) {
+            while (true) {
+                result.push_back(row);
+                Idx const parent_idx = diag_lu[row] + 1;
+                if (parent_idx == row_indptr[row + 1]) {
+                    break;
+                }
+                row = col_indices[parent_idx];
+            }
+        }
+        std::ranges::sort(result);
+        auto const [first, last] = std::ranges::unique(result);
+        result.erase(first, last);
+        return result;
+    }
 
-        // backward substitution with U
-        for (Idx row = size_ - 1; row != -1; --row) {
-            // loop all columns from diagonal
-            for (Idx u_idx = row_indptr[row + 1] - 1; u_idx > diag_lu[row]; --u_idx) {
-                Idx const col = col_indices[u_idx];
-                // always in upper diagonal
-                assert(col > row);
-                // backward subtract
-                x[row] -= dot(lu_matrix[u_idx], x[col]);
+    void backward_substitute(std::vector<Tensor> const& lu_matrix, std::vector<XVector>& x, Idx row,
+                             Idx n_rhs = 1) const {
+        auto const& row_indptr = *row_indptr_;
+        auto const& col_indices = *col_indices_;
+        auto const& diag_lu = *diag_lu_;
+        Idx const row_begin = row * n_rhs;
+        Idx const row_end = row_begin + n_rhs;
+
+        // loop all columns from diagonal
+        for (Idx u_idx = row_indptr[row + 1] - 1; u_idx > diag_lu[row]; --u_idx) {
+            Idx const col = col_indices[u_idx];
+            // always in upper diagonal
+            assert(col > row);
+            // backward subtract
+            Tensor const& u = lu_matrix[u_idx];
+            for (Idx k = 0; k != n_rhs; ++k) {
+                x[row_begin + k] -= dot(u, x[col * n_rhs + k]);
             }
-            // solve the diagonal pivot
+        }
+        // solve the diagonal pivot
+        Tensor const& pivot = lu_matrix[diag_lu[row]];
+        for (Idx k = row_begin; k != row_end; ++k) {
             if constexpr (is_block) {
                 // backward substitution inside block
-                XVector& xb = x[row];
-                Tensor const& pivot = lu_matrix[diag_lu[row]];
+                XVector& xb = x[k];
                 for (Idx br = block_size - 1; br != -1; --br) {
                     for (Idx bc = block_size - 1; bc > br; --bc) {
                         xb(br) -= pivot(br, bc) * xb(bc);
@@ -628,13 +1153,7 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
                     xb(br) = xb(br) / pivot(br, br);
                 }
             } else {
-                x[row] = x[row] / lu_matrix[diag_lu[row]];
-            }
-        }
-        // restore permutation for block matrix
-        if constexpr (is_block) {
-            for (Idx row = 0; row != size_; ++row) {
-                x[row] = (block_perm_array[row].q * x[row].matrix()).array();
+                x[k] = x[k] / pivot;
             }
         }
     }
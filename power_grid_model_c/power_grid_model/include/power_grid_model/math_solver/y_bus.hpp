@@ -4,11 +4,14 @@
 
 #pragma once
 
+#include "sparse_lu_solver.hpp"
+
 #include "../calculation_parameters.hpp"
 #include "../common/common.hpp"
 #include "../common/three_phase_tensor.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <numeric>
 #include <ranges>
@@ -66,6 +69,36 @@ inline void counting_sort_element(std::vector<YBusElementMap>& vec, Idx n_bus) {
     }
 }
 
+// build the map from branch or shunt parameter index to the y bus entries the parameter contributes to
+inline void build_param_entry_map(std::vector<YBusElement> const& y_bus_element, IdxVector const& y_bus_entry_indptr,
+                                  bool is_shunt, Idx n_param, IdxVector& param_entry_indptr,
+                                  IdxVector& param_entries) {
+    std::vector<IdxVector> entries_per_param(n_param);
+    for (Idx entry = 0; entry != static_cast<Idx>(y_bus_entry_indptr.size()) - 1; ++entry) {
+        for (Idx element = y_bus_entry_indptr[entry]; element != y_bus_entry_indptr[entry + 1]; ++element) {
+            if ((y_bus_element[element].element_type == YBusElementType::shunt) != is_shunt) {
+                continue;
+            }
+            auto& param_entries_single = entries_per_param[y_bus_element[element].idx];
+            // entries are visited in ascending order, duplicates are adjacent
+            if (param_entries_single.empty() || param_entries_single.back() != entry) {
+                param_entries_single.push_back(entry);
+            }
+        }
+    }
+    param_entry_indptr.resize(n_param + 1);
+    param_entry_indptr[0] = 0;
+    for (Idx param = 0; param != n_param; ++param) {
+        param_entry_indptr[param + 1] =
+            param_entry_indptr[param] + static_cast<Idx>(entries_per_param[param].size());
+    }
+    param_entries.clear();
+    param_entries.reserve(param_entry_indptr.back());
+    for (auto const& param_entries_single : entries_per_param) {
+        param_entries.insert(param_entries.end(), param_entries_single.cbegin(), param_entries_single.cend());
+    }
+}
+
 // y bus structure
 struct YBusStructure {
     // csr structure
@@ -96,6 +129,14 @@ struct YBusStructure {
     // for lu_transpose_entry[i] indicates the position i-th element in transposed lu matrix in CSR form
     // for entry in the diagonal lu_transpose_entry[i] = i
     IdxVector lu_transpose_entry;
+    // symbolic LU factorization of the LU structure, shared by all sparse solvers of this structure
+    SparseLUSymbolic lu_symbolic;
+    // map from branch/shunt parameters to the y bus entries they contribute to
+    // the entries of parameter i are param_entries[param_entry_indptr[i]:param_entry_indptr[i + 1]]
+    IdxVector branch_param_entry_indptr;
+    IdxVector branch_param_entries;
+    IdxVector shunt_param_entry_indptr;
+    IdxVector shunt_param_entries;
 
     // construct ybus structure
     explicit YBusStructure(MathModelTopology const& topo) {
@@ -271,6 +312,14 @@ struct YBusStructure {
             lu_transpose_entry[entry_1] = entry_2;
             lu_transpose_entry[entry_2] = entry_1;
         }
+
+        lu_symbolic = SparseLUSymbolic{row_indptr_lu, col_indices_lu, diag_lu};
+
+        // construct the map from parameters to entries
+        build_param_entry_map(y_bus_element, y_bus_entry_indptr, false, n_branch, branch_param_entry_indptr,
+                              branch_param_entries);
+        build_param_entry_map(y_bus_element, y_bus_entry_indptr, true, topo.n_shunt(), shunt_param_entry_indptr,
+                              shunt_param_entries);
     }
 };
 
@@ -293,6 +342,31 @@ template <symmetry_tag sym> class YBus {
         update_admittance(param);
     }
 
+    // the registered callbacks belong to the solvers of the original, they are not copied
+    YBus(YBus const& other)
+        : y_bus_struct_{other.y_bus_struct_},
+          admittance_{other.admittance_},
+          math_topology_{other.math_topology_},
+          math_model_param_{other.math_model_param_},
+          branch_param_idx_{other.branch_param_idx_},
+          shunt_param_idx_{other.shunt_param_idx_} {}
+    YBus& operator=(YBus const& other) {
+        if (this != &other) {
+            y_bus_struct_ = other.y_bus_struct_;
+            admittance_ = other.admittance_;
+            math_topology_ = other.math_topology_;
+            math_model_param_ = other.math_model_param_;
+            owned_math_model_param_.reset();
+            branch_param_idx_ = other.branch_param_idx_;
+            shunt_param_idx_ = other.shunt_param_idx_;
+            parameters_changed_callbacks_.clear();
+        }
+        return *this;
+    }
+    YBus(YBus&& other) noexcept = default;
+    YBus& operator=(YBus&& other) noexcept = default;
+    ~YBus() = default;
+
     // getter
     YBusStructure const& y_bus_structure() const { return *y_bus_struct_; }
     Idx size() const { return static_cast<Idx>(bus_entry().size()); }
@@ -308,7 +382,7 @@ template <symmetry_tag sym> class YBus {
     MathModelTopology const& math_topology() const { return *math_topology_; }
     MathModelParam<sym> const& math_model_param() const { return *math_model_param_; }
 
-    ComplexTensorVector<sym> const& admittance() const { return admittance_; }
+    ComplexTensorVector<sym> const& admittance() const { return *admittance_; }
     IdxVector const& bus_entry() const { return y_bus_struct_->bus_entry; }
     IdxVector const& lu_diag() const { return y_bus_struct_->diag_lu; }
     IdxVector const& map_lu_y_bus() const { return y_bus_struct_->map_lu_y_bus; }
@@ -323,6 +397,9 @@ template <symmetry_tag sym> class YBus {
         return {y_bus_struct_, &y_bus_struct_->col_indices_lu};
     }
     std::shared_ptr<IdxVector const> shared_diag_lu() const { return {y_bus_struct_, &y_bus_struct_->diag_lu}; }
+    std::shared_ptr<SparseLUSymbolic const> shared_lu_symbolic() const {
+        return {y_bus_struct_, &y_bus_struct_->lu_symbolic};
+    }
 
     constexpr auto& get_y_bus_structure() const { return y_bus_struct_; }
 
@@ -334,8 +411,11 @@ template <symmetry_tag sym> class YBus {
     void update_admittance(std::shared_ptr<MathModelParam<sym> const> const& math_model_param) {
         // overwrite the old cached parameters
         math_model_param_ = math_model_param;
+        if (owned_math_model_param_ != math_model_param_) {
+            owned_math_model_param_.reset();
+        }
         // construct admittance data
-        admittance_ = ComplexTensorVector<sym>(nnz());
+        auto admittance = std::make_shared<ComplexTensorVector<sym>>(nnz());
 
         auto const& branch_param = math_model_param_->branch_param;
         auto const& shunt_param = math_model_param_->shunt_param;
@@ -345,45 +425,44 @@ template <symmetry_tag sym> class YBus {
         for (Idx entry = 0; entry != nnz(); ++entry) {
             // start admittance accumulation with zero
             ComplexTensor<sym> entry_admittance{0.0};
-            IdxVector entry_param_shunt;
-            IdxVector entry_param_branch;
             // loop over all entries of this position
             for (Idx element = y_bus_entry_indptr[entry]; element != y_bus_entry_indptr[entry + 1]; ++element) {
                 auto param_idx = y_bus_element[element].idx;
                 if (y_bus_element[element].element_type == YBusElementType::shunt) {
                     entry_admittance += shunt_param[param_idx];
-                    entry_param_shunt.push_back(param_idx);
                 } else {
                     entry_admittance +=
                         branch_param[param_idx].value[static_cast<Idx>(y_bus_element[element].element_type)];
-                    entry_param_branch.push_back(param_idx);
                 }
             }
             // assign
-            admittance_[entry] = entry_admittance;
-            map_admittance_param_branch_.push_back(entry_param_branch);
-            map_admittance_param_shunt_.push_back(entry_param_shunt);
+            (*admittance)[entry] = entry_admittance;
         }
+        admittance_ = std::move(admittance);
 
         parameters_changed(true);
     }
 
-    IdxVector increments_to_entries(auto const& math_model_param_incrmt) {
-        // construct affected entries
+    // sorted list of the y bus entries affected by the changed parameters
+    IdxVector increments_to_entries(MathModelParamIncrement const& math_model_param_incrmt) const {
         IdxVector affected_entries;
 
-        auto query_params_in_map = [&affected_entries](auto const& params_to_change, auto const& mapping) {
-            for (size_t i = 0; i < mapping.size(); ++i) {
-                if (std::ranges::any_of(mapping[i], [&](Idx val) {
-                        return std::ranges::find(params_to_change, val) != params_to_change.end();
-                    })) {
-                    affected_entries.push_back(static_cast<int>(i));
-                }
+        auto const add_entries = [&affected_entries](IdxVector const& params_to_change, IdxVector const& indptr,
+                                                     IdxVector const& entries) {
+            for (Idx const param : params_to_change) {
+                affected_entries.insert(affected_entries.end(), entries.cbegin() + indptr[param],
+                                        entries.cbegin() + indptr[param + 1]);
             }
         };
 
-        query_params_in_map(math_model_param_incrmt.branch_param_to_change, map_admittance_param_branch_);
-        query_params_in_map(math_model_param_incrmt.shunt_param_to_change, map_admittance_param_shunt_);
+        add_entries(math_model_param_incrmt.branch_param_to_change, y_bus_struct_->branch_param_entry_indptr,
+                    y_bus_struct_->branch_param_entries);
+        add_entries(math_model_param_incrmt.shunt_param_to_change, y_bus_struct_->shunt_param_entry_indptr,
+                    y_bus_struct_->shunt_param_entries);
+
+        std::ranges::sort(affected_entries);
+        auto const duplicates = std::ranges::unique(affected_entries);
+        affected_entries.erase(duplicates.begin(), duplicates.end());
         return affected_entries;
     }
 
@@ -397,12 +476,23 @@ template <symmetry_tag sym> class YBus {
                                      MathModelParamIncrement const& math_model_param_incrmt) {
         // swap the old cached parameters
         math_model_param_ = math_model_param;
+        if (owned_math_model_param_ != math_model_param_) {
+            owned_math_model_param_.reset();
+        }
 
         auto const& y_bus_element = y_bus_struct_->y_bus_element;
         auto const& y_bus_entry_indptr = y_bus_struct_->y_bus_entry_indptr;
         auto const& math_param_shunt = math_model_param_->shunt_param;
         auto const& math_param_branch = math_model_param_->branch_param;
 
+        // the admittance data may still be shared with copies of this y bus
+        if (admittance_.use_count() > 1) {
+            admittance_ = std::make_shared<ComplexTensorVector<sym>>(*admittance_);
+        } else {
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        auto& admittance = *admittance_;
+
         // process and update affected entries
         for (auto const affected_entries = increments_to_entries(math_model_param_incrmt);
              auto const entry : affected_entries) {
@@ -420,12 +510,29 @@ template <symmetry_tag sym> class YBus {
                 }
             }
             // assign
-            admittance_[entry] = entry_admittance;
+            admittance[entry] = entry_admittance;
         }
 
         parameters_changed(true);
     }
 
+    // the cached parameters to change in place, followed by update_admittance_increment of the changed parameters
+    //    they are copied once if they are shared, e.g. with copies of this y bus, or were given to this y bus
+    MathModelParam<sym>& math_model_param_to_update() {
+        if (owned_math_model_param_ == nullptr || owned_math_model_param_.use_count() > 2) {
+            owned_math_model_param_ = std::make_shared<MathModelParam<sym>>(*math_model_param_);
+            math_model_param_ = owned_math_model_param_;
+        } else {
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return *owned_math_model_param_;
+    }
+
+    // update the admittance of the entries affected by the parameters changed through math_model_param_to_update
+    void update_admittance_increment(MathModelParamIncrement const& math_model_param_incrmt) {
+        update_admittance_increment(math_model_param_, math_model_param_incrmt);
+    }
+
     ComplexValue<sym> calculate_injection(ComplexValueVector<sym> const& u, Idx bus_number) const {
         Idx const begin = row_indptr()[bus_number];
         Idx const end = row_indptr()[bus_number + 1];
@@ -517,23 +624,21 @@ template <symmetry_tag sym> class YBus {
     // csr structure
     std::shared_ptr<YBusStructure const> y_bus_struct_;
 
-    // admittance
-    ComplexTensorVector<sym> admittance_;
+    // admittance, shared with copies of this y bus until it is modified
+    std::shared_ptr<ComplexTensorVector<sym>> admittance_;
 
     // cache math topology
     std::shared_ptr<MathModelTopology const> math_topology_;
 
     // cache the math parameters
     std::shared_ptr<MathModelParam<sym> const> math_model_param_;
+    // the same parameters if this y bus made them itself, so they can be changed in place when not shared
+    std::shared_ptr<MathModelParam<sym>> owned_math_model_param_;
 
     // cache the branch and shunt parameters in sequence_idx_map
     IdxVector branch_param_idx_;
     IdxVector shunt_param_idx_;
 
-    // map index between admittance entries and parameter entries
-    std::vector<IdxVector> map_admittance_param_branch_;
-    std::vector<IdxVector> map_admittance_param_shunt_;
-
     std::unordered_map<uint64_t, ParamChangedCallback> parameters_changed_callbacks_;
 
     void parameters_changed(bool param_changed) const {
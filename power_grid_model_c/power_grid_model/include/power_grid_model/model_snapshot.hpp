@@ -0,0 +1,343 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// binary snapshot of a model, to restore a ready to calculate model without parsing the input data and without
+// building the topology of the math models
+
+#include "all_components.hpp"
+#include "calculation_parameters.hpp"
+#include "main_model.hpp"
+
+#include "auxiliary/dataset.hpp"
+#include "auxiliary/meta_data.hpp"
+#include "auxiliary/serialization/memory_mapped_file.hpp"
+#include "common/common.hpp"
+#include "common/exception.hpp"
+#include "main_core/state.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace power_grid_model {
+
+// The snapshot contains, in the native byte order and with every item aligned to model_snapshot_alignment:
+//     header:   magic, format version, data layout of the platform and system frequency
+//     input:    per component the name, the size of an element and the rows of the input data
+//     topology: the math model topologies, including the fill-in of the sparse matrices, and the coupling between
+//               the components and the math models
+// A snapshot can only be restored by a library with the same format version on a platform with the same data layout.
+// The rows of the input data are used in place from the memory mapped file.
+constexpr std::array<char, 8> model_snapshot_magic{'P', 'G', 'M', 'S', 'N', 'A', 'P', '\0'};
+constexpr uint64_t model_snapshot_version = 1;
+constexpr size_t model_snapshot_alignment = 16;
+
+namespace detail {
+
+// fixed size values, to detect a different data layout, e.g. byte order or size of the indices
+struct ModelSnapshotLayout {
+    uint32_t byte_order_mark{0x01020304};
+    uint32_t idx_size{sizeof(Idx)};
+    uint32_t id_size{sizeof(ID)};
+    uint32_t int_s_size{sizeof(IntS)};
+
+    bool operator==(ModelSnapshotLayout const&) const = default;
+};
+
+// number of bytes to skip after an item of the given size to align the next item
+constexpr size_t snapshot_padding(size_t size) {
+    return (model_snapshot_alignment - size % model_snapshot_alignment) % model_snapshot_alignment;
+}
+
+template <typename T>
+concept snapshot_value_c = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>;
+
+class ModelSnapshotWriter {
+  public:
+    explicit ModelSnapshotWriter(std::filesystem::path const& file_path)
+        : file_path_{file_path}, file_{file_path, std::ios::binary | std::ios::trunc} {
+        check("open");
+    }
+
+    template <snapshot_value_c T> void write(T const& value) { write_bytes(&value, sizeof(T)); }
+    template <snapshot_value_c T> void write(std::span<T const> values) { write_elements(values); }
+    template <snapshot_value_c T> void write(std::vector<T> const& values) { write(std::span<T const>{values}); }
+    void write(std::string_view value) { write(std::span<char const>{value}); }
+    // rows of input data, in the same layout as the buffers of a dataset
+    template <typename T> void write_elements(std::span<T const> values) {
+        write(static_cast<Idx>(values.size()));
+        write_bytes(values.data(), values.size_bytes());
+    }
+
+    // grouped index vectors are stored as the group of each element
+    template <grouped_idx_vector_type GroupedIdxVector> void write_grouped(GroupedIdxVector const& values) {
+        IdxVector groups(values.element_size());
+        for (Idx element = 0; element != values.element_size(); ++element) {
+            groups[element] = values.get_group(element);
+        }
+        write(values.size());
+        write(groups);
+    }
+
+    void close() {
+        file_.close();
+        check("write");
+    }
+
+  private:
+    std::filesystem::path file_path_;
+    std::ofstream file_;
+    size_t offset_{};
+
+    void write_bytes(void const* data, size_t size) {
+        static constexpr std::array<char, model_snapshot_alignment> padding{};
+        file_.write(static_cast<char const*>(data), static_cast<std::streamsize>(size));
+        offset_ += size;
+        auto const n_padding = snapshot_padding(offset_);
+        file_.write(padding.data(), static_cast<std::streamsize>(n_padding));
+        offset_ += n_padding;
+        check("write");
+    }
+
+    void check(char const* action) const {
+        if (!file_) {
+            throw SerializationError{"Cannot " + std::string{action} + " file: " + file_path_.string() + "\n"};
+        }
+    }
+};
+
+class ModelSnapshotReader {
+  public:
+    explicit ModelSnapshotReader(std::span<char const> data) : data_{data} {}
+
+    template <snapshot_value_c T> T read() {
+        T value;
+        std::memcpy(&value, read_bytes(sizeof(T)), sizeof(T));
+        return value;
+    }
+    // the elements are not copied, the pointer is aligned to model_snapshot_alignment
+    template <typename T> std::pair<Idx, char const*> read_elements(size_t element_size = sizeof(T)) {
+        auto const size = read<Idx>();
+        if (size < 0 || std::cmp_greater(size, remaining() / std::max(element_size, size_t{1}))) {
+            throw_truncated();
+        }
+        return {size, read_bytes(static_cast<size_t>(size) * element_size)};
+    }
+    template <snapshot_value_c T> std::vector<T> read_vector() {
+        auto const [size, data] = read_elements<T>();
+        std::vector<T> values(size);
+        std::memcpy(values.data(), data, values.size() * sizeof(T));
+        return values;
+    }
+    std::string_view read_string() {
+        auto const [size, data] = read_elements<char>();
+        return {data, static_cast<size_t>(size)};
+    }
+    template <grouped_idx_vector_type GroupedIdxVector> GroupedIdxVector read_grouped() {
+        auto const n_groups = read<Idx>();
+        auto groups = read_vector<Idx>();
+        if (n_groups < 0 || !std::ranges::is_sorted(groups) ||
+            (!groups.empty() && (groups.front() < 0 || groups.back() >= n_groups))) {
+            throw SerializationError{"The model snapshot is corrupted!\n"};
+        }
+        return GroupedIdxVector{from_dense, std::move(groups), n_groups};
+    }
+
+    size_t remaining() const { return data_.size() - offset_; }
+
+  private:
+    std::span<char const> data_;
+    size_t offset_{};
+
+    char const* read_bytes(size_t size) {
+        if (size > remaining()) {
+            throw_truncated();
+        }
+        char const* const result = data_.data() + offset_;
+        offset_ += std::min(size + snapshot_padding(size), remaining());
+        return result;
+    }
+
+    [[noreturn]] static void throw_truncated() { throw SerializationError{"The model snapshot is truncated!\n"}; }
+};
+
+template <class... ComponentType>
+void write_snapshot_input(ModelSnapshotWriter& writer, ConstDataset const& input_data,
+                          ComponentList<ComponentType...> /* components */) {
+    auto const write_component = [&writer, &input_data]<typename CT>() {
+        using InputType = typename CT::InputType;
+        if (input_data.find_component(CT::name, false) < 0) {
+            return;
+        }
+        writer.write(std::string_view{CT::name});
+        writer.write(static_cast<Idx>(sizeof(InputType)));
+        if (input_data.is_columnar(CT::name)) {
+            auto const elements = input_data.get_columnar_buffer_span<meta_data::input_getter_s, CT>(0);
+            std::vector<InputType> const rows(elements.begin(), elements.end());
+            writer.write_elements(std::span<InputType const>{rows});
+        } else {
+            writer.write_elements(
+                std::span<InputType const>{input_data.get_buffer_span<meta_data::input_getter_s, CT>(0)});
+        }
+    };
+    Idx const n_components =
+        (Idx{0} + ... + static_cast<Idx>(input_data.find_component(ComponentType::name, false) >= 0));
+    writer.write(n_components);
+    (write_component.template operator()<ComponentType>(), ...);
+}
+
+inline void write_snapshot_topology(ModelSnapshotWriter& writer, main_core::MathTopologyCache const& topology) {
+    writer.write(static_cast<Idx>(topology.math_topology.size()));
+    for (auto const& math_topology_ptr : topology.math_topology) {
+        MathModelTopology const& math_topology = *math_topology_ptr;
+        writer.write(math_topology.slack_bus);
+        writer.write(static_cast<IntS>(math_topology.is_radial));
+        writer.write(math_topology.phase_shift);
+        writer.write(math_topology.branch_bus_idx);
+        writer.write(math_topology.fill_in);
+        writer.write_grouped(math_topology.sources_per_bus);
+        writer.write_grouped(math_topology.shunts_per_bus);
+        writer.write_grouped(math_topology.load_gens_per_bus);
+        writer.write(math_topology.load_gen_type);
+        writer.write_grouped(math_topology.voltage_sensors_per_bus);
+        writer.write_grouped(math_topology.power_sensors_per_source);
+        writer.write_grouped(math_topology.power_sensors_per_load_gen);
+        writer.write_grouped(math_topology.power_sensors_per_shunt);
+        writer.write_grouped(math_topology.power_sensors_per_branch_from);
+        writer.write_grouped(math_topology.power_sensors_per_branch_to);
+        writer.write_grouped(math_topology.power_sensors_per_bus);
+        writer.write_grouped(math_topology.current_sensors_per_branch_from);
+        writer.write_grouped(math_topology.current_sensors_per_branch_to);
+        writer.write_grouped(math_topology.tap_regulators_per_branch);
+    }
+    TopologicalComponentToMathCoupling const& coupling = *topology.topo_comp_coup;
+    writer.write(coupling.node);
+    writer.write(coupling.branch);
+    writer.write(coupling.branch3);
+    writer.write(coupling.shunt);
+    writer.write(coupling.load_gen);
+    writer.write(coupling.source);
+    writer.write(coupling.voltage_sensor);
+    writer.write(coupling.power_sensor);
+    writer.write(coupling.current_sensor);
+    writer.write(coupling.regulator);
+}
+
+inline main_core::MathTopologyCache read_snapshot_topology(ModelSnapshotReader& reader) {
+    auto const n_math_topologies = reader.read<Idx>();
+    if (n_math_topologies < 0 || std::cmp_greater(n_math_topologies, reader.remaining())) {
+        throw SerializationError{"The model snapshot is corrupted!\n"};
+    }
+    main_core::MathTopologyCache topology;
+    topology.math_topology.reserve(n_math_topologies);
+    for (Idx idx = 0; idx != n_math_topologies; ++idx) {
+        MathModelTopology math_topology;
+        math_topology.slack_bus = reader.read<Idx>();
+        auto const is_radial = reader.read<IntS>();
+        if (is_radial != 0 && is_radial != 1) {
+            throw SerializationError{"The model snapshot is corrupted!\n"};
+        }
+        math_topology.is_radial = is_radial != 0;
+        math_topology.phase_shift = reader.read_vector<double>();
+        math_topology.branch_bus_idx = reader.read_vector<BranchIdx>();
+        math_topology.fill_in = reader.read_vector<BranchIdx>();
+        math_topology.sources_per_bus = reader.read_grouped<DenseGroupedIdxVector>();
+        math_topology.shunts_per_bus = reader.read_grouped<DenseGroupedIdxVector>();
+        math_topology.load_gens_per_bus = reader.read_grouped<SparseGroupedIdxVector>();
+        math_topology.load_gen_type = reader.read_vector<LoadGenType>();
+        math_topology.voltage_sensors_per_bus = reader.read_grouped<DenseGroupedIdxVector>();
+        math_topology.power_sensors_per_source = reader.read_grouped<DenseGroupedIdxVector>();
+        math_topology.power_sensors_per_load_gen = reader.read_grouped<DenseGroupedIdxVector>();
+        math_topology.power_sensors_per_shunt = reader.read_grouped<DenseGroupedIdxVector>();
+        math_topology.power_sensors_per_branch_from = reader.read_grouped<DenseGroupedIdxVector>();
+        math_topology.power_sensors_per_branch_to = reader.read_grouped<DenseGroupedIdxVector>();
+        math_topology.power_sensors_per_bus = reader.read_grouped<DenseGroupedIdxVector>();
+        math_topology.current_sensors_per_branch_from = reader.read_grouped<DenseGroupedIdxVector>();
+        math_topology.current_sensors_per_branch_to = reader.read_grouped<DenseGroupedIdxVector>();
+        math_topology.tap_regulators_per_branch = reader.read_grouped<DenseGroupedIdxVector>();
+        topology.math_topology.push_back(std::make_shared<MathModelTopology const>(std::move(math_topology)));
+    }
+    TopologicalComponentToMathCoupling coupling;
+    coupling.node = reader.read_vector<Idx2D>();
+    coupling.branch = reader.read_vector<Idx2D>();
+    coupling.branch3 = reader.read_vector<Idx2DBranch3>();
+    coupling.shunt = reader.read_vector<Idx2D>();
+    coupling.load_gen = reader.read_vector<Idx2D>();
+    coupling.source = reader.read_vector<Idx2D>();
+    coupling.voltage_sensor = reader.read_vector<Idx2D>();
+    coupling.power_sensor = reader.read_vector<Idx2D>();
+    coupling.current_sensor = reader.read_vector<Idx2D>();
+    coupling.regulator = reader.read_vector<Idx2D>();
+    topology.topo_comp_coup = std::make_shared<TopologicalComponentToMathCoupling const>(std::move(coupling));
+    return topology;
+}
+
+} // namespace detail
+
+// write the snapshot of the model constructed from the input data, including the topology of its math models
+//    the input data can be row based or columnar
+inline void save_model_snapshot(std::filesystem::path const& file_path, double system_frequency,
+                                ConstDataset const& input_data, MathSolverDispatcher const& math_solver_dispatcher) {
+    MainModel model{system_frequency, input_data, math_solver_dispatcher};
+    auto const topology = model.math_topology();
+
+    detail::ModelSnapshotWriter writer{file_path};
+    writer.write(model_snapshot_magic);
+    writer.write(model_snapshot_version);
+    writer.write(detail::ModelSnapshotLayout{});
+    writer.write(system_frequency);
+    detail::write_snapshot_input(writer, input_data, AllComponents{});
+    detail::write_snapshot_topology(writer, topology);
+    writer.close();
+}
+
+// restore the model of a snapshot, the topology of the math models is not built again
+inline MainModel load_model_snapshot(std::filesystem::path const& file_path, meta_data::MetaData const& meta_data,
+                                     MathSolverDispatcher const& math_solver_dispatcher) {
+    meta_data::MemoryMappedFile const mapped_file{file_path};
+    detail::ModelSnapshotReader reader{mapped_file.span()};
+    if (reader.remaining() < sizeof(model_snapshot_magic) ||
+        reader.read<std::array<char, 8>>() != model_snapshot_magic) {
+        throw SerializationError{"The file is not a model snapshot: " + file_path.string() + "\n"};
+    }
+    if (auto const version = reader.read<uint64_t>(); version != model_snapshot_version) {
+        throw SerializationError{"The model snapshot has format version " + std::to_string(version) +
+                                 ", which is not supported by this version of the library!\n"};
+    }
+    if (reader.read<detail::ModelSnapshotLayout>() != detail::ModelSnapshotLayout{}) {
+        throw SerializationError{"The model snapshot was written on a platform with a different data layout!\n"};
+    }
+    auto const system_frequency = reader.read<double>();
+
+    // the input dataset points to the rows in the memory mapped file
+    ConstDataset input_data{false, 1, "input", meta_data};
+    auto const n_components = reader.read<Idx>();
+    for (Idx idx = 0; idx != n_components; ++idx) {
+        std::string const component{reader.read_string()};
+        auto const element_size = reader.read<Idx>();
+        if (std::cmp_not_equal(element_size, input_data.dataset().get_component(component).size)) {
+            throw SerializationError{"The model snapshot has a different layout of the input of " + component +
+                                     "!\n"};
+        }
+        auto const [n_elements, data] = reader.read_elements<char>(static_cast<size_t>(element_size));
+        input_data.add_buffer(component, n_elements, n_elements, nullptr, data);
+    }
+    MainModel model{system_frequency, input_data, math_solver_dispatcher};
+    model.restore_math_topology(detail::read_snapshot_topology(reader));
+    return model;
+}
+
+} // namespace power_grid_model
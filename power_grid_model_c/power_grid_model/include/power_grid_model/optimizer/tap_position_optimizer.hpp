@@ -20,7 +20,9 @@
 #include <boost/graph/compressed_sparse_row_graph.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <queue>
@@ -417,12 +419,26 @@ constexpr IntS one_step_control_voltage_down(transformer_c auto const& transform
     return one_step_tap_up(transformer);
 }
 
+// the transformer is looked up in the component storage on every access instead of being referenced directly,
+// because the tap position updates may copy the copy-on-write storage page of the transformer
+template <transformer_c TransformerType> class TransformerGetter {
+  public:
+    using Storage = container_impl::CopyOnWriteVector<TransformerType>;
+
+    TransformerGetter(Storage const& storage, Idx pos) : storage_{&storage}, pos_{pos} {}
+
+    TransformerType const& operator()() const { return (*storage_)[pos_]; }
+
+  private:
+    Storage const* storage_;
+    Idx pos_;
+};
+
 template <transformer_c... TransformerTypes> class TransformerWrapper {
   public:
     template <transformer_c TransformerType>
-    TransformerWrapper(std::reference_wrapper<const TransformerType> transformer, Idx2D const& index,
-                       Idx topology_index)
-        : transformer_{std::move(transformer)}, index_{index}, topology_index_{topology_index} {}
+    TransformerWrapper(TransformerGetter<TransformerType> transformer, Idx2D const& index, Idx topology_index)
+        : transformer_{transformer}, index_{index}, topology_index_{topology_index} {}
 
     constexpr auto index() const { return index_; }
     constexpr auto topology_index() const { return topology_index_; }
@@ -450,11 +466,11 @@ template <transformer_c... TransformerTypes> class TransformerWrapper {
     template <typename Func>
         requires(std::invocable<Func, TransformerTypes const&> && ...)
     auto apply(Func const& func) const {
-        return std::visit([&func](auto const& t) { return func(t.get()); }, transformer_);
+        return std::visit([&func](auto const& t) { return func(t()); }, transformer_);
     }
 
   private:
-    std::variant<std::reference_wrapper<const TransformerTypes>...> transformer_;
+    std::variant<TransformerGetter<TransformerTypes>...> transformer_;
 
     Idx2D index_;
     Idx topology_index_;
@@ -471,7 +487,7 @@ template <transformer_c... TransformerTypes> struct TapRegulatorRef {
 
 template <typename State>
     requires main_core::component_container_c<typename State::ComponentContainer, TransformerTapRegulator>
-TransformerTapRegulator const& find_regulator(State const& state, ID regulated_object) {
+Idx find_regulator_idx(State const& state, ID regulated_object) {
     auto const regulators = get_component_citer<TransformerTapRegulator>(state);
 
     auto result_it = std::ranges::find_if(regulators, [regulated_object](auto const& regulator) {
@@ -479,7 +495,7 @@ TransformerTapRegulator const& find_regulator(State const& state, ID regulated_o
     });
     assert(result_it != regulators.end());
 
-    return *result_it;
+    return narrow_cast<Idx>(std::ranges::distance(regulators.begin(), result_it));
 }
 
 template <typename... Ts> struct transformer_types_s;
@@ -503,58 +519,113 @@ template <typename... Ts> using transformer_types_t = typename transformer_types
 
 template <transformer_c... TransformerTypes, typename State>
     requires(main_core::component_container_c<typename State::ComponentContainer, TransformerTypes> && ...)
-inline TapRegulatorRef<TransformerTypes...> regulator_mapping(State const& state, Idx2D const& transformer_index) {
+inline TapRegulatorRef<TransformerTypes...> regulator_mapping(State const& state, Idx2D const& transformer_index,
+                                                              Idx regulator_idx) {
     using ResultType = TapRegulatorRef<TransformerTypes...>;
     using IsType = bool (*)(Idx2D const&);
-    using TransformerMapping = ResultType (*)(State const&, Idx2D const&);
+    using TransformerMapping = ResultType (*)(State const&, Idx2D const&, Idx);
 
     constexpr auto n_types = sizeof...(TransformerTypes);
     constexpr auto is_type = std::array<IsType, n_types>{[](Idx2D const& index) {
         constexpr auto group_idx = State::ComponentContainer::template get_type_idx<TransformerTypes>();
         return index.group == group_idx;
     }...};
-    constexpr auto transformer_mappings =
-        std::array<TransformerMapping, n_types>{[](State const& state_, Idx2D const& transformer_index_) {
+    constexpr auto transformer_mappings = std::array<TransformerMapping, n_types>{
+        [](State const& state_, Idx2D const& transformer_index_, Idx regulator_idx_) {
             auto const& transformer = get_component<TransformerTypes>(state_, transformer_index_);
-            auto const& regulator = find_regulator(state_, transformer.id());
+            auto const& regulator =
+                main_core::get_component_by_sequence<TransformerTapRegulator>(state_, regulator_idx_);
 
+            assert(regulator.regulated_object() == transformer.id());
             assert(transformer.status(transformer.tap_side()));
             assert(transformer.status(static_cast<typename TransformerTypes::SideType>(regulator.control_side())));
 
             auto const topology_index = get_topology_index<TransformerTypes>(state_, transformer_index_);
+            TransformerGetter<TransformerTypes> const get_transformer{
+                state_.components.template storage<TransformerTypes>(), transformer_index_.pos};
             return ResultType{.regulator = std::cref(regulator),
-                              .transformer = {std::cref(transformer), transformer_index_, topology_index}};
+                              .transformer = {get_transformer, transformer_index_, topology_index}};
         }...};
 
     for (Idx idx = 0; idx < static_cast<Idx>(n_types); ++idx) {
         if (is_type[idx](transformer_index)) {
-            return transformer_mappings[idx](state, transformer_index);
+            return transformer_mappings[idx](state, transformer_index, regulator_idx);
         }
     }
     throw UnreachableHit{"TapPositionOptimizer::regulator_mapping", "Transformer must be regulated"};
 }
 
+// sequence index of the regulator of a regulated transformer
 template <transformer_c... TransformerTypes, typename State>
     requires(main_core::component_container_c<typename State::ComponentContainer, TransformerTypes> && ...)
-inline auto regulator_mapping(State const& state, std::vector<Idx2D> const& order) {
-    std::vector<TapRegulatorRef<TransformerTypes...>> result;
-    result.reserve(order.size());
+inline Idx find_regulator_idx(State const& state, Idx2D const& transformer_index) {
+    using IsType = bool (*)(Idx2D const&);
+    using TransformerId = ID (*)(State const&, Idx2D const&);
 
-    for (auto const& index : order) {
-        result.push_back(regulator_mapping<TransformerTypes...>(state, index));
+    constexpr auto n_types = sizeof...(TransformerTypes);
+    constexpr auto is_type = std::array<IsType, n_types>{[](Idx2D const& index) {
+        constexpr auto group_idx = State::ComponentContainer::template get_type_idx<TransformerTypes>();
+        return index.group == group_idx;
+    }...};
+    constexpr auto transformer_ids =
+        std::array<TransformerId, n_types>{[](State const& state_, Idx2D const& transformer_index_) {
+            return get_component<TransformerTypes>(state_, transformer_index_).id();
+        }...};
+
+    for (Idx idx = 0; idx < static_cast<Idx>(n_types); ++idx) {
+        if (is_type[idx](transformer_index)) {
+            return find_regulator_idx(state, transformer_ids[idx](state, transformer_index));
+        }
     }
+    throw UnreachableHit{"TapPositionOptimizer::find_regulator_idx", "Transformer must be regulated"};
+}
 
-    return result;
+// ranked regulated transformers and the sequence indices of their regulators
+//    the order only depends on the statuses of the components and on the regulators, so that it can be reused by
+//    calculations in which only the other attributes change, like the scenarios of most batches
+struct RegulatorOrder {
+    RankedTransformerGroups transformers;
+    std::vector<std::vector<Idx>> regulators;
+};
+
+// order of the last optimization, shared read-only by the copies of a model, e.g. the threads of a batch calculation
+using RegulatorOrderCache = std::shared_ptr<RegulatorOrder const>;
+
+template <transformer_c... TransformerTypes, typename State>
+    requires(main_core::component_container_c<typename State::ComponentContainer, TransformerTypes> && ...)
+inline auto get_regulator_order(State const& state, RankedTransformerGroups transformers) -> RegulatorOrder {
+    std::vector<std::vector<Idx>> regulators;
+    regulators.reserve(transformers.size());
+
+    for (auto const& sub_order : transformers) {
+        auto& sub_regulators = regulators.emplace_back();
+        sub_regulators.reserve(sub_order.size());
+        for (auto const& index : sub_order) {
+            sub_regulators.push_back(find_regulator_idx<TransformerTypes...>(state, index));
+        }
+    }
+
+    return {.transformers = std::move(transformers), .regulators = std::move(regulators)};
 }
 
 template <transformer_c... TransformerTypes, typename State>
     requires(main_core::component_container_c<typename State::ComponentContainer, TransformerTypes> && ...)
-inline auto regulator_mapping(State const& state, RankedTransformerGroups const& order) {
+inline auto regulator_mapping(State const& state, RegulatorOrder const& order) {
+    assert(order.transformers.size() == order.regulators.size());
+
     std::vector<std::vector<TapRegulatorRef<TransformerTypes...>>> result;
-    result.reserve(order.size());
+    result.reserve(order.transformers.size());
 
-    for (auto const& sub_order : order) {
-        result.push_back(regulator_mapping<TransformerTypes...>(state, sub_order));
+    for (Idx rank = 0; rank != std::ssize(order.transformers); ++rank) {
+        auto const& sub_order = order.transformers[rank];
+        auto const& sub_regulators = order.regulators[rank];
+        assert(sub_order.size() == sub_regulators.size());
+
+        auto& sub_result = result.emplace_back();
+        sub_result.reserve(sub_order.size());
+        for (Idx idx = 0; idx != std::ssize(sub_order); ++idx) {
+            sub_result.push_back(regulator_mapping<TransformerTypes...>(state, sub_order[idx], sub_regulators[idx]));
+        }
     }
 
     return result;
@@ -656,10 +727,13 @@ template <symmetry_tag sym> struct NodeState {
     ComplexValue<sym> u;
     ComplexValue<sym> i;
 
+    double compensated_voltage(TransformerTapRegulatorCalcParam const& param) const {
+        auto const u_compensated = u + param.z_compensation * i;
+        return mean_val(cabs(u_compensated)); // TODO(mgovers): handle asym correctly
+    }
+
     friend auto operator<=>(NodeState<sym> const& state, TransformerTapRegulatorCalcParam const& param) {
-        auto const u_compensated = state.u + param.z_compensation * state.i;
-        auto const v_compensated = mean_val(cabs(u_compensated)); // TODO(mgovers): handle asym correctly
-        return v_compensated <=> VoltageBand{.u_set = param.u_set, .u_band = param.u_band};
+        return state.compensated_voltage(param) <=> VoltageBand{.u_set = param.u_set, .u_band = param.u_band};
     }
 };
 
@@ -843,6 +917,41 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         bool control_at_tap_side_{false}; // regulator control side is at tap side
     };
     std::vector<std::vector<BinarySearch>> binary_search_;
+
+    // prediction of the tap position at which the voltage at the control side is at the set point
+    //    the sensitivity of the voltage to the tap position is measured from the power flows of the last two tap
+    //    positions, which includes the effect of the loading of the grid
+    //    without a measurement, or if the prediction is not towards the voltage band, one step is taken, as in the
+    //    linear search
+    class SensitivitySearch {
+      public:
+        IntS propose_tap(IntS tap_pos, IntS tap_min, IntS tap_max, IntS one_step_tap, double voltage, double u_set) {
+            IntS result = one_step_tap;
+            if (measured_ && tap_pos != last_tap_) {
+                double const sensitivity = (voltage - last_voltage_) / static_cast<double>(tap_pos - last_tap_);
+                if (std::isfinite(sensitivity) && sensitivity != 0.0) {
+                    auto const predicted =
+                        std::clamp(std::round(tap_pos + ((u_set - voltage) / sensitivity)),
+                                   static_cast<double>(std::min(tap_min, tap_max)),
+                                   static_cast<double>(std::max(tap_min, tap_max)));
+                    if ((predicted - tap_pos) * (one_step_tap - tap_pos) > 0.0) {
+                        result = static_cast<IntS>(predicted);
+                    }
+                }
+            }
+            measured_ = true;
+            last_tap_ = tap_pos;
+            last_voltage_ = voltage;
+            return result;
+        }
+
+      private:
+        bool measured_{false};
+        IntS last_tap_{};
+        double last_voltage_{};
+    };
+    std::vector<std::vector<SensitivitySearch>> sensitivity_search_;
+
     struct BinarySearchOptions {
         bool strategy_max{false};
         Idx2D idx_bs{.group = 0, .pos = 0};
@@ -852,19 +961,26 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
   public:
     TapPositionOptimizerImpl(Calculator calculator, StateUpdater updater, OptimizerStrategy strategy,
                              meta_data::MetaData const& meta_data,
-                             std::optional<SearchMethod> tap_search = std::nullopt)
-        : meta_data_{&meta_data}, calculate_{std::move(calculator)}, update_{std::move(updater)}, strategy_{strategy} {
+                             std::optional<SearchMethod> tap_search = std::nullopt,
+                             RegulatorOrderCache* regulator_order_cache = nullptr)
+        : meta_data_{&meta_data},
+          calculate_{std::move(calculator)},
+          update_{std::move(updater)},
+          strategy_{strategy},
+          regulator_order_cache_{regulator_order_cache} {
         auto const is_supported = [&strategy](std::optional<SearchMethod> const& search) {
             if (!search) {
                 return true;
             }
             switch (strategy) {
             case OptimizerStrategy::any:
-                return search == SearchMethod::linear_search;
+                return search == SearchMethod::linear_search || search == SearchMethod::sensitivity_search;
             case OptimizerStrategy::fast_any:
-                return search == SearchMethod::binary_search;
+                return search == SearchMethod::binary_search || search == SearchMethod::sensitivity_search;
             default:
-                return true;
+                // the exploitation of the neighborhood only finds the extreme tap position from the boundary of the
+                // voltage band
+                return search != SearchMethod::sensitivity_search;
             }
         };
 
@@ -894,15 +1010,15 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
     }
 
     auto optimize(State const& state, CalculationMethod method) -> MathOutput<ResultType> final {
-        auto const order = regulator_mapping<TransformerTypes...>(state, TransformerRanker{}(state));
+        auto const order = regulator_mapping<TransformerTypes...>(state, *get_regulator_order(state));
         auto const cache = cache_states(order);
         try {
             opt_prep(order);
             auto result = optimize(state, order, method);
-            update_state(cache);
+            update_state(changed_states(cache, order));
             return result;
         } catch (...) {
-            update_state(cache);
+            update_state(changed_states(cache, order));
             throw;
         }
     }
@@ -911,12 +1027,26 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
     Idx get_total_iterations() const { return total_iterations; }
 
   private:
+    // the ranking of the transformers is only done if the cache, if any, is empty
+    RegulatorOrderCache get_regulator_order(State const& state) const {
+        if (regulator_order_cache_ != nullptr && *regulator_order_cache_ != nullptr) {
+            return *regulator_order_cache_;
+        }
+        auto result = std::make_shared<RegulatorOrder const>(
+            tap_position_optimizer::get_regulator_order<TransformerTypes...>(state, TransformerRanker{}(state)));
+        if (regulator_order_cache_ != nullptr) {
+            *regulator_order_cache_ = result;
+        }
+        return result;
+    }
+
     void opt_prep(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
         constexpr auto tap_pos_range_cmp = [](RegulatedTransformer const& a, RegulatedTransformer const& b) {
             return a.transformer.tap_range() < b.transformer.tap_range();
         };
 
         bs_prep(regulator_order);
+        ss_prep(regulator_order);
 
         if (max_tap_ranges_per_rank.empty()) {
             max_tap_ranges_per_rank.reserve(regulator_order.size());
@@ -947,6 +1077,18 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         }
     }
 
+    void ss_prep(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
+        if (tap_search_ != SearchMethod::sensitivity_search) {
+            return;
+        }
+
+        sensitivity_search_.clear();
+        sensitivity_search_.reserve(regulator_order.size());
+        for (auto const& same_rank_regulators : regulator_order) {
+            sensitivity_search_.emplace_back(same_rank_regulators.size());
+        }
+    }
+
     auto optimize(State const& state, std::vector<std::vector<RegulatedTransformer>> const& regulator_order,
                   CalculationMethod method) -> MathOutput<ResultType> {
         pilot_run(regulator_order);
@@ -1043,6 +1185,8 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
             return adjust_transformer_bs(regulator, state, solver_output, update_data, options);
         case SearchMethod::linear_search:
             return adjust_transformer_scan(regulator, state, solver_output, update_data);
+        case SearchMethod::sensitivity_search:
+            return adjust_transformer_ss(regulator, state, solver_output, update_data, options);
         default:
             throw MissingCaseForEnumError{"TapPositionOptimizer::adjust_transformer", search};
         }
@@ -1094,6 +1238,42 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         return tap_changed;
     }
 
+    bool adjust_transformer_ss(RegulatedTransformer const& regulator, State const& state,
+                               ResultType const& solver_output, UpdateBuffer& update_data,
+                               BinarySearchOptions const& options) {
+        bool tap_changed = false;
+        auto& current_ss = sensitivity_search_[options.idx_bs.group][options.idx_bs.pos];
+
+        regulator.transformer.apply([&](transformer_c auto const& transformer) {
+            using TransformerType = std::remove_cvref_t<decltype(transformer)>;
+            if (!is_regulated_transformer_connected<TransformerType>(regulator, state)) {
+                return;
+            }
+
+            auto [node_state, param] = compute_node_state_and_param<TransformerType>(regulator, state, solver_output);
+
+            bool const control_at_tap_side = regulator.control_at_tap_side();
+
+            auto const cmp = node_state <=> param;
+            if (cmp == 0) { // NOLINT(modernize-use-nullptr)
+                return;
+            }
+            IntS const one_step_tap = cmp > 0 // NOLINT(modernize-use-nullptr)
+                                          ? one_step_control_voltage_down(transformer, control_at_tap_side)
+                                          : one_step_control_voltage_up(transformer, control_at_tap_side);
+            IntS const new_tap_pos =
+                current_ss.propose_tap(transformer.tap_pos(), transformer.tap_min(), transformer.tap_max(),
+                                       one_step_tap, node_state.compensated_voltage(param), param.u_set);
+
+            if (new_tap_pos != transformer.tap_pos()) {
+                add_tap_pos_update(new_tap_pos, transformer, update_data);
+                tap_changed = true;
+            }
+        });
+
+        return tap_changed;
+    }
+
     bool adjust_transformer_bs(RegulatedTransformer const& regulator, State const& state,
                                ResultType const& solver_output, UpdateBuffer& update_data,
                                BinarySearchOptions const& options) {
@@ -1266,7 +1446,10 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
 
         auto const get_update = [to_new_tap_pos_func = std::move(to_new_tap_pos),
                                  &update_data](transformer_c auto const& transformer, bool control_at_tap_side) {
-            add_tap_pos_update(to_new_tap_pos_func(transformer, control_at_tap_side), transformer, update_data);
+            if (IntS const new_tap_pos = to_new_tap_pos_func(transformer, control_at_tap_side);
+                new_tap_pos != transformer.tap_pos()) {
+                add_tap_pos_update(new_tap_pos, transformer, update_data);
+            }
         };
 
         for (auto const& sub_order : regulator_order) {
@@ -1306,6 +1489,30 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         return result;
     }
 
+    // the cached states of the transformers whose tap position has changed since caching
+    //    the other transformers are not updated, so that their storage stays shared with the base model in a batch
+    static UpdateBuffer changed_states(UpdateBuffer const& cache,
+                                       std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
+        UpdateBuffer result;
+        std::array<size_t, sizeof...(TransformerTypes)> cache_positions{};
+
+        auto const restore_transformer = [&cache, &result, &cache_positions](transformer_c auto const& transformer) {
+            using TransformerType = std::remove_cvref_t<decltype(transformer)>;
+            auto const& cached = get<TransformerType>(cache)[cache_positions[transformer_index_of<TransformerType>]++];
+            if (cached.tap_pos != transformer.tap_pos()) {
+                get<TransformerType>(result).push_back(cached);
+            }
+        };
+
+        for (auto const& same_rank_regulators : regulator_order) {
+            for (auto const& regulator_index : same_rank_regulators) {
+                regulator_index.transformer.apply(restore_transformer);
+            }
+        }
+
+        return result;
+    }
+
     template <transformer_c T> static std::vector<typename T::UpdateType>& get(UpdateBuffer& update_data) {
         return std::get<transformer_index_of<T>>(update_data);
     }
@@ -1336,6 +1543,7 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
     StateUpdater update_;
     OptimizerStrategy strategy_;
     SearchMethod tap_search_;
+    RegulatorOrderCache* regulator_order_cache_;
 };
 
 template <typename StateCalculator, typename StateUpdater, main_core::main_model_state_c State,
@@ -9,211 +9,463 @@
 #include <algorithm>
 #include <cassert>
 #include <compare>
+#include <functional>
 #include <map>
-#include <set>
+#include <numeric>
 #include <utility>
 #include <vector>
 
 namespace power_grid_model {
 
 namespace detail {
+// vertex with the minimum degree, ties are broken by the smallest vertex
+//    the lookup is a binary heap of (degree, vertex) pairs with lazy deletion:
+//    an update pushes a new pair, outdated pairs are discarded when they reach the top
 class DegreeLookup {
   public:
-    void set(Idx u, Idx degree) {
-        if (auto degree_it = vertex_to_degree.find(u); degree_it != vertex_to_degree.end()) {
-            remove_degree(u, degree_it->second);
-            degree_it->second = degree;
-        } else {
-            vertex_to_degree.try_emplace(u, degree);
-        }
-        degrees_to_vertex[degree].insert(u);
-    }
+    explicit DegreeLookup(Idx n_vertices) : degree_(n_vertices, removed) {}
 
-    void erase(Idx u) {
-        auto vertex_it = vertex_to_degree.find(u);
-        if (vertex_it == vertex_to_degree.end()) {
-            return;
-        }
-        Idx const degree = vertex_it->second;
-        vertex_to_degree.erase(vertex_it);
-        remove_degree(u, degree);
+    void set(Idx u, Idx degree) {
+        degree_[u] = degree;
+        heap_.emplace_back(degree, u);
+        std::ranges::push_heap(heap_, std::greater<>{});
     }
 
-    friend auto min_element(DegreeLookup const& dgd);
+    void erase(Idx u) { degree_[u] = removed; }
 
-  private:
-    void remove_degree(Idx u, Idx degree) {
-        if (auto degree_it = degrees_to_vertex.find(degree); degree_it != degrees_to_vertex.end()) {
-            degree_it->second.erase(u);
-            if (degree_it->second.empty()) {
-                degrees_to_vertex.erase(degree_it);
+    Idx min_element() {
+        while (true) {
+            assert(!heap_.empty());
+            if (auto const [degree, u] = heap_.front(); degree_[u] == degree) {
+                return u;
             }
+            std::ranges::pop_heap(heap_, std::greater<>{});
+            heap_.pop_back();
         }
     }
 
-    std::map<Idx, Idx> vertex_to_degree;
-    std::map<Idx, std::set<Idx>> degrees_to_vertex;
+  private:
+    static constexpr Idx removed = -1;
+
+    IdxVector degree_;
+    std::vector<std::pair<Idx, Idx>> heap_;
 };
 
-inline auto min_element(DegreeLookup const& dgd) {
-    Idx const vertex = *dgd.degrees_to_vertex.begin()->second.begin();
-    return dgd.vertex_to_degree.find(vertex);
+inline bool in_graph(std::pair<Idx, Idx> const& e, std::map<Idx, IdxVector> const& d) {
+    auto edges_it = d.find(e.first);
+    return edges_it != d.cend() && std::ranges::find(edges_it->second, e.second) != edges_it->second.cend();
 }
 
-inline void remove_element_degree(Idx u, DegreeLookup& dgd) { dgd.erase(u); }
-
-inline void set_element_degree(Idx u, Idx degree, DegreeLookup& dgd) { dgd.set(u, degree); }
-
-inline Idx num_adjacent(Idx const u, std::map<Idx, IdxVector> const& d) {
-    if (auto it = d.find(u); it != d.end()) {
-        return static_cast<Idx>(it->second.size());
+// graph under elimination, the vertices are numbered 0 .. n_vertices - 1
+//    a vertex without neighbours is dropped from the graph, it is added again when it gets a fill-in
+class EliminationGraph {
+  public:
+    explicit EliminationGraph(std::vector<IdxVector> adjacency)
+        : adjacency_{std::move(adjacency)},
+          in_graph_(adjacency_.size(), 1),
+          n_in_graph_{static_cast<Idx>(adjacency_.size())},
+          marker_(adjacency_.size(), -1) {}
+
+    Idx n_vertices() const { return static_cast<Idx>(adjacency_.size()); }
+    Idx size() const { return n_in_graph_; }
+    IdxVector const& adj(Idx u) const { return adjacency_[u]; }
+    Idx first() const {
+        return static_cast<Idx>(std::distance(in_graph_.cbegin(), std::ranges::find(in_graph_, 1)));
     }
-    return 0;
-}
 
-inline IdxVector const& adj(Idx const u, std::map<Idx, IdxVector> const& d) { return d.at(u); }
+    // eliminate u together with its indistinguishable neighbours, i.e. the neighbours v with adj(v) + v == adj(u) + u
+    //    the remaining neighbours form a clique afterwards, the missing edges are the fill-ins
+    // return the eliminated neighbours
+    IdxVector eliminate(Idx u, DegreeLookup& dgd, std::vector<std::pair<Idx, Idx>>& fills) {
+        assert(in_graph_[u]);
+        IdxVector nbs = adjacency_[u];
+        IdxVector rl = indistinguishable(u);
+        IdxVector alpha = rl;
+
+        rl.push_back(u);
+        for (Idx const uu : rl) {
+            if (uu != u) {
+                std::erase(nbs, uu);
+            }
+            dgd.erase(uu);
+            for (Idx const e : adjacency_[uu]) {
+                auto& adjacents = adjacency_[e];
+                std::erase(adjacents, uu);
+                if (adjacents.empty()) {
+                    remove(e);
+                }
+            }
+            adjacency_[uu].clear();
+            remove(uu);
+        }
 
-inline std::vector<std::pair<Idx, DegreeLookup>> comp_size_degrees_graph(std::map<Idx, IdxVector> const& d) {
-    DegreeLookup dd;
-    IdxVector v;
+        // the clique is completed in ascending vertex order, the neighbours of a vertex in the original order
+        IdxVector sorted_nbs = nbs;
+        std::ranges::sort(sorted_nbs);
+        for (Idx const k : sorted_nbs) {
+            for (Idx const e : nbs) {
+                if (e != k && std::ranges::find(adjacency_[k], e) == adjacency_[k].cend()) {
+                    add_edge(k, e);
+                    fills.emplace_back(k, e);
+                }
+            }
+        }
 
-    for (auto const& [k, adjacent] : d) {
-        v.push_back(k);
-        set_element_degree(k, static_cast<Idx>(adjacent.size()), dd);
+        for (Idx const e : nbs) {
+            dgd.set(e, static_cast<Idx>(adjacency_[e].size()));
+        }
+        return alpha;
     }
 
-    return {{d.size(), dd}};
-}
+  private:
+    std::vector<IdxVector> adjacency_;
+    std::vector<char> in_graph_;
+    Idx n_in_graph_;
+    IdxVector marker_;
+
+    IdxVector indistinguishable(Idx u) {
+        auto const& nbs = adjacency_[u];
+        marker_[u] = u;
+        for (Idx const v : nbs) {
+            marker_[v] = u;
+        }
+        IdxVector rl;
+        for (Idx const v : nbs) {
+            auto const& adjacents = adjacency_[v];
+            if (adjacents.size() == nbs.size() &&
+                std::ranges::all_of(adjacents, [this, u, v](Idx w) { return w != v && marker_[w] == u; })) {
+                rl.push_back(v);
+            }
+        }
+        return rl;
+    }
 
-inline std::map<Idx, IdxVector> make_clique(IdxVector& l) {
-    std::map<Idx, IdxVector> d;
+    void add_edge(Idx k, Idx e) {
+        for (Idx const vertex : {k, e}) {
+            if (!in_graph_[vertex]) {
+                in_graph_[vertex] = 1;
+                ++n_in_graph_;
+            }
+        }
+        adjacency_[k].push_back(e);
+        adjacency_[e].push_back(k);
+    }
 
-    for (Idx i = 0; i < static_cast<Idx>(l.size()); i++) {
-        IdxVector sl(l.size() - 1);
-        std::copy(l.begin(), l.begin() + i, sl.begin());
-        std::copy(l.begin() + i + 1, l.end(), sl.begin() + i);
-        d[l[i]] = std::move(sl);
+    void remove(Idx u) {
+        if (in_graph_[u]) {
+            in_graph_[u] = 0;
+            --n_in_graph_;
+        }
     }
+};
 
-    return d;
-}
+// minimum degree ordering of the graph with vertices 0 .. n_vertices - 1
+//    the adjacency lists must be symmetric, sorted and without duplicates
+inline std::pair<IdxVector, std::vector<std::pair<Idx, Idx>>>
+minimum_degree_elimination(std::vector<IdxVector> adjacency) {
+    EliminationGraph graph{std::move(adjacency)};
+    Idx const n = graph.n_vertices();
+
+    DegreeLookup dgd{n};
+    for (Idx u = 0; u != n; ++u) {
+        dgd.set(u, static_cast<Idx>(graph.adj(u).size()));
+    }
 
-inline std::vector<std::pair<IdxVector, IdxVector>> check_indistguishable(Idx const u,
-                                                                          std::map<Idx, IdxVector> const& d) {
-    IdxVector rl;
+    IdxVector alpha;
+    std::vector<std::pair<Idx, Idx>> fills;
 
-    auto l = adj(u, d);
-    auto lu = l;
-    lu.push_back(u);
-    std::ranges::sort(lu);
+    for (Idx k = 0; k < n; ++k) {
+        Idx const u = dgd.min_element();
+        alpha.push_back(u);
+        if (graph.size() == 2) {
+            Idx const from = graph.first();
+            assert(graph.adj(from).size() == 1);
 
-    for (auto const& v : l) {
-        auto lv = adj(v, d);
-        lv.push_back(v);
-        std::ranges::sort(lv);
-        if (lu == lv) {
-            rl.push_back(v);
+            Idx const to = graph.adj(from)[0];
+            alpha.push_back(alpha.back() == from ? to : from);
+            return {alpha, fills};
+        }
+        auto result = graph.eliminate(u, dgd, fills);
+        alpha.insert(alpha.end(), result.begin(), result.end());
+        if (graph.size() == 0) {
+            return {alpha, fills};
         }
     }
-
-    return {{l, rl}};
-}
-
-inline bool in_graph(std::pair<Idx, Idx> const& e, std::map<Idx, IdxVector> const& d) {
-    auto edges_it = d.find(e.first);
-    return edges_it != d.cend() && std::ranges::find(edges_it->second, e.second) != edges_it->second.cend();
+    return {alpha, fills};
 }
 
-inline IdxVector remove_vertices_update_degrees(Idx const u, std::map<Idx, IdxVector>& d, DegreeLookup& dgd,
-                                                std::vector<std::pair<Idx, Idx>>& fills) {
-    std::vector<std::pair<IdxVector, IdxVector>> nbsrl = check_indistguishable(u, d);
-    auto& [nbs, rl] = nbsrl[0];
-    IdxVector alpha = rl;
-    std::map<Idx, IdxVector> dd;
-
-    rl.push_back(u);
+// fill-ins of the elimination of the graph in the given order, the graph is in compressed adjacency format
+//    the structure of a vertex consists of its neighbours that are eliminated later,
+//    it is the union of its own later neighbours and the structures of its children in the elimination tree
+inline std::vector<std::pair<Idx, Idx>> elimination_fill_ins(IdxVector const& indptr, IdxVector const& indices,
+                                                             IdxVector const& order) {
+    auto const n_vertices = static_cast<Idx>(order.size());
+    IdxVector position(n_vertices);
+    for (Idx pos = 0; pos != n_vertices; ++pos) {
+        position[order[pos]] = pos;
+    }
 
-    for (auto uu : rl) {
-        if (uu != u) {
-            std::erase(nbs, uu);
+    std::vector<std::pair<Idx, Idx>> fills;
+    IdxVector structure_indptr{0};
+    IdxVector structure; // positions of the later neighbours, per position
+    IdxVector child_head(n_vertices, -1);
+    IdxVector child_next(n_vertices, -1);
+    IdxVector marker(n_vertices, -1);
+    for (Idx pos = 0; pos != n_vertices; ++pos) {
+        Idx const vertex = order[pos];
+        marker[pos] = pos;
+        for (Idx idx = indptr[vertex]; idx != indptr[vertex + 1]; ++idx) {
+            if (Idx const neighbour_pos = position[indices[idx]]; neighbour_pos > pos && marker[neighbour_pos] != pos) {
+                marker[neighbour_pos] = pos;
+                structure.push_back(neighbour_pos);
+            }
         }
-
-        remove_element_degree(uu, dgd);
-        IdxVector el;
-        for (auto e : d[uu]) {
-            auto& adjacents = d[e];
-            std::erase(adjacents, uu);
-            if (adjacents.empty()) {
-                el.push_back(e);
+        // the structure vector grows while the children are visited, so it is accessed by index
+        for (Idx child = child_head[pos]; child != -1; child = child_next[child]) {
+            for (Idx idx = structure_indptr[child]; idx != structure_indptr[child + 1]; ++idx) {
+                if (Idx const neighbour_pos = structure[idx]; marker[neighbour_pos] != pos) {
+                    marker[neighbour_pos] = pos;
+                    structure.push_back(neighbour_pos);
+                    fills.emplace_back(vertex, order[neighbour_pos]);
+                }
             }
         }
+        auto const begin = structure.cbegin() + structure_indptr.back();
+        if (begin != structure.cend()) {
+            Idx const parent = *std::min_element(begin, structure.cend());
+            child_next[pos] = child_head[parent];
+            child_head[parent] = pos;
+        }
+        structure_indptr.push_back(static_cast<Idx>(structure.size()));
+    }
+    return fills;
+}
 
-        el.push_back(uu);
-
-        for (auto const& it : el) {
-            d.erase(it);
+// approximate minimum degree elimination order of the graph in compressed adjacency format, duplicates are allowed
+//    the elimination runs on the quotient graph: an eliminated vertex becomes an element, which stands for the clique
+//    of its remaining neighbours, instead of adding the fill-ins to the graph
+//    the degree of a variable is the upper bound of Amestoy, Davis and Duff on its external degree,
+//    indistinguishable variables are merged into a supervariable and eliminated together
+//    the pivot is the supervariable with the minimum degree of its vertices, like in the minimum degree ordering,
+//    ties are broken by the smallest vertex
+inline IdxVector approximate_minimum_degree_elimination(IdxVector const& indptr, IdxVector const& indices) {
+    enum class Kind : IntS { variable, merged, element, absorbed };
+    auto const n_vertices = static_cast<Idx>(indptr.size()) - 1;
+
+    std::vector<Kind> kind(n_vertices, Kind::variable);
+    IdxVector weight(n_vertices, 1);              // vertices in a supervariable, or in the clique of an element
+    IdxVector degree(n_vertices);                 // approximate external degree of a variable
+    IdxVector external(n_vertices);               // external degree outside the new element
+    IdxVector outside(n_vertices, -1);            // weight of the clique of an element outside the new element
+    std::vector<IdxVector> variables(n_vertices); // adjacent variables, or the clique of an element
+    std::vector<IdxVector> elements(n_vertices);  // adjacent elements of a variable
+    std::vector<IdxVector> members(n_vertices);   // vertices of a supervariable
+    IdxVector marker(n_vertices, -1);
+    DegreeLookup dgd{n_vertices};
+
+    for (Idx u = 0; u != n_vertices; ++u) {
+        marker[u] = u;
+        for (Idx idx = indptr[u]; idx != indptr[u + 1]; ++idx) {
+            if (Idx const v = indices[idx]; marker[v] != u) {
+                marker[v] = u;
+                variables[u].push_back(v);
+            }
         }
+        members[u].push_back(u);
+        degree[u] = static_cast<Idx>(variables[u].size());
+        dgd.set(u, degree[u]);
     }
+    std::ranges::fill(marker, -1);
+
+    IdxVector order;
+    order.reserve(n_vertices);
+    Idx n_remaining = n_vertices;
+    IdxVector clique;
+    IdxVector touched;
+    IdxVector seen(n_vertices, -1);
+    std::vector<std::pair<Idx, Idx>> hashes;
+    while (n_remaining != 0) {
+        Idx const p = dgd.min_element();
+        dgd.erase(p);
+        order.insert(order.end(), members[p].cbegin(), members[p].cend());
+        n_remaining -= weight[p];
+
+        // the clique of the new element: the adjacent variables and the cliques of the absorbed elements
+        clique.clear();
+        marker[p] = p;
+        auto const add_to_clique = [&kind, &marker, &clique, p](Idx v) {
+            if (kind[v] == Kind::variable && marker[v] != p) {
+                marker[v] = p;
+                clique.push_back(v);
+            }
+        };
+        std::ranges::for_each(variables[p], add_to_clique);
+        for (Idx const e : elements[p]) {
+            if (kind[e] == Kind::element) {
+                std::ranges::for_each(variables[e], add_to_clique);
+                kind[e] = Kind::absorbed;
+                variables[e] = {};
+            }
+        }
+        kind[p] = Kind::element;
+        elements[p] = {};
+        variables[p] = clique;
+        weight[p] = 0;
+        for (Idx const v : clique) {
+            weight[p] += weight[v];
+        }
 
-    dd = make_clique(nbs);
+        // weight of the other elements of the variables in the clique outside the new clique
+        for (Idx const i : clique) {
+            for (Idx const e : elements[i]) {
+                if (kind[e] == Kind::element) {
+                    if (outside[e] < 0) {
+                        outside[e] = weight[e];
+                        touched.push_back(e);
+                    }
+                    outside[e] -= weight[i];
+                }
+            }
+        }
 
-    for (auto const& [k, adjacent] : dd) {
-        auto it = d.find(k);
-        for (Idx const e : adjacent) {
-            if (!in_graph(std::make_pair(k, e), d)) {
-                if (it == d.end()) {
-                    std::tie(it, std::ignore) = d.try_emplace(k);
+        // prune the adjacency of the variables in the clique, an element inside the new clique is absorbed
+        for (Idx const i : clique) {
+            external[i] = 0;
+            std::erase_if(elements[i], [&kind, &variables, &outside, &external, i](Idx e) {
+                if (kind[e] == Kind::element && outside[e] == 0) {
+                    kind[e] = Kind::absorbed;
+                    variables[e] = {};
+                }
+                if (kind[e] != Kind::element) {
+                    return true;
+                }
+                external[i] += outside[e];
+                return false;
+            });
+            std::erase_if(variables[i],
+                          [&kind, &marker, p](Idx v) { return kind[v] != Kind::variable || marker[v] == p; });
+            for (Idx const v : variables[i]) {
+                external[i] += weight[v];
+            }
+            elements[i].push_back(p);
+        }
+        for (Idx const e : touched) {
+            outside[e] = -1;
+        }
+        touched.clear();
+
+        // merge the indistinguishable variables, they have the same elements and variables
+        hashes.clear();
+        for (Idx const i : clique) {
+            hashes.emplace_back(std::reduce(elements[i].cbegin(), elements[i].cend(), Idx{0}) +
+                                    std::reduce(variables[i].cbegin(), variables[i].cend(), Idx{0}),
+                                i);
+        }
+        std::ranges::sort(hashes);
+        for (auto first = hashes.cbegin(); first != hashes.cend(); ++first) {
+            Idx const i = first->second;
+            if (kind[i] != Kind::variable) {
+                continue;
+            }
+            for (Idx const v : elements[i]) {
+                seen[v] = i;
+            }
+            for (Idx const v : variables[i]) {
+                seen[v] = i;
+            }
+            auto const is_seen = [&seen, i](Idx v) { return seen[v] == i; };
+            for (auto second = first + 1; second != hashes.cend() && second->first == first->first; ++second) {
+                if (Idx const j = second->second;
+                    kind[j] == Kind::variable && elements[j].size() == elements[i].size() &&
+                    variables[j].size() == variables[i].size() && std::ranges::all_of(elements[j], is_seen) &&
+                    std::ranges::all_of(variables[j], is_seen)) {
+                    weight[i] += weight[j];
+                    members[i].insert(members[i].end(), members[j].cbegin(), members[j].cend());
+                    kind[j] = Kind::merged;
+                    elements[j] = {};
+                    variables[j] = {};
+                    members[j] = {};
+                    dgd.erase(j);
                 }
-                it->second.push_back(e);
-                d[e].push_back(k);
-                fills.emplace_back(k, e);
             }
         }
-    }
 
-    for (auto const& e : nbs) {
-        set_element_degree(e, num_adjacent(e, d), dgd);
+        for (Idx const i : clique) {
+            if (kind[i] == Kind::variable) {
+                Idx const new_neighbours = weight[p] - weight[i];
+                degree[i] = std::min({degree[i] + new_neighbours, external[i] + new_neighbours,
+                                      n_remaining - weight[i]});
+                dgd.set(i, degree[i] + weight[i] - 1);
+            }
+        }
     }
-
-    return alpha;
+    return order;
 }
 } // namespace detail
 
 inline std::pair<IdxVector, std::vector<std::pair<Idx, Idx>>> minimum_degree_ordering(std::map<Idx, IdxVector> d) {
+    // number the vertices in ascending order, so that ties are broken by the smallest vertex
+    IdxVector vertices;
+    for (auto const& [k, adjacent] : d) {
+        vertices.push_back(k);
+        vertices.insert(vertices.end(), adjacent.begin(), adjacent.end());
+    }
+    std::ranges::sort(vertices);
+    auto const duplicates = std::ranges::unique(vertices);
+    vertices.erase(duplicates.begin(), duplicates.end());
+    auto const index_of = [&vertices](Idx vertex) {
+        return static_cast<Idx>(std::distance(vertices.begin(), std::ranges::lower_bound(vertices, vertex)));
+    };
+
     // make symmetric
+    std::vector<IdxVector> adjacency(vertices.size());
     for (auto const& [k, adjacent] : d) {
+        Idx const k_idx = index_of(k);
         for (auto e : adjacent) {
-            d[e].push_back(k);
+            Idx const e_idx = index_of(e);
+            adjacency[k_idx].push_back(e_idx);
+            adjacency[e_idx].push_back(k_idx);
         }
     }
-    for (auto& [k, adjacent] : d) {
-        std::set<Idx> const unique_sorted_adjacent{adjacent.begin(), adjacent.end()};
-        adjacent = IdxVector{unique_sorted_adjacent.begin(), unique_sorted_adjacent.end()};
+    for (auto& adjacent : adjacency) {
+        std::ranges::sort(adjacent);
+        auto const duplicate_adjacent = std::ranges::unique(adjacent);
+        adjacent.erase(duplicate_adjacent.begin(), duplicate_adjacent.end());
     }
 
-    auto data = detail::comp_size_degrees_graph(d);
-    auto& [n, dgd] = data[0];
-
-    IdxVector alpha;
-    std::vector<std::pair<Idx, Idx>> fills;
-
-    for (Idx k = 0; k < n; ++k) {
-        Idx const u = get<0>(*detail::min_element(dgd));
-        alpha.push_back(u);
-        if (d.size() == 2) {
-            assert(d.begin()->second.size() == 1);
+    auto [alpha, fills] = detail::minimum_degree_elimination(std::move(adjacency));
+    for (auto& u : alpha) {
+        u = vertices[u];
+    }
+    for (auto& [from, to] : fills) {
+        from = vertices[from];
+        to = vertices[to];
+    }
+    return {std::move(alpha), std::move(fills)};
+}
 
-            Idx const from = d.begin()->first;
-            Idx const to = d.begin()->second[0];
-            alpha.push_back(alpha.back() == from ? to : from);
-            return {alpha, fills};
-        }
-        auto result = detail::remove_vertices_update_degrees(u, d, dgd, fills);
-        alpha.insert(alpha.end(), result.begin(), result.end());
-        if (d.empty()) {
-            return {alpha, fills};
-        }
+// approximate minimum degree ordering of the graph with vertices 0 .. n_vertices - 1
+//    the edges can be given in any direction, duplicates are allowed
+//    the ordering works on the quotient graph, the fill-ins are derived afterwards from the elimination tree
+// return the elimination order and the fill-ins
+inline std::pair<IdxVector, std::vector<std::pair<Idx, Idx>>>
+approximate_minimum_degree_ordering(Idx n_vertices, std::vector<std::pair<Idx, Idx>> const& edges) {
+    // adjacency in both directions
+    IdxVector indptr(n_vertices + 1, 0);
+    for (auto const& [from, to] : edges) {
+        ++indptr[from + 1];
+        ++indptr[to + 1];
     }
-    return {alpha, fills};
+    std::partial_sum(indptr.cbegin(), indptr.cend(), indptr.begin());
+    IdxVector indices(indptr.back());
+    IdxVector fill_position(indptr.cbegin(), indptr.cend() - 1);
+    for (auto const& [from, to] : edges) {
+        indices[fill_position[from]++] = to;
+        indices[fill_position[to]++] = from;
+    }
+
+    IdxVector order = detail::approximate_minimum_degree_elimination(indptr, indices);
+    auto fills = detail::elimination_fill_ins(indptr, indices, order);
+    return {std::move(order), std::move(fills)};
 }
 } // namespace power_grid_model
@@ -8,6 +8,7 @@
 #include "common/common.hpp"
 #include "common/enum.hpp"
 #include "common/exception.hpp"
+#include "common/thread_pool.hpp"
 #include "index_mapping.hpp"
 #include "sparse_ordering.hpp"
 
@@ -103,15 +104,21 @@ class Topology {
     };
 
   public:
-    Topology(ComponentTopology const& comp_topo, ComponentConnections const& comp_conn)
+    Topology(ComponentTopology const& comp_topo, ComponentConnections const& comp_conn,
+             SparseOrderingMethod ordering_method = SparseOrderingMethod::minimum_degree)
         : comp_topo_{comp_topo},
           comp_conn_{comp_conn},
+          ordering_method_{ordering_method},
           phase_shift_(comp_topo_.n_node_total(), 0.0),
           predecessors_(
               boost::counting_iterator<GraphIdx>{0}, // Predecessors is initialized as 0, 1, 2, ..., n_node_total() - 1
               boost::counting_iterator<GraphIdx>{(GraphIdx)comp_topo_.n_node_total()}),
           node_status_(comp_topo_.n_node_total(), -1) {}
 
+    // the math models of the islands are constructed concurrently by at most n_threads threads
+    //    the result does not depend on the number of threads
+    void set_n_threads(Idx n_threads) { n_threads_ = std::max(n_threads, Idx{1}); }
+
     // build topology
     std::pair<std::vector<std::shared_ptr<MathModelTopology const>>,
               std::shared_ptr<TopologicalComponentToMathCoupling const>>
@@ -137,6 +144,8 @@ class Topology {
     // input
     ComponentTopology const& comp_topo_;    // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
     ComponentConnections const& comp_conn_; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+    SparseOrderingMethod ordering_method_;
+    Idx n_threads_{1};
 
     // intermediate
     GlobalGraph global_graph_;
@@ -213,7 +222,15 @@ class Topology {
         }
     }
 
+    // nodes of an island, found by the dfs search from its source
+    struct Island {
+        Idx source_node;
+        std::vector<Idx> dfs_node;
+        std::vector<std::pair<GraphIdx, GraphIdx>> back_edges;
+    };
+
     void dfs_search() {
+        std::vector<Island> islands;
         // m as math solver sequence number
         Idx math_solver_idx = 0;
         // loop all source as k
@@ -228,53 +245,69 @@ class Topology {
                 // skip the source
                 continue;
             }
-            // temporary vector to store the node in this dfs search
-            std::vector<Idx> dfs_node;
-            // back edges
-            std::vector<std::pair<GraphIdx, GraphIdx>> back_edges;
+            Island& island = islands.emplace_back(Island{.source_node = source_node, .dfs_node = {}, .back_edges = {}});
             // start dfs search
-            boost::depth_first_visit(
-                global_graph_, (GraphIdx)source_node,
-                GlobalDFSVisitor{math_solver_idx, comp_coup_.node, phase_shift_, dfs_node, predecessors_, back_edges},
-                boost::get(&GlobalVertex::color, global_graph_));
-
-            // begin to construct math topology
-            MathModelTopology math_topo_single{};
-            // reorder node number
-            if (back_edges.empty()) {
-                // no cycle, the graph is pure tree structure
-                // just reverse the node
-                std::ranges::reverse(dfs_node);
-                math_topo_single.is_radial = true;
-            } else {
-                // with cycles, meshed graph
-                // use minimum degree
-                math_topo_single.fill_in = reorder_node(dfs_node, back_edges);
-                math_topo_single.is_radial = false;
-            }
-            // initialize phase shift
-            math_topo_single.phase_shift.resize(dfs_node.size());
-            // i as bus number
-            Idx i = 0;
-            for (auto it = dfs_node.cbegin(); it != dfs_node.cend(); ++it, ++i) {
-                Idx const current_node = *it;
-                // assign node coupling
-                comp_coup_.node[current_node].pos = i;
-                // assign phase shift
-                math_topo_single.phase_shift[i] = phase_shift_[current_node];
-                assert(comp_coup_.node[current_node].group == math_solver_idx);
-            }
-            assert(i == math_topo_single.n_bus());
-            // assign slack bus as the source node
-            math_topo_single.slack_bus = comp_coup_.node[source_node].pos;
-            math_topology_.emplace_back(std::move(math_topo_single));
+            boost::depth_first_visit(global_graph_, (GraphIdx)source_node,
+                                     GlobalDFSVisitor{math_solver_idx, comp_coup_.node, phase_shift_, island.dfs_node,
+                                                      predecessors_, island.back_edges},
+                                     boost::get(&GlobalVertex::color, global_graph_));
             // iterate math model sequence number
             ++math_solver_idx;
-            assert(math_solver_idx == static_cast<Idx>(math_topology_.size()));
         }
+
+        // the islands are disjoint, so their math models can be constructed concurrently
+        math_topology_.resize(islands.size());
+        auto const n_islands = static_cast<Idx>(islands.size());
+        if (Idx const n_workers = std::min(n_threads_, n_islands); n_workers > 1) {
+            ChunkCursor chunks{n_islands, 1};
+            ThreadPool::global().parallel_run(n_workers, [this, &chunks, &islands](Idx /* worker_idx */) {
+                while (auto const chunk = chunks.next()) {
+                    for (Idx const island_idx : *chunk) {
+                        build_math_topology(island_idx, islands[island_idx]);
+                    }
+                }
+            });
+        } else {
+            for (Idx island_idx = 0; island_idx != n_islands; ++island_idx) {
+                build_math_topology(island_idx, islands[island_idx]);
+            }
+        }
+    }
+
+    void build_math_topology(Idx math_solver_idx, Island& island) {
+        std::vector<Idx>& dfs_node = island.dfs_node;
+        // begin to construct math topology
+        MathModelTopology& math_topo_single = math_topology_[math_solver_idx];
+        // reorder node number
+        if (island.back_edges.empty()) {
+            // no cycle, the graph is pure tree structure
+            // just reverse the node
+            std::ranges::reverse(dfs_node);
+            math_topo_single.is_radial = true;
+        } else {
+            // with cycles, meshed graph
+            // use minimum degree
+            math_topo_single.fill_in = reorder_node(dfs_node, island.back_edges);
+            math_topo_single.is_radial = false;
+        }
+        // initialize phase shift
+        math_topo_single.phase_shift.resize(dfs_node.size());
+        // i as bus number
+        Idx i = 0;
+        for (auto it = dfs_node.cbegin(); it != dfs_node.cend(); ++it, ++i) {
+            Idx const current_node = *it;
+            // assign node coupling
+            comp_coup_.node[current_node].pos = i;
+            // assign phase shift
+            math_topo_single.phase_shift[i] = phase_shift_[current_node];
+            assert(comp_coup_.node[current_node].group == math_solver_idx);
+        }
+        assert(i == math_topo_single.n_bus());
+        // assign slack bus as the source node
+        math_topo_single.slack_bus = comp_coup_.node[island.source_node].pos;
     }
 
-    // re-order dfs_node using minimum degree
+    // re-order dfs_node using (approximate) minimum degree
     // return list of fill-ins when factorize the matrix
     std::vector<BranchIdx> reorder_node(std::vector<Idx>& dfs_node,
                                         std::vector<std::pair<GraphIdx, GraphIdx>> const& back_edges) {
@@ -311,6 +344,29 @@ class Topology {
             return fill_in;
         }
 
+        auto [reordered, fills] = ordering_method_ == SparseOrderingMethod::approximate_minimum_degree
+                                      ? approximate_minimum_degree_reorder(cyclic_node, back_edges)
+                                      : minimum_degree_reorder(cyclic_node, back_edges);
+
+        const auto n_non_cyclic_nodes = static_cast<Idx>(dfs_node.size());
+        std::map<Idx, Idx> permuted_node_indices;
+        for (Idx idx = 0; idx < static_cast<Idx>(reordered.size()); ++idx) {
+            permuted_node_indices[reordered[idx]] = n_non_cyclic_nodes + idx;
+        }
+
+        dfs_node.insert(dfs_node.end(), reordered.begin(), reordered.end());
+        for (auto [from, to] : fills) {
+            auto from_reordered = permuted_node_indices[from];
+            auto to_reordered = permuted_node_indices[to];
+            fill_in.push_back({from_reordered, to_reordered});
+        }
+
+        return fill_in;
+    }
+
+    std::pair<IdxVector, std::vector<std::pair<Idx, Idx>>>
+    minimum_degree_reorder(std::vector<Idx> const& cyclic_node,
+                           std::vector<std::pair<GraphIdx, GraphIdx>> const& back_edges) const {
         std::map<Idx, std::vector<Idx>> unique_nearest_neighbours;
         for (Idx const node_idx : cyclic_node) {
             auto predecessor = static_cast<Idx>(predecessors_[node_idx]);
@@ -325,23 +381,42 @@ class Topology {
                 unique_nearest_neighbours[from].push_back(to);
             }
         }
+        return minimum_degree_ordering(std::move(unique_nearest_neighbours));
+    }
 
-        auto [reordered, fills] = minimum_degree_ordering(std::move(unique_nearest_neighbours));
+    // same graph as above, numbered locally in ascending node order
+    //    the predecessors of cyclic nodes and both ends of back edges are cyclic nodes
+    std::pair<IdxVector, std::vector<std::pair<Idx, Idx>>>
+    approximate_minimum_degree_reorder(std::vector<Idx> const& cyclic_node,
+                                       std::vector<std::pair<GraphIdx, GraphIdx>> const& back_edges) const {
+        IdxVector sorted_node{cyclic_node};
+        std::ranges::sort(sorted_node);
+        auto const local_idx = [&sorted_node](Idx node_idx) {
+            assert(std::ranges::binary_search(sorted_node, node_idx));
+            return static_cast<Idx>(
+                std::distance(sorted_node.begin(), std::ranges::lower_bound(sorted_node, node_idx)));
+        };
 
-        const auto n_non_cyclic_nodes = static_cast<Idx>(dfs_node.size());
-        std::map<Idx, Idx> permuted_node_indices;
-        for (Idx idx = 0; idx < static_cast<Idx>(reordered.size()); ++idx) {
-            permuted_node_indices[reordered[idx]] = n_non_cyclic_nodes + idx;
+        std::vector<std::pair<Idx, Idx>> edges;
+        edges.reserve(cyclic_node.size() + back_edges.size());
+        for (Idx const node_idx : cyclic_node) {
+            if (auto predecessor = static_cast<Idx>(predecessors_[node_idx]); predecessor != node_idx) {
+                edges.emplace_back(local_idx(node_idx), local_idx(predecessor));
+            }
         }
-
-        dfs_node.insert(dfs_node.end(), reordered.begin(), reordered.end());
-        for (auto [from, to] : fills) {
-            auto from_reordered = permuted_node_indices[from];
-            auto to_reordered = permuted_node_indices[to];
-            fill_in.push_back({from_reordered, to_reordered});
+        for (auto const& [from_node, to_node] : back_edges) {
+            edges.emplace_back(local_idx(static_cast<Idx>(from_node)), local_idx(static_cast<Idx>(to_node)));
         }
 
-        return fill_in;
+        auto [reordered, fills] = approximate_minimum_degree_ordering(static_cast<Idx>(sorted_node.size()), edges);
+        for (auto& node_idx : reordered) {
+            node_idx = sorted_node[node_idx];
+        }
+        for (auto& [from, to] : fills) {
+            from = sorted_node[from];
+            to = sorted_node[to];
+        }
+        return {std::move(reordered), std::move(fills)};
     }
 
     void couple_branch() {
@@ -25,6 +25,7 @@
 #define POWER_GRID_MODEL_C_H
 
 #include "power_grid_model_c/basics.h"
+#include "power_grid_model_c/batch_reduction.h"
 #include "power_grid_model_c/buffer.h"
 #include "power_grid_model_c/dataset.h"
 #include "power_grid_model_c/handle.h"
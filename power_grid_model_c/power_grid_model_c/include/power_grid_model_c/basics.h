@@ -137,6 +137,8 @@ typedef struct PGM_WritableDataset PGM_WritableDataset;
  * @brief Opaque struct for the information of the dataset.
  */
 typedef struct PGM_DatasetInfo PGM_DatasetInfo;
+
+typedef struct PGM_BatchReduction PGM_BatchReduction;
 #endif
 
 // NOLINTEND(modernize-use-using)
@@ -165,7 +167,8 @@ enum PGM_CalculationMethod {
     PGM_iterative_linear = 2,  /**< iterative linear method for state estimation */
     PGM_iterative_current = 3, /**< linear current method for power flow */
     PGM_linear_current = 4,    /**< iterative constant impedance method for power flow */
-    PGM_iec60909 = 5           /**< fault analysis for short circuits using the iec60909 standard */
+    PGM_iec60909 = 5,          /**< fault analysis for short circuits using the iec60909 standard */
+    PGM_fast_decoupled = 6     /**< fast decoupled method for symmetric power flow */
 };
 
 /**
@@ -216,6 +219,15 @@ enum PGM_ShortCircuitVoltageScaling {
     PGM_short_circuit_voltage_scaling_maximum = 1, /**< voltage scaling for maximum short circuit currents */
 };
 
+/**
+ * @brief Enumeration of fill-reducing orderings of the sparse matrices.
+ *
+ */
+enum PGM_SparseOrdering {
+    PGM_sparse_ordering_minimum_degree = 0,             /**< minimum degree on the elimination graph */
+    PGM_sparse_ordering_approximate_minimum_degree = 1, /**< approximate minimum degree on the quotient graph */
+};
+
 /**
  * @brief Enumeration of tap changing strategies.
  *
@@ -246,6 +258,16 @@ enum PGM_ExperimentalFeatures {
     PGM_experimental_features_enabled = 1,  /**< enable experimental features */
 };
 
+enum PGM_ReductionType {
+    PGM_reduction_minimum = 0,     /**< minimum value over the scenarios */
+    PGM_reduction_maximum = 1,     /**< maximum value over the scenarios */
+    PGM_reduction_mean = 2,        /**< mean value over the scenarios */
+    PGM_reduction_arg_minimum = 3, /**< first scenario with the minimum value */
+    PGM_reduction_arg_maximum = 4, /**< first scenario with the maximum value */
+    PGM_reduction_count_above = 5, /**< number of scenarios with a value above the threshold */
+    PGM_reduction_count_below = 6, /**< number of scenarios with a value below the threshold */
+};
+
 // NOLINTEND(performance-enum-size)
 
 #ifdef __cplusplus
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+/**
+ * @brief header file which includes batch reduction functions
+ *
+ */
+
+#pragma once
+#ifndef POWER_GRID_MODEL_C_BATCH_REDUCTION_H
+#define POWER_GRID_MODEL_C_BATCH_REDUCTION_H
+
+#include "basics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Create a batch reduction instance.
+ *
+ * A batch reduction specifies which output attributes of a batch calculation are reduced over all scenarios,
+ * see PGM_calculate_reduced().
+ * Instead of the output of each scenario, only one reduced value per element (and per phase for asymmetric
+ * attributes) is kept.
+ *
+ * @param handle
+ * @param dataset The name of the output dataset of the calculation, e.g. "sym_output".
+ * @return The pointer to the batch reduction instance. Should be freed by PGM_destroy_batch_reduction().
+ *     Returns NULL if the dataset does not exist.
+ */
+PGM_API PGM_BatchReduction* PGM_create_batch_reduction(PGM_Handle* handle, char const* dataset);
+
+/**
+ * @brief Free a batch reduction instance.
+ *
+ * @param reduction The pointer to the batch reduction instance created by PGM_create_batch_reduction().
+ */
+PGM_API void PGM_destroy_batch_reduction(PGM_BatchReduction* reduction);
+
+/**
+ * @brief Add the reduction of an output attribute.
+ *
+ * The result buffer contains one value per element of the component in the model, in the same order as the output
+ * of a regular calculation.
+ * For an attribute with three phases, the buffer contains three values per element.
+ * Failed scenarios and NaN values are not taken into account.
+ *
+ * The type of the values in the result buffer depends on the reduction type:
+ *   - PGM_reduction_minimum, PGM_reduction_maximum and PGM_reduction_mean: double, NaN if there are no values.
+ *   - PGM_reduction_arg_minimum and PGM_reduction_arg_maximum: PGM_Idx, the first scenario with the extreme value,
+ *     -1 if there are no values.
+ *   - PGM_reduction_count_above and PGM_reduction_count_below: PGM_Idx.
+ *
+ * @param handle
+ * @param reduction The pointer to the batch reduction instance.
+ * @param component The name of the component, e.g. "node".
+ * @param attribute The name of the attribute, e.g. "u_pu".
+ * @param type See #PGM_ReductionType .
+ * @param threshold The threshold for PGM_reduction_count_above and PGM_reduction_count_below, ignored otherwise.
+ * @param result The pointer to the result buffer, which should stay valid until the calculation is done.
+ */
+PGM_API void PGM_batch_reduction_add(PGM_Handle* handle, PGM_BatchReduction* reduction, char const* component,
+                                     char const* attribute, PGM_Idx type, double threshold, void* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -765,6 +765,8 @@ PGM_API extern PGM_MetaDataset const* const PGM_def_update;
 PGM_API extern PGM_MetaComponent const* const PGM_def_update_node;
 // attributes of update node
 PGM_API extern PGM_MetaAttribute const* const PGM_def_update_node_id;
+PGM_API extern PGM_MetaAttribute const* const PGM_def_update_node_u_init;
+PGM_API extern PGM_MetaAttribute const* const PGM_def_update_node_u_init_angle;
 // component line
 PGM_API extern PGM_MetaComponent const* const PGM_def_update_line;
 // attributes of update line
@@ -34,6 +34,66 @@ extern "C" {
 PGM_API PGM_PowerGridModel* PGM_create_model(PGM_Handle* handle, double system_frequency,
                                              PGM_ConstDataset const* input_dataset);
 
+/**
+ * @brief Create a new instance of Power Grid Model using multiple threads.
+ *
+ * Same as PGM_create_model(), but the references between the components are validated concurrently.
+ * The math models of the islands in the grid are also constructed concurrently, during the first calculation and
+ * after each change of the topology.
+ * The resulting model is the same as the one created by PGM_create_model(), including the error in case of invalid
+ * input.
+ *
+ * @param handle
+ * @param system_frequency The frequency of the system, usually 50 or 60 Hz
+ * @param input_dataset Pointer to an instance of PGM_ConstDataset. It should have data type "input".
+ * @param threading The multi-threading strategy. See below:
+ *   - -1: No multi-threading, same as PGM_create_model().
+ *   - 0: use number of machine available threads.
+ *   - >0: specify number of threads you want to use.
+ * @return The opaque pointer to the created model.
+ * If there are errors during the creation, a NULL is returned.
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ */
+PGM_API PGM_PowerGridModel* PGM_create_model_threaded(PGM_Handle* handle, double system_frequency,
+                                                      PGM_ConstDataset const* input_dataset, PGM_Idx threading);
+
+/**
+ * @brief Write a binary snapshot of the model created from the input data to a file.
+ *
+ * The snapshot contains the input data and the topology of the math models of the islands in the grid, including the
+ * fill-in of their sparse matrices.
+ * A model restored from the snapshot by PGM_load_model_snapshot() is the same as the one created by PGM_create_model(),
+ * except that the topology does not need to be built during the first calculation.
+ * The snapshot is versioned: it can only be loaded by a library with the same snapshot format version on a platform
+ * with the same data layout.
+ *
+ * @param handle
+ * @param system_frequency The frequency of the system, usually 50 or 60 Hz
+ * @param input_dataset Pointer to an instance of PGM_ConstDataset. It should have data type "input".
+ * @param file_path The null-terminated path of the snapshot file. An existing file is overwritten.
+ * @return
+ * Use PGM_error_code() and PGM_error_message() to check if there are errors in the input data or in writing the file.
+ */
+PGM_API void PGM_save_model_snapshot(PGM_Handle* handle, double system_frequency, PGM_ConstDataset const* input_dataset,
+                                     char const* file_path);
+
+/**
+ * @brief Create a new instance of Power Grid Model from a snapshot written by PGM_save_model_snapshot().
+ *
+ * The snapshot file is memory mapped and the input data is used in place, so there is no parsing of the data.
+ * The topology of the math models is restored from the snapshot as well.
+ *
+ * The returned model need to be freed by PGM_destroy_model()
+ *
+ * @param handle
+ * @param file_path The null-terminated path of the snapshot file.
+ * @return The opaque pointer to the created model.
+ * If the file cannot be read, or it is not a valid snapshot for this version of the library, a NULL is returned and
+ * the error code is PGM_serialization_error.
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ */
+PGM_API PGM_PowerGridModel* PGM_load_model_snapshot(PGM_Handle* handle, char const* file_path);
+
 /**
  * @brief Update the model by changing mutable attributes of some elements.
  *
@@ -111,6 +171,172 @@ PGM_API void PGM_get_indexer(PGM_Handle* handle, PGM_PowerGridModel const* model
 PGM_API void PGM_calculate(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
                            PGM_MutableDataset const* output_dataset, PGM_ConstDataset const* batch_dataset);
 
+/**
+ * @brief Callback providing the datasets of a chunk of scenarios in PGM_calculate_pipelined().
+ *
+ * @param user_data The user_data argument of PGM_calculate_pipelined().
+ * @param slot The slot of the chunk, in the range [0, 3).
+ *   At most 3 chunks are in flight, so the user can keep one set of buffers per slot.
+ *   The buffers of a slot are not used anymore by a previous chunk when the slot is produced again.
+ * @param scenario_begin The first scenario of the chunk in the whole batch.
+ * @param scenario_end One past the last scenario of the chunk in the whole batch.
+ * @param batch_dataset Output argument: the update dataset of the chunk, with batch size
+ *   (scenario_end - scenario_begin). It should remain valid until the chunk is consumed.
+ * @param output_dataset Output argument: the output dataset of the chunk, with batch size
+ *   (scenario_end - scenario_begin). It should remain valid until the chunk is consumed.
+ * @return 0 on success, any other value aborts the calculation.
+ */
+typedef PGM_Idx (*PGM_BatchChunkProducer)(void* user_data, PGM_Idx slot, PGM_Idx scenario_begin, PGM_Idx scenario_end,
+                                          PGM_ConstDataset const** batch_dataset,
+                                          PGM_MutableDataset const** output_dataset);
+
+/**
+ * @brief Callback receiving the results of a chunk of scenarios in PGM_calculate_pipelined().
+ *
+ * The results are written in the output dataset provided by the producer for this chunk.
+ *
+ * @param user_data The user_data argument of PGM_calculate_pipelined().
+ * @param slot The slot of the chunk, in the range [0, 3).
+ * @param scenario_begin The first scenario of the chunk in the whole batch.
+ * @param scenario_end One past the last scenario of the chunk in the whole batch.
+ * @return 0 on success, any other value aborts the calculation.
+ */
+typedef PGM_Idx (*PGM_BatchChunkConsumer)(void* user_data, PGM_Idx slot, PGM_Idx scenario_begin,
+                                          PGM_Idx scenario_end);
+
+/**
+ * @brief Execute a batch calculation in chunks of scenarios, pipelined with producing the update data and consuming
+ * the results.
+ *
+ * The batch is split in consecutive chunks of chunk_size scenarios.
+ * The producer, the calculation and the consumer run concurrently in separate threads,
+ * each handling the chunks in order.
+ * While a chunk is calculated, the producer can already provide the next chunk,
+ * e.g. by deserializing it, and the consumer can process the results of the previous chunk,
+ * e.g. by serializing them.
+ * Only 3 chunks are in flight, so the memory usage does not depend on the batch size.
+ * The callbacks are not called concurrently with themselves.
+ *
+ * The calculation of a chunk is the same as PGM_calculate() with the datasets of the chunk.
+ * If some scenarios fail, the other chunks are still calculated and a batch error is reported afterwards,
+ * with the failed scenarios numbered in the whole batch.
+ * The calculation profile covers the whole batch.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param opt A pointer to options, you need to pre-set all the calculation options you want.
+ * @param batch_size The number of scenarios in the whole batch.
+ * @param chunk_size The number of scenarios in a chunk.
+ * @param producer The callback providing the datasets of a chunk. See #PGM_BatchChunkProducer .
+ * @param consumer The callback receiving the results of a chunk. See #PGM_BatchChunkConsumer .
+ * @param user_data A pointer that is passed to the callbacks.
+ * @return
+ */
+PGM_API void PGM_calculate_pipelined(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                                     PGM_Idx batch_size, PGM_Idx chunk_size, PGM_BatchChunkProducer producer,
+                                     PGM_BatchChunkConsumer consumer, void* user_data);
+
+/**
+ * @brief Execute a batch calculation, reducing the output over all scenarios.
+ *
+ * Instead of writing the output of each scenario, the output attributes specified in the batch reduction are reduced
+ * over all scenarios, e.g. the maximum loading of each line or the number of scenarios in which the voltage of a node
+ * is out of bounds.
+ * The memory usage therefore does not depend on the batch size.
+ * The reduced values are written to the result buffers of the batch reduction.
+ *
+ * If some scenarios fail, a batch error is reported and the reduced values of the other scenarios are still written.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param opt A pointer to options, you need to pre-set all the calculation options you want.
+ * @param reduction A pointer to a batch reduction, see PGM_create_batch_reduction().
+ *   The dataset of the batch reduction should be the output dataset of the calculation,
+ *   e.g. "sym_output" for a symmetric power flow.
+ * @param batch_dataset A pointer to an instance of PGM_ConstDataset for batch calculation.
+ *   The dataset should have is_batch == true. The type of the dataset should be "update".
+ * @return
+ */
+PGM_API void PGM_calculate_reduced(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                                   PGM_BatchReduction const* reduction, PGM_ConstDataset const* batch_dataset);
+
+/**
+ * @brief Get the number of entries in a calculation profile.
+ *
+ * The entries are timings (in seconds) of the stages of the calculation,
+ * and counters, e.g. the number of iterations and factorizations.
+ *
+ * @param handle
+ * @return The number of entries.
+ */
+PGM_API PGM_Idx PGM_calculation_profile_n_entries(PGM_Handle* handle);
+
+/**
+ * @brief Get the name of an entry in a calculation profile.
+ *
+ * @param handle
+ * @param entry The index of the entry, in [0, PGM_calculation_profile_n_entries()).
+ * @return The name of the entry. The pointer is valid for the lifetime of the library.
+ */
+PGM_API char const* PGM_calculation_profile_entry_name(PGM_Handle* handle, PGM_Idx entry);
+
+/**
+ * @brief Get the code of an entry in a calculation profile.
+ *
+ * The code and the name together identify the entry.
+ * E.g. the maximum number of iterations of power flow and state estimation have the same name but a different code.
+ *
+ * @param handle
+ * @param entry The index of the entry, in [0, PGM_calculation_profile_n_entries()).
+ * @return The code of the entry.
+ */
+PGM_API PGM_Idx PGM_calculation_profile_entry_code(PGM_Handle* handle, PGM_Idx entry);
+
+/**
+ * @brief Get the number of bins of the histograms in a calculation profile.
+ *
+ * The histograms are logarithmic: bin i counts the scenarios with a value in [2^(i - 32), 2^(i - 31)).
+ * Smaller values, including zero, are counted in the first bin; larger values in the last bin.
+ *
+ * @param handle
+ * @return The number of bins.
+ */
+PGM_API PGM_Idx PGM_calculation_profile_n_histogram_bins(PGM_Handle* handle);
+
+/**
+ * @brief Get the number of scenarios in the calculation profile of the last calculation of the model.
+ *
+ * This is 1 for a one-time calculation, and the batch size for a batch calculation.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @return The number of scenarios.
+ */
+PGM_API PGM_Idx PGM_calculation_profile_n_scenarios(PGM_Handle* handle, PGM_PowerGridModel const* model);
+
+/**
+ * @brief Get the calculation profile of the last calculation of the model.
+ *
+ * Any of the buffers can be NULL, in which case it is not filled.
+ * Entries that were not recorded in a scenario are 0 and are not counted in the histograms.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param scenario_profile A pointer to a double array buffer of size n_scenarios * n_entries.
+ *   The value of entry j in scenario i is written to position i * n_entries + j.
+ * @param aggregated_profile A pointer to a double array buffer of size n_entries.
+ *   The values of all scenarios are aggregated: timings and counters are summed,
+ *   the maximum number of iterations is the maximum over all scenarios.
+ * @param histogram A pointer to a #PGM_Idx array buffer of size n_entries * n_histogram_bins.
+ *   The number of scenarios of entry j in bin k is written to position j * n_histogram_bins + k.
+ */
+PGM_API void PGM_get_calculation_profile(PGM_Handle* handle, PGM_PowerGridModel const* model,
+                                         double* scenario_profile, double* aggregated_profile, PGM_Idx* histogram);
+
 /**
  * @brief Destroy the model returned by PGM_create_model() or PGM_copy_model().
  *
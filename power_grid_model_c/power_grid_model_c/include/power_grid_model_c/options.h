@@ -28,7 +28,15 @@ extern "C" {
  *   - err_tol: 1e-8
  *   - max_iter: 20
  *   - threading: -1
+ *   - batch_chunk_size: 0
+ *   - linear_panel_size: 1
+ *   - sparse_solver_threading: -1
+ *   - island_threading: -1
+ *   - warm_start: 0
  *   - short_circuit_voltage_scaling: PGM_short_circuit_voltage_scaling_maximum
+ *   - short_circuit_sweep: 0
+ *   - tap_sensitivity_search: 0
+ *   - sparse_ordering: PGM_sparse_ordering_minimum_degree
  *   - experimental_features: PGM_experimental_features_disabled
  *
  * @param handle
@@ -102,6 +110,92 @@ PGM_API void PGM_set_max_iter(PGM_Handle* handle, PGM_Options* opt, PGM_Idx max_
  */
 PGM_API void PGM_set_threading(PGM_Handle* handle, PGM_Options* opt, PGM_Idx threading);
 
+/**
+ * @brief Specify how many consecutive scenarios a thread claims at a time. Only applicable for multi-threaded batch
+ * calculation.
+ *
+ * Threads that finish their chunk early claim the next available chunk, so that the load is balanced dynamically.
+ *
+ * @param handle
+ * @param opt The pointer to the option instance.
+ * @param batch_chunk_size The number of scenarios per chunk. See below:
+ *   - <=0: choose automatically based on the batch size and the number of threads.
+ *   - >0: specify number of scenarios per chunk.
+ */
+PGM_API void PGM_set_batch_chunk_size(PGM_Handle* handle, PGM_Options* opt, PGM_Idx batch_chunk_size);
+
+/**
+ * @brief Specify how many consecutive scenarios of a batch power flow with the linear methods are solved together.
+ * Only applicable for batch power flow calculation with PGM_linear or PGM_linear_current without optimizer.
+ *
+ * The scenarios of a panel have the same topology and parameters, e.g. a time series of loads and sources. They
+ * share the factorization of the matrix, and their right-hand sides are solved together in one forward and backward
+ * substitution. For PGM_linear, only consecutive scenarios with the same matrix, i.e. the same load admittances,
+ * share a factorization. The result is the same as when the scenarios are calculated one by one. Scenarios that
+ * change the topology or the parameters are calculated one by one. In the calculation info of the scenarios, the
+ * timings and the counters of a panel are divided evenly over its scenarios.
+ *
+ * @param handle
+ * @param opt The pointer to the option instance.
+ * @param linear_panel_size The maximum number of scenarios per panel. See below:
+ *   - <=1: calculate the scenarios one by one.
+ *   - >1: specify the maximum number of scenarios per panel.
+ */
+PGM_API void PGM_set_linear_panel_size(PGM_Handle* handle, PGM_Options* opt, PGM_Idx linear_panel_size);
+
+/**
+ * @brief Specify the multi-threading strategy of the sparse matrix solver within a single calculation.
+ *
+ * The factorization and the solve of the sparse matrix are scheduled along the levels of the elimination tree.
+ * This is only beneficial for very large grids. The result is the same as with the sequential solver.
+ * It is not recommended to combine this with a multi-threaded batch calculation.
+ *
+ * @param handle
+ * @param opt The pointer to the option instance.
+ * @param sparse_solver_threading The value of the threading setting. See below:
+ *   - -1: No multi-threading, factorize and solve sequentially.
+ *   - 0: use number of machine available threads.
+ *   - >0: specify number of threads you want to factorize and solve in parallel.
+ */
+PGM_API void PGM_set_sparse_solver_threading(PGM_Handle* handle, PGM_Options* opt, PGM_Idx sparse_solver_threading);
+
+/**
+ * @brief Specify the multi-threading strategy of the math models of the islands within a single calculation.
+ *
+ * The islands of the grid, each supplied by its own source, are calculated concurrently, the largest islands first.
+ * This is beneficial for grids with many islands. The result is the same as with the sequential calculation.
+ * Within a multi-threaded batch calculation, the islands of a scenario share the threads with the other scenarios.
+ *
+ * @param handle
+ * @param opt The pointer to the option instance.
+ * @param island_threading The value of the threading setting. See below:
+ *   - -1: No multi-threading, calculate the islands sequentially.
+ *   - 0: use number of machine available threads.
+ *   - >0: specify number of threads you want to calculate the islands in parallel.
+ */
+PGM_API void PGM_set_island_threading(PGM_Handle* handle, PGM_Options* opt, PGM_Idx island_threading);
+
+/**
+ * @brief Specify whether the iterative power flow starts from the voltages of the previous calculation.
+ *
+ * In a batch calculation, each thread starts a scenario from the result of the previous scenario it calculated,
+ * as long as the topology is the same.
+ * This reduces the number of iterations if consecutive scenarios are similar, e.g. in a time series.
+ * The result may differ within the error tolerance depending on the order of the scenarios per thread.
+ * Initial voltages specified in the node update data take precedence over the previous result.
+ * A flat start ignores both, without removing the initial voltages from the nodes.
+ *
+ * @param handle
+ * @param opt The pointer to the option instance.
+ * @param warm_start Whether to warm start. See below:
+ *   - -1: flat start, start each calculation from the default initial voltages of the calculation method.
+ *   - 0: start from the initial voltages of the nodes if specified, otherwise from the default initial voltages of
+ *        the calculation method.
+ *   - 1: start from the initial voltages of the nodes if specified, otherwise from the voltages of the previous
+ *        calculation if available.
+ */
+PGM_API void PGM_set_warm_start(PGM_Handle* handle, PGM_Options* opt, PGM_Idx warm_start);
+
 /**
  * @brief Specify the voltage scaling min/max for short circuit calculations
  *
@@ -112,6 +206,24 @@ PGM_API void PGM_set_threading(PGM_Handle* handle, PGM_Options* opt, PGM_Idx thr
 PGM_API void PGM_set_short_circuit_voltage_scaling(PGM_Handle* handle, PGM_Options* opt,
                                                    PGM_Idx short_circuit_voltage_scaling);
 
+/**
+ * @brief Specify whether the short circuit calculation runs in fault sweep mode.
+ *
+ * In fault sweep mode, the network without faults is factorized once per topology and parameter set.
+ * The short circuit of each scenario is calculated from this factorization with a correction for the buses with
+ * faults, instead of factorizing the network with the faults again.
+ * This is much faster for batches of scenarios that only differ in the faults,
+ * e.g. a fault on each node in turn, if each scenario only has faults on a few nodes.
+ * The result is the same as without fault sweep, up to numerical round-off.
+ *
+ * @param handle
+ * @param opt The pointer to the option instance.
+ * @param short_circuit_sweep Whether to use the fault sweep mode. See below:
+ *   - 0: factorize the network with the faults for each calculation.
+ *   - 1: use the factorization of the network without faults.
+ */
+PGM_API void PGM_set_short_circuit_sweep(PGM_Handle* handle, PGM_Options* opt, PGM_Idx short_circuit_sweep);
+
 /**
  * @brief Specify the tap changing strategy for power flow calculations
  *
@@ -121,6 +233,41 @@ PGM_API void PGM_set_short_circuit_voltage_scaling(PGM_Handle* handle, PGM_Optio
  */
 PGM_API void PGM_set_tap_changing_strategy(PGM_Handle* handle, PGM_Options* opt, PGM_Idx tap_changing_strategy);
 
+/**
+ * @brief Specify whether the tap changing predicts the tap positions from the voltage sensitivity.
+ *
+ * The sensitivity of the voltage at the control side to the tap position of each regulated transformer is measured
+ * from the power flows of its last two tap positions.
+ * The tap position is then set directly to the position at which the voltage is predicted to be at the set point,
+ * instead of searching it one step or one halving of the tap range per power flow.
+ * This needs much fewer power flows for transformers with a wide tap range.
+ * The resulting tap positions are within the voltage band, but may differ from the ones without sensitivity search
+ * if multiple tap positions are within the band.
+ * It only applies to the strategies that look for any tap position within the voltage band:
+ * #PGM_tap_changing_strategy_any_valid_tap and #PGM_tap_changing_strategy_fast_any_tap.
+ *
+ * @param handle
+ * @param opt The pointer to the option instance.
+ * @param tap_sensitivity_search Whether to use the sensitivity search. See below:
+ *   - 0: search the tap positions as specified by the tap changing strategy.
+ *   - 1: predict the tap positions from the voltage sensitivity.
+ */
+PGM_API void PGM_set_tap_sensitivity_search(PGM_Handle* handle, PGM_Options* opt, PGM_Idx tap_sensitivity_search);
+
+/**
+ * @brief Specify the fill-reducing ordering of the nodes of the meshed parts of the grid.
+ *
+ * The ordering determines the fill-ins of the factorization of the sparse matrices.
+ * It is computed each time the topology is built, e.g. for each scenario of a batch that switches branches.
+ * The approximate minimum degree ordering is faster to compute for large meshed grids.
+ * It may give a slightly different number of fill-ins, and therefore results that differ within the error tolerance.
+ *
+ * @param handle
+ * @param opt The pointer to the option instance.
+ * @param sparse_ordering See #PGM_SparseOrdering
+ */
+PGM_API void PGM_set_sparse_ordering(PGM_Handle* handle, PGM_Options* opt, PGM_Idx sparse_ordering);
+
 /**
  * @brief Enable/disable experimental features.
  *
@@ -41,6 +41,20 @@ PGM_API PGM_Deserializer* PGM_create_deserializer_from_null_terminated_string(PG
                                                                               char const* data_string,
                                                                               PGM_Idx serialization_format);
 
+/**
+ * @brief Create a deserializer from a file.
+ *     The file is memory mapped instead of loaded into memory. It must not be modified while the deserializer exists.
+ * @param handle
+ * @param file_path The null-terminated path of the file.
+ * @param serialization_format The desired data format of the serialization. See #PGM_SerializationFormat .
+ *     For msgpack, the data is parsed directly from the mapped file.
+ *     For json, the file is converted to msgpack in memory.
+ * @return A pointer to the deserializer instance. Should be freed by PGM_destroy_deserializer().
+ *     Returns NULL if errors occured (check the handle for error information).
+ */
+PGM_API PGM_Deserializer* PGM_create_deserializer_from_file(PGM_Handle* handle, char const* file_path,
+                                                            PGM_Idx serialization_format);
+
 /**
  * @brief Get the PGM_WritableDataset object from the deserializer.
  * @param handle
@@ -61,6 +75,36 @@ PGM_API PGM_WritableDataset* PGM_deserializer_get_dataset(PGM_Handle* handle, PG
  */
 PGM_API void PGM_deserializer_parse_to_buffer(PGM_Handle* handle, PGM_Deserializer* deserializer);
 
+/**
+ * @brief Get the number of elements of a component in a range of scenarios.
+ * @param handle
+ * @param deserializer The pointer to the deserializer.
+ * @param component The name of the component.
+ * @param scenario_begin The first scenario of the range.
+ * @param scenario_end One past the last scenario of the range.
+ * @return The number of elements the buffer of the component needs for
+ *     PGM_deserializer_parse_scenario_range_to_buffer(). Check the handle for error information.
+ */
+PGM_API PGM_Idx PGM_deserializer_get_scenario_range_total_elements(PGM_Handle* handle, PGM_Deserializer* deserializer,
+                                                                   char const* component, PGM_Idx scenario_begin,
+                                                                   PGM_Idx scenario_end);
+
+/**
+ * @brief Parse a range of scenarios of the dataset and write to the user-provided buffers.
+ *     The buffers must be set through PGM_writable_dataset_set_buffer().
+ *     The buffers only need to hold the scenarios in the range, i.e. the first element of scenario_begin is written
+ *     at the start of the buffer. The buffer size is given by PGM_deserializer_get_scenario_range_total_elements().
+ *     The indptr of a non-uniform component needs (scenario_end - scenario_begin + 1) entries and starts at zero.
+ *     This can be called repeatedly to process a large batch dataset in chunks of scenarios.
+ * @param handle
+ * @param deserializer The pointer to the deserializer
+ * @param scenario_begin The first scenario of the range.
+ * @param scenario_end One past the last scenario of the range.
+ * @return No return value; check handle for error.
+ */
+PGM_API void PGM_deserializer_parse_scenario_range_to_buffer(PGM_Handle* handle, PGM_Deserializer* deserializer,
+                                                             PGM_Idx scenario_begin, PGM_Idx scenario_end);
+
 /**
  * @brief Destory deserializer
  * @param deserializer pointer to deserializer
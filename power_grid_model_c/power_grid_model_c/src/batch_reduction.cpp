@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#define PGM_DLL_EXPORTS
+#include "forward_declarations.hpp"
+
+#include "power_grid_model_c/batch_reduction.h"
+
+#include "get_meta_data.hpp"
+#include "handle.hpp"
+
+#include <power_grid_model/batch_reduction.hpp>
+
+namespace {
+using namespace power_grid_model;
+} // namespace
+
+PGM_BatchReduction* PGM_create_batch_reduction(PGM_Handle* handle, char const* dataset) {
+    return call_with_catch(handle, [dataset] { return new PGM_BatchReduction{dataset, get_meta_data()}; },
+                           PGM_regular_error);
+}
+
+void PGM_destroy_batch_reduction(PGM_BatchReduction* reduction) { delete reduction; }
+
+void PGM_batch_reduction_add(PGM_Handle* handle, PGM_BatchReduction* reduction, char const* component,
+                             char const* attribute, PGM_Idx type, double threshold, void* result) {
+    call_with_catch(
+        handle,
+        [reduction, component, attribute, type, threshold, result] {
+            reduction->add_request(component, attribute, static_cast<ReductionType>(type), threshold, result);
+        },
+        PGM_regular_error);
+}
@@ -754,6 +754,8 @@ PGM_MetaDataset const* const PGM_def_update = PGM_meta_get_dataset_by_name(nullp
 PGM_MetaComponent const* const PGM_def_update_node = PGM_meta_get_component_by_name(nullptr, "update", "node");
 // attributes of update node
 PGM_MetaAttribute const* const PGM_def_update_node_id = PGM_meta_get_attribute_by_name(nullptr, "update", "node", "id");
+PGM_MetaAttribute const* const PGM_def_update_node_u_init = PGM_meta_get_attribute_by_name(nullptr, "update", "node", "u_init");
+PGM_MetaAttribute const* const PGM_def_update_node_u_init_angle = PGM_meta_get_attribute_by_name(nullptr, "update", "node", "u_init_angle");
 // component line
 PGM_MetaComponent const* const PGM_def_update_line = PGM_meta_get_component_by_name(nullptr, "update", "line");
 // attributes of update line
@@ -13,6 +13,12 @@
 // forward declare all referenced struct/class in C++ core
 // alias them in the root namespace
 
+namespace power_grid_model {
+
+class BatchReduction;
+
+} // namespace power_grid_model
+
 namespace power_grid_model::meta_data {
 
 struct MetaAttribute;
@@ -36,3 +42,4 @@ using PGM_ConstDataset = power_grid_model::meta_data::Dataset<power_grid_model::
 using PGM_MutableDataset = power_grid_model::meta_data::Dataset<power_grid_model::mutable_dataset_t>;
 using PGM_WritableDataset = power_grid_model::meta_data::Dataset<power_grid_model::writable_dataset_t>;
 using PGM_DatasetInfo = power_grid_model::meta_data::DatasetInfo;
+using PGM_BatchReduction = power_grid_model::BatchReduction;
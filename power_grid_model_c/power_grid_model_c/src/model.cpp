@@ -12,8 +12,17 @@
 #include "options.hpp"
 
 #include <power_grid_model/auxiliary/dataset.hpp>
+#include <power_grid_model/auxiliary/meta_data_gen.hpp>
+#include <power_grid_model/batch_reduction.hpp>
+#include <power_grid_model/common/batch_pipeline.hpp>
+#include <power_grid_model/common/calculation_info.hpp>
 #include <power_grid_model/common/common.hpp>
 #include <power_grid_model/main_model.hpp>
+#include <power_grid_model/model_snapshot.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
 
 namespace {
 using namespace power_grid_model;
@@ -22,6 +31,7 @@ using namespace power_grid_model;
 // aliases main class
 struct PGM_PowerGridModel : public MainModel {
     using MainModel::MainModel;
+    explicit PGM_PowerGridModel(MainModel&& model) : MainModel{std::move(model)} {}
 };
 
 // create model
@@ -35,6 +45,40 @@ PGM_PowerGridModel* PGM_create_model(PGM_Handle* handle, double system_frequency
         PGM_regular_error);
 }
 
+// create model using multiple threads
+PGM_PowerGridModel* PGM_create_model_threaded(PGM_Handle* handle, double system_frequency,
+                                              PGM_ConstDataset const* input_dataset, PGM_Idx threading) {
+    return call_with_catch(
+        handle,
+        [system_frequency, input_dataset, threading] {
+            return new PGM_PowerGridModel{system_frequency, *input_dataset, get_math_solver_dispatcher(), 0,
+                                          threading};
+        },
+        PGM_regular_error);
+}
+
+// write model snapshot
+void PGM_save_model_snapshot(PGM_Handle* handle, double system_frequency, PGM_ConstDataset const* input_dataset,
+                             char const* file_path) {
+    call_with_catch(
+        handle,
+        [system_frequency, input_dataset, file_path] {
+            save_model_snapshot(file_path, system_frequency, *input_dataset, get_math_solver_dispatcher());
+        },
+        PGM_regular_error);
+}
+
+// restore model from snapshot
+PGM_PowerGridModel* PGM_load_model_snapshot(PGM_Handle* handle, char const* file_path) {
+    return call_with_catch(
+        handle,
+        [file_path] {
+            return new PGM_PowerGridModel{
+                load_model_snapshot(file_path, meta_data::meta_data_gen::meta_data, get_math_solver_dispatcher())};
+        },
+        PGM_serialization_error);
+}
+
 // update model
 void PGM_update_model(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_ConstDataset const* update_dataset) {
     call_with_catch(
@@ -129,34 +173,44 @@ constexpr auto get_short_circuit_voltage_scaling(PGM_Options const& opt) {
     return static_cast<ShortCircuitVoltageScaling>(opt.short_circuit_voltage_scaling);
 }
 
+constexpr auto get_sparse_ordering(PGM_Options const& opt) {
+    switch (opt.sparse_ordering) {
+    case PGM_sparse_ordering_minimum_degree:
+        return SparseOrderingMethod::minimum_degree;
+    case PGM_sparse_ordering_approximate_minimum_degree:
+        return SparseOrderingMethod::approximate_minimum_degree;
+    default:
+        throw MissingCaseForEnumError{"get_sparse_ordering", opt.sparse_ordering};
+    }
+}
+
 constexpr auto extract_calculation_options(PGM_Options const& opt) {
     return MainModel::Options{.calculation_type = get_calculation_type(opt),
                               .calculation_symmetry = get_calculation_symmetry(opt),
                               .calculation_method = get_calculation_method(opt),
                               .optimizer_type = get_optimizer_type(opt),
                               .optimizer_strategy = get_optimizer_strategy(opt),
+                              .tap_sensitivity_search = opt.tap_sensitivity_search != 0,
                               .err_tol = opt.err_tol,
                               .max_iter = opt.max_iter,
                               .threading = opt.threading,
-                              .short_circuit_voltage_scaling = get_short_circuit_voltage_scaling(opt)};
+                              .batch_chunk_size = opt.batch_chunk_size,
+                              .linear_panel_size = opt.linear_panel_size,
+                              .sparse_solver_threading = opt.sparse_solver_threading,
+                              .island_threading = opt.island_threading,
+                              .warm_start = opt.warm_start > 0,
+                              .flat_start = opt.warm_start < 0,
+                              .sparse_ordering = get_sparse_ordering(opt),
+                              .short_circuit_voltage_scaling = get_short_circuit_voltage_scaling(opt),
+                              .short_circuit_sweep = opt.short_circuit_sweep != 0};
 }
 } // namespace
 
-// run calculation
-void PGM_calculate(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
-                   PGM_MutableDataset const* output_dataset, PGM_ConstDataset const* batch_dataset) {
-    PGM_clear_error(handle);
-    // check dataset integrity
-    if ((batch_dataset != nullptr) && (!batch_dataset->is_batch() || !output_dataset->is_batch())) {
-        handle->err_code = PGM_regular_error;
-        handle->err_msg = "If batch_dataset is provided. Both batch_dataset and output_dataset should be a batch!\n";
-        return;
-    }
-
-    ConstDataset const& exported_update_dataset =
-        batch_dataset != nullptr ? *batch_dataset : PGM_ConstDataset{false, 1, "update", output_dataset->meta_data()};
-
-    // call calculation
+namespace {
+// check the options and run the calculation, reporting the errors in the handle
+template <typename CalculateFn>
+    requires std::invocable<CalculateFn&, MainModel::Options const&>
+void run_calculation(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt, CalculateFn calculate) {
     try {
         check_calculate_valid_options(*opt);
         auto const options = extract_calculation_options(*opt);
@@ -165,7 +219,7 @@ void PGM_calculate(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options co
             check_no_experimental_features_used(*model, options);
         }
 
-        model->calculate(options, *output_dataset, exported_update_dataset);
+        calculate(options);
     } catch (BatchCalculationError& e) {
         handle->err_code = PGM_batch_error;
         handle->err_msg = e.what();
@@ -179,6 +233,138 @@ void PGM_calculate(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options co
         handle->err_msg = "Unknown error!\n";
     }
 }
+} // namespace
+
+// run calculation
+void PGM_calculate(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                   PGM_MutableDataset const* output_dataset, PGM_ConstDataset const* batch_dataset) {
+    PGM_clear_error(handle);
+    // check dataset integrity
+    if ((batch_dataset != nullptr) && (!batch_dataset->is_batch() || !output_dataset->is_batch())) {
+        handle->err_code = PGM_regular_error;
+        handle->err_msg = "If batch_dataset is provided. Both batch_dataset and output_dataset should be a batch!\n";
+        return;
+    }
+
+    ConstDataset const& exported_update_dataset =
+        batch_dataset != nullptr ? *batch_dataset : PGM_ConstDataset{false, 1, "update", output_dataset->meta_data()};
+
+    // call calculation
+    run_calculation(handle, model, opt, [model, output_dataset, &exported_update_dataset](auto const& options) {
+        model->calculate(options, *output_dataset, exported_update_dataset);
+    });
+}
+
+// run pipelined batch calculation
+static_assert(batch_pipeline_n_slots == 3); // documented in the C API
+
+void PGM_calculate_pipelined(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                             PGM_Idx batch_size, PGM_Idx chunk_size, PGM_BatchChunkProducer producer,
+                             PGM_BatchChunkConsumer consumer, void* user_data) {
+    PGM_clear_error(handle);
+
+    auto const produce = [producer, user_data](Idx slot, Idx scenario_begin, Idx scenario_end) {
+        PGM_ConstDataset const* batch_dataset{};
+        PGM_MutableDataset const* output_dataset{};
+        if (producer(user_data, slot, scenario_begin, scenario_end, &batch_dataset, &output_dataset) != 0 ||
+            batch_dataset == nullptr || output_dataset == nullptr) {
+            throw BatchPipelineAborted{"producer", scenario_begin, scenario_end};
+        }
+        if (!batch_dataset->is_batch() || !output_dataset->is_batch()) {
+            throw DatasetError{"Both batch_dataset and output_dataset of a chunk should be a batch!\n"};
+        }
+        return std::pair<ConstDataset, MutableDataset>{*batch_dataset, *output_dataset};
+    };
+    auto const consume = [consumer, user_data](Idx slot, Idx scenario_begin, Idx scenario_end) {
+        if (consumer(user_data, slot, scenario_begin, scenario_end) != 0) {
+            throw BatchPipelineAborted{"consumer", scenario_begin, scenario_end};
+        }
+    };
+
+    run_calculation(handle, model, opt, [model, batch_size, chunk_size, &produce, &consume](auto const& options) {
+        model->calculate_pipelined(options, batch_size, chunk_size, produce, consume);
+    });
+}
+
+// run reduced batch calculation
+void PGM_calculate_reduced(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
+                           PGM_BatchReduction const* reduction, PGM_ConstDataset const* batch_dataset) {
+    PGM_clear_error(handle);
+    if (!batch_dataset->is_batch()) {
+        handle->err_code = PGM_regular_error;
+        handle->err_msg = "The batch_dataset of a reduced calculation should be a batch!\n";
+        return;
+    }
+
+    run_calculation(handle, model, opt, [model, reduction, batch_dataset](auto const& options) {
+        model->calculate(options, *reduction, *batch_dataset);
+    });
+}
+
+// calculation profile
+PGM_Idx PGM_calculation_profile_n_entries(PGM_Handle* /* handle */) { return n_log_events; }
+
+char const* PGM_calculation_profile_entry_name(PGM_Handle* handle, PGM_Idx entry) {
+    return call_with_catch(
+        handle,
+        [entry]() -> char const* {
+            if (entry < 0 || entry >= n_log_events) {
+                throw std::out_of_range{"Index out of range!\n"};
+            }
+            // the names are null-terminated string literals
+            return log_event_descriptions[entry].name.data();
+        },
+        PGM_regular_error);
+}
+
+PGM_Idx PGM_calculation_profile_entry_code(PGM_Handle* handle, PGM_Idx entry) {
+    return call_with_catch(
+        handle,
+        [entry]() -> PGM_Idx {
+            if (entry < 0 || entry >= n_log_events) {
+                throw std::out_of_range{"Index out of range!\n"};
+            }
+            return log_event_descriptions[entry].code;
+        },
+        PGM_regular_error);
+}
+
+PGM_Idx PGM_calculation_profile_n_histogram_bins(PGM_Handle* /* handle */) { return log2_histogram::n_bins; }
+
+PGM_Idx PGM_calculation_profile_n_scenarios(PGM_Handle* /* handle */, PGM_PowerGridModel const* model) {
+    return static_cast<PGM_Idx>(model->scenario_calculation_info().size());
+}
+
+void PGM_get_calculation_profile(PGM_Handle* handle, PGM_PowerGridModel const* model, double* scenario_profile,
+                                 double* aggregated_profile, PGM_Idx* histogram) {
+    call_with_catch(
+        handle,
+        [model, scenario_profile, aggregated_profile, histogram] {
+            auto const& scenario_infos = model->scenario_calculation_info();
+            if (histogram != nullptr) {
+                std::fill_n(histogram, n_log_events * log2_histogram::n_bins, PGM_Idx{0});
+            }
+            for (Idx scenario = 0; scenario != static_cast<Idx>(scenario_infos.size()); ++scenario) {
+                for (Idx entry = 0; entry != n_log_events; ++entry) {
+                    auto const event = static_cast<LogEvent>(entry);
+                    auto const value = scenario_infos[scenario].get(event);
+                    if (scenario_profile != nullptr) {
+                        scenario_profile[scenario * n_log_events + entry] = value;
+                    }
+                    if (histogram != nullptr && scenario_infos[scenario].has(event)) {
+                        ++histogram[entry * log2_histogram::n_bins + log2_histogram::bin(value)];
+                    }
+                }
+            }
+            if (aggregated_profile != nullptr) {
+                auto const aggregated = model->calculation_info();
+                for (Idx entry = 0; entry != n_log_events; ++entry) {
+                    aggregated_profile[entry] = aggregated.get(static_cast<LogEvent>(entry));
+                }
+            }
+        },
+        PGM_regular_error);
+}
 
 // destroy model
 void PGM_destroy_model(PGM_PowerGridModel* model) { delete model; }
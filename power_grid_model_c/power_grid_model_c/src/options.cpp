@@ -26,13 +26,37 @@ void PGM_set_symmetric(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx sym)
 void PGM_set_err_tol(PGM_Handle* /* handle */, PGM_Options* opt, double err_tol) { opt->err_tol = err_tol; }
 void PGM_set_max_iter(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx max_iter) { opt->max_iter = max_iter; }
 void PGM_set_threading(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx threading) { opt->threading = threading; }
+void PGM_set_batch_chunk_size(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx batch_chunk_size) {
+    opt->batch_chunk_size = batch_chunk_size;
+}
+void PGM_set_linear_panel_size(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx linear_panel_size) {
+    opt->linear_panel_size = linear_panel_size;
+}
+void PGM_set_sparse_solver_threading(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx sparse_solver_threading) {
+    opt->sparse_solver_threading = sparse_solver_threading;
+}
+void PGM_set_island_threading(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx island_threading) {
+    opt->island_threading = island_threading;
+}
+void PGM_set_warm_start(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx warm_start) {
+    opt->warm_start = warm_start;
+}
 void PGM_set_short_circuit_voltage_scaling(PGM_Handle* /* handle */, PGM_Options* opt,
                                            PGM_Idx short_circuit_voltage_scaling) {
     opt->short_circuit_voltage_scaling = short_circuit_voltage_scaling;
 }
+void PGM_set_short_circuit_sweep(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx short_circuit_sweep) {
+    opt->short_circuit_sweep = short_circuit_sweep;
+}
 void PGM_set_tap_changing_strategy(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx tap_changing_strategy) {
     opt->tap_changing_strategy = tap_changing_strategy;
 }
+void PGM_set_tap_sensitivity_search(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx tap_sensitivity_search) {
+    opt->tap_sensitivity_search = tap_sensitivity_search;
+}
+void PGM_set_sparse_ordering(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx sparse_ordering) {
+    opt->sparse_ordering = sparse_ordering;
+}
 void PGM_set_experimental_features(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx experimental_features) {
     opt->experimental_features = experimental_features;
 }
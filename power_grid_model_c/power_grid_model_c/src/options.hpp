@@ -23,7 +23,15 @@ struct PGM_Options {
     double err_tol{1e-8};
     Idx max_iter{20};
     Idx threading{-1};
+    Idx batch_chunk_size{0};
+    Idx linear_panel_size{1};
+    Idx sparse_solver_threading{-1};
+    Idx island_threading{-1};
+    Idx warm_start{0};
     Idx short_circuit_voltage_scaling{PGM_short_circuit_voltage_scaling_maximum};
+    Idx short_circuit_sweep{0};
     Idx tap_changing_strategy{PGM_tap_changing_strategy_disabled};
+    Idx tap_sensitivity_search{0};
+    Idx sparse_ordering{PGM_sparse_ordering_minimum_degree};
     Idx experimental_features{PGM_experimental_features_disabled};
 };
@@ -41,6 +41,18 @@ PGM_Deserializer* PGM_create_deserializer_from_null_terminated_string(PGM_Handle
         PGM_serialization_error);
 }
 
+PGM_Deserializer* PGM_create_deserializer_from_file(PGM_Handle* handle, char const* file_path,
+                                                    PGM_Idx serialization_format) {
+    return call_with_catch(
+        handle,
+        [file_path, serialization_format] {
+            return new PGM_Deserializer{from_file, file_path,
+                                        static_cast<power_grid_model::SerializationFormat>(serialization_format),
+                                        get_meta_data()};
+        },
+        PGM_serialization_error);
+}
+
 PGM_WritableDataset* PGM_deserializer_get_dataset(PGM_Handle* /*unused*/, PGM_Deserializer* deserializer) {
     return &deserializer->get_dataset_info();
 }
@@ -49,6 +61,24 @@ void PGM_deserializer_parse_to_buffer(PGM_Handle* handle, PGM_Deserializer* dese
     call_with_catch(handle, [deserializer] { deserializer->parse(); }, PGM_serialization_error);
 }
 
+PGM_Idx PGM_deserializer_get_scenario_range_total_elements(PGM_Handle* handle, PGM_Deserializer* deserializer,
+                                                           char const* component, PGM_Idx scenario_begin,
+                                                           PGM_Idx scenario_end) {
+    return call_with_catch(
+        handle,
+        [deserializer, component, scenario_begin, scenario_end] {
+            return deserializer->get_scenario_range_total_elements(component, scenario_begin, scenario_end);
+        },
+        PGM_serialization_error);
+}
+
+void PGM_deserializer_parse_scenario_range_to_buffer(PGM_Handle* handle, PGM_Deserializer* deserializer,
+                                                     PGM_Idx scenario_begin, PGM_Idx scenario_end) {
+    call_with_catch(
+        handle, [deserializer, scenario_begin, scenario_end] { deserializer->parse(scenario_begin, scenario_end); },
+        PGM_serialization_error);
+}
+
 // false warning from clang-tidy
 // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
 void PGM_destroy_deserializer(PGM_Deserializer* deserializer) { delete deserializer; }
@@ -43,6 +43,7 @@ using RawDatasetInfo = PGM_DatasetInfo;
 using RawOptions = PGM_Options;
 using RawDeserializer = PGM_Deserializer;
 using RawSerializer = PGM_Serializer;
+using RawBatchReduction = PGM_BatchReduction;
 
 namespace detail {
 // custom deleter
@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#ifndef POWER_GRID_MODEL_CPP_BATCH_REDUCTION_HPP
+#define POWER_GRID_MODEL_CPP_BATCH_REDUCTION_HPP
+
+#include "basics.hpp"
+#include "handle.hpp"
+
+#include "power_grid_model_c/batch_reduction.h"
+
+#include <string>
+
+namespace power_grid_model_cpp {
+class BatchReduction {
+  public:
+    explicit BatchReduction(std::string const& dataset)
+        : reduction_{handle_.call_with(PGM_create_batch_reduction, dataset.c_str())} {}
+
+    RawBatchReduction* get() { return reduction_.get(); }
+    RawBatchReduction const* get() const { return reduction_.get(); }
+
+    // the result buffer contains double values for the minimum, maximum and mean, and Idx values otherwise
+    void add(std::string const& component, std::string const& attribute, Idx type, double threshold,
+             RawDataPtr result) {
+        handle_.call_with(PGM_batch_reduction_add, get(), component.c_str(), attribute.c_str(), type, threshold,
+                          result);
+    }
+
+  private:
+    Handle handle_{};
+    detail::UniquePtr<RawBatchReduction, &PGM_destroy_batch_reduction> reduction_;
+};
+} // namespace power_grid_model_cpp
+
+#endif // POWER_GRID_MODEL_CPP_BATCH_REDUCTION_HPP
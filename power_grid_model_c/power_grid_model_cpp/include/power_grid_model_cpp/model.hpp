@@ -7,17 +7,35 @@
 #define POWER_GRID_MODEL_CPP_MODEL_HPP
 
 #include "basics.hpp"
+#include "batch_reduction.hpp"
 #include "dataset.hpp"
 #include "handle.hpp"
 #include "options.hpp"
 
 #include "power_grid_model_c/model.h"
 
+#include <concepts>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <utility>
+
 namespace power_grid_model_cpp {
 class Model {
   public:
     Model(double system_frequency, DatasetConst const& input_dataset)
         : model_{handle_.call_with(PGM_create_model, system_frequency, input_dataset.get())} {}
+    // construction using multiple threads, see PGM_create_model_threaded
+    Model(double system_frequency, DatasetConst const& input_dataset, Idx threading)
+        : model_{handle_.call_with(PGM_create_model_threaded, system_frequency, input_dataset.get(), threading)} {}
+    // snapshot of the model created from the input data, see PGM_save_model_snapshot and PGM_load_model_snapshot
+    static void save_snapshot(std::string const& file_path, double system_frequency,
+                              DatasetConst const& input_dataset) {
+        Handle const handle{};
+        handle.call_with(PGM_save_model_snapshot, system_frequency, input_dataset.get(), file_path.c_str());
+    }
+    static Model load_snapshot(std::string const& file_path) { return Model{file_path}; }
+
     Model(Model const& other) : model_{handle_.call_with(PGM_copy_model, other.get())} {}
     Model& operator=(Model const& other) {
         if (this != &other) {
@@ -54,9 +72,93 @@ class Model {
         handle_.call_with(PGM_calculate, get(), opt.get(), output_dataset.get(), nullptr);
     }
 
+    // pipelined batch calculation, see PGM_calculate_pipelined
+    //    produce(slot, scenario_begin, scenario_end) returns the datasets of the chunk as a BatchChunk
+    //    consume(slot, scenario_begin, scenario_end) is called when the results of the chunk are written
+    //    an exception thrown by a callback aborts the calculation and is re-thrown
+    using BatchChunk = std::pair<DatasetConst const&, DatasetMutable const&>;
+
+    template <typename Produce, typename Consume>
+        requires std::is_invocable_r_v<BatchChunk, Produce&, Idx, Idx, Idx> && std::invocable<Consume&, Idx, Idx, Idx>
+    void calculate_pipelined(Options const& opt, Idx batch_size, Idx chunk_size, Produce produce, Consume consume) {
+        struct Callbacks {
+            Produce& produce;
+            Consume& consume;
+            // the producer and the consumer run in different threads
+            std::exception_ptr produce_exception{};
+            std::exception_ptr consume_exception{};
+        } callbacks{.produce = produce, .consume = consume};
+
+        PGM_BatchChunkProducer const producer = [](void* user_data, Idx slot, Idx scenario_begin, Idx scenario_end,
+                                                   RawConstDataset const** batch_dataset,
+                                                   RawMutableDataset const** output_dataset) -> Idx {
+            auto& callbacks_ = *static_cast<Callbacks*>(user_data);
+            try {
+                BatchChunk const chunk = callbacks_.produce(slot, scenario_begin, scenario_end);
+                *batch_dataset = chunk.first.get();
+                *output_dataset = chunk.second.get();
+                return 0;
+            } catch (...) {
+                callbacks_.produce_exception = std::current_exception();
+                return 1;
+            }
+        };
+        PGM_BatchChunkConsumer const consumer = [](void* user_data, Idx slot, Idx scenario_begin,
+                                                   Idx scenario_end) -> Idx {
+            auto& callbacks_ = *static_cast<Callbacks*>(user_data);
+            try {
+                callbacks_.consume(slot, scenario_begin, scenario_end);
+                return 0;
+            } catch (...) {
+                callbacks_.consume_exception = std::current_exception();
+                return 1;
+            }
+        };
+
+        try {
+            handle_.call_with(PGM_calculate_pipelined, get(), opt.get(), batch_size, chunk_size, producer, consumer,
+                              static_cast<void*>(&callbacks));
+        } catch (...) {
+            if (callbacks.produce_exception) {
+                std::rethrow_exception(callbacks.produce_exception);
+            }
+            if (callbacks.consume_exception) {
+                std::rethrow_exception(callbacks.consume_exception);
+            }
+            throw;
+        }
+    }
+
+    void calculate_reduced(Options const& opt, BatchReduction const& reduction, DatasetConst const& batch_dataset) {
+        handle_.call_with(PGM_calculate_reduced, get(), opt.get(), reduction.get(), batch_dataset.get());
+    }
+
+    static Idx calculation_profile_n_entries() { return PGM_calculation_profile_n_entries(nullptr); }
+
+    static std::string calculation_profile_entry_name(Idx entry) {
+        Handle const handle{};
+        return std::string{handle.call_with(PGM_calculation_profile_entry_name, entry)};
+    }
+
+    static Idx calculation_profile_entry_code(Idx entry) {
+        Handle const handle{};
+        return handle.call_with(PGM_calculation_profile_entry_code, entry);
+    }
+
+    static Idx calculation_profile_n_histogram_bins() { return PGM_calculation_profile_n_histogram_bins(nullptr); }
+
+    Idx calculation_profile_n_scenarios() const { return PGM_calculation_profile_n_scenarios(nullptr, get()); }
+
+    void get_calculation_profile(double* scenario_profile, double* aggregated_profile, Idx* histogram) const {
+        handle_.call_with(PGM_get_calculation_profile, get(), scenario_profile, aggregated_profile, histogram);
+    }
+
   private:
     Handle handle_{};
     detail::UniquePtr<PowerGridModel, &PGM_destroy_model> model_;
+
+    explicit Model(std::string const& snapshot_file_path)
+        : model_{handle_.call_with(PGM_load_model_snapshot, snapshot_file_path.c_str())} {}
 };
 } // namespace power_grid_model_cpp
 
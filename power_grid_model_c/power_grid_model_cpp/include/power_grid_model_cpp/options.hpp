@@ -31,14 +31,44 @@ class Options {
 
     void set_threading(Idx threading) { handle_.call_with(PGM_set_threading, get(), threading); }
 
+    void set_batch_chunk_size(Idx batch_chunk_size) {
+        handle_.call_with(PGM_set_batch_chunk_size, get(), batch_chunk_size);
+    }
+
+    void set_linear_panel_size(Idx linear_panel_size) {
+        handle_.call_with(PGM_set_linear_panel_size, get(), linear_panel_size);
+    }
+
+    void set_sparse_solver_threading(Idx sparse_solver_threading) {
+        handle_.call_with(PGM_set_sparse_solver_threading, get(), sparse_solver_threading);
+    }
+
+    void set_island_threading(Idx island_threading) {
+        handle_.call_with(PGM_set_island_threading, get(), island_threading);
+    }
+
+    void set_warm_start(Idx warm_start) { handle_.call_with(PGM_set_warm_start, get(), warm_start); }
+
     void set_short_circuit_voltage_scaling(Idx short_circuit_voltage_scaling) {
         handle_.call_with(PGM_set_short_circuit_voltage_scaling, get(), short_circuit_voltage_scaling);
     }
 
+    void set_short_circuit_sweep(Idx short_circuit_sweep) {
+        handle_.call_with(PGM_set_short_circuit_sweep, get(), short_circuit_sweep);
+    }
+
     void set_tap_changing_strategy(Idx tap_changing_strategy) {
         handle_.call_with(PGM_set_tap_changing_strategy, get(), tap_changing_strategy);
     }
 
+    void set_tap_sensitivity_search(Idx tap_sensitivity_search) {
+        handle_.call_with(PGM_set_tap_sensitivity_search, get(), tap_sensitivity_search);
+    }
+
+    void set_sparse_ordering(Idx sparse_ordering) {
+        handle_.call_with(PGM_set_sparse_ordering, get(), sparse_ordering);
+    }
+
     void set_experimental_features(Idx experimental_features) {
         handle_.call_with(PGM_set_experimental_features, get(), experimental_features);
     }
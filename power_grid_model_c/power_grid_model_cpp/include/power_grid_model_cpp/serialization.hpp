@@ -13,7 +13,9 @@
 
 #include "power_grid_model_c/serialization.h"
 
+#include <concepts>
 #include <cstring>
+#include <filesystem>
 
 namespace power_grid_model_cpp {
 class Deserializer {
@@ -31,6 +33,12 @@ class Deserializer {
         : deserializer_{handle_.call_with(PGM_create_deserializer_from_null_terminated_string, data_string.c_str(),
                                           serialization_format)},
           dataset_{handle_.call_with(PGM_deserializer_get_dataset, get())} {}
+    // a string is the serialized data itself, only an explicit path refers to a (memory mapped) file
+    template <std::same_as<std::filesystem::path> Path>
+    Deserializer(Path const& file_path, Idx serialization_format)
+        : deserializer_{handle_.call_with(PGM_create_deserializer_from_file, file_path.string().c_str(),
+                                          serialization_format)},
+          dataset_{handle_.call_with(PGM_deserializer_get_dataset, get())} {}
 
     RawDeserializer* get() { return deserializer_.get(); }
     RawDeserializer const* get() const { return deserializer_.get(); }
@@ -39,6 +47,15 @@ class Deserializer {
 
     void parse_to_buffer() { handle_.call_with(PGM_deserializer_parse_to_buffer, get()); }
 
+    Idx get_scenario_range_total_elements(std::string const& component, Idx scenario_begin, Idx scenario_end) {
+        return handle_.call_with(PGM_deserializer_get_scenario_range_total_elements, get(), component.c_str(),
+                                 scenario_begin, scenario_end);
+    }
+
+    void parse_to_buffer(Idx scenario_begin, Idx scenario_end) {
+        handle_.call_with(PGM_deserializer_parse_scenario_range_to_buffer, get(), scenario_begin, scenario_end);
+    }
+
   private:
     Handle handle_{};
     detail::UniquePtr<RawDeserializer, &PGM_destroy_deserializer> deserializer_;
@@ -40,8 +40,15 @@ class Options:
     error_tolerance = OptionSetter(pgc.set_err_tol)
     max_iterations = OptionSetter(pgc.set_max_iter)
     threading = OptionSetter(pgc.set_threading)
+    batch_chunk_size = OptionSetter(pgc.set_batch_chunk_size)
+    linear_panel_size = OptionSetter(pgc.set_linear_panel_size)
+    sparse_solver_threading = OptionSetter(pgc.set_sparse_solver_threading)
+    island_threading = OptionSetter(pgc.set_island_threading)
+    warm_start = OptionSetter(pgc.set_warm_start)
     tap_changing_strategy = OptionSetter(pgc.set_tap_changing_strategy)
+    tap_sensitivity_search = OptionSetter(pgc.set_tap_sensitivity_search)
     short_circuit_voltage_scaling = OptionSetter(pgc.set_short_circuit_voltage_scaling)
+    short_circuit_sweep = OptionSetter(pgc.set_short_circuit_sweep)
     experimental_features = OptionSetter(pgc.set_experimental_features)
 
     @property
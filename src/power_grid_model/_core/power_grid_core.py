@@ -344,12 +344,24 @@ class PowerGridCore:
     ) -> None:  # type: ignore[empty-body]
         pass  # pragma: no cover
 
+    @make_c_binding
+    def set_tap_sensitivity_search(
+        self, opt: OptionsPtr, tap_sensitivity_search: int
+    ) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
     @make_c_binding
     def set_short_circuit_voltage_scaling(
         self, opt: OptionsPtr, short_circuit_voltage_scaling: int
     ) -> None:  # type: ignore[empty-body]
         pass  # pragma: no cover
 
+    @make_c_binding
+    def set_short_circuit_sweep(
+        self, opt: OptionsPtr, short_circuit_sweep: int
+    ) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
     @make_c_binding
     def set_experimental_features(
         self, opt: OptionsPtr, experimental_features: int
@@ -372,6 +384,28 @@ class PowerGridCore:
     def set_threading(self, opt: OptionsPtr, threading: int) -> None:  # type: ignore[empty-body]
         pass  # pragma: no cover
 
+    @make_c_binding
+    def set_batch_chunk_size(self, opt: OptionsPtr, batch_chunk_size: int) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def set_linear_panel_size(self, opt: OptionsPtr, linear_panel_size: int) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def set_sparse_solver_threading(  # type: ignore[empty-body]
+        self, opt: OptionsPtr, sparse_solver_threading: int
+    ) -> None:
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def set_island_threading(self, opt: OptionsPtr, island_threading: int) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
+    @make_c_binding
+    def set_warm_start(self, opt: OptionsPtr, warm_start: int) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
     @make_c_binding
     def create_model(  # type: ignore[empty-body]
         self,
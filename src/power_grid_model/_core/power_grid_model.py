@@ -318,6 +318,10 @@ class PowerGridModel:
         continue_on_batch_error: bool = False,
         decode_error: bool = True,
         tap_changing_strategy: TapChangingStrategy | str = TapChangingStrategy.disabled,
+        warm_start: int = 0,
+        island_threading: int = -1,
+        linear_panel_size: int = 1,
+        tap_sensitivity_search: bool = False,
         experimental_features: _ExperimentalFeatures | str = _ExperimentalFeatures.disabled,
     ):
         calculation_type = CalculationType.power_flow
@@ -329,6 +333,10 @@ class PowerGridModel:
             calculation_method=calculation_method,
             tap_changing_strategy=tap_changing_strategy,
             threading=threading,
+            warm_start=warm_start,
+            island_threading=island_threading,
+            linear_panel_size=linear_panel_size,
+            tap_sensitivity_search=tap_sensitivity_search,
             experimental_features=experimental_features,
         )
         return self._calculate_impl(
@@ -354,6 +362,7 @@ class PowerGridModel:
         output_component_types: ComponentAttributeMapping = None,
         continue_on_batch_error: bool = False,
         decode_error: bool = True,
+        island_threading: int = -1,
         experimental_features: _ExperimentalFeatures | str = _ExperimentalFeatures.disabled,
     ) -> dict[ComponentType, np.ndarray]:
         calculation_type = CalculationType.state_estimation
@@ -364,6 +373,7 @@ class PowerGridModel:
             max_iterations=max_iterations,
             calculation_method=calculation_method,
             threading=threading,
+            island_threading=island_threading,
             experimental_features=experimental_features,
         )
         return self._calculate_impl(
@@ -387,6 +397,8 @@ class PowerGridModel:
         continue_on_batch_error: bool = False,
         decode_error: bool = True,
         short_circuit_voltage_scaling: ShortCircuitVoltageScaling | str = ShortCircuitVoltageScaling.maximum,
+        short_circuit_sweep: bool = False,
+        island_threading: int = -1,
         experimental_features: _ExperimentalFeatures | str = _ExperimentalFeatures.disabled,
     ) -> dict[ComponentType, np.ndarray]:
         calculation_type = CalculationType.short_circuit
@@ -398,6 +410,8 @@ class PowerGridModel:
             calculation_method=calculation_method,
             threading=threading,
             short_circuit_voltage_scaling=short_circuit_voltage_scaling,
+            short_circuit_sweep=short_circuit_sweep,
+            island_threading=island_threading,
             experimental_features=experimental_features,
         )
         return self._calculate_impl(
@@ -424,6 +438,10 @@ class PowerGridModel:
         continue_on_batch_error: bool = False,
         decode_error: bool = True,
         tap_changing_strategy: TapChangingStrategy | str = TapChangingStrategy.disabled,
+        warm_start: int = 0,
+        island_threading: int = -1,
+        linear_panel_size: int = 1,
+        tap_sensitivity_search: bool = False,
     ) -> dict[ComponentType, np.ndarray]:
         """
         Calculate power flow once with the current model attributes.
@@ -481,6 +499,35 @@ class PowerGridModel:
                 You can still retrieve the errors and succeeded/failed scenarios via the batch_error.
             decode_error (bool, optional):
                 Decode error messages to their derived types if possible.
+            warm_start (int, optional): Initial voltages of the iterative calculation methods.
+
+                - < 0: Flat start, ignore the initial voltages of the nodes.
+                - = 0: Start from the initial voltages of the nodes, if specified (default).
+                - > 0: Start from the initial voltages of the nodes, if specified, or else from the result of the
+                  previous calculation. In a batch calculation, each thread starts a scenario from the result of the
+                  previous scenario it calculated.
+            island_threading (int, optional): Calculate the islands of the grid, each supplied by its own source,
+                concurrently. The result is the same as with the sequential calculation.
+
+                - < 0: Sequential (default)
+                - = 0: Parallel, use number of hardware threads
+                - > 0: Specify number of parallel threads
+            linear_panel_size (int, optional): Applicable only for batch calculation with the linear calculation
+                methods. Consecutive scenarios with the same topology and parameters, e.g. a time series of loads
+                and sources, are solved together in panels. The result is the same as when the scenarios are
+                calculated one by one.
+
+                - <= 1: Calculate the scenarios one by one (default)
+                - > 1: Specify the maximum number of scenarios per panel
+            tap_sensitivity_search (bool, optional): Applicable only for the any_valid_tap and fast_any_tap tap
+                changing strategies. Predict the tap positions from the sensitivity of the controlled voltage to the
+                tap position, measured from the power flows at the last two tap positions, instead of searching them
+                step by step. This needs fewer power flows for transformers with a wide tap range. The resulting tap
+                positions are within the voltage band, but may differ from the ones without sensitivity search if
+                multiple tap positions are within the band.
+
+                - False: Search the tap positions as specified by the tap changing strategy (default)
+                - True: Predict the tap positions from the voltage sensitivity
 
         Returns:
             Dictionary of results of all components.
@@ -508,6 +555,10 @@ class PowerGridModel:
             continue_on_batch_error=continue_on_batch_error,
             decode_error=decode_error,
             tap_changing_strategy=tap_changing_strategy,
+            warm_start=warm_start,
+            island_threading=island_threading,
+            linear_panel_size=linear_panel_size,
+            tap_sensitivity_search=tap_sensitivity_search,
         )
 
     def calculate_state_estimation(
@@ -522,6 +573,7 @@ class PowerGridModel:
         output_component_types: ComponentAttributeMapping = None,
         continue_on_batch_error: bool = False,
         decode_error: bool = True,
+        island_threading: int = -1,
     ) -> dict[ComponentType, np.ndarray]:
         """
         Calculate state estimation once with the current model attributes.
@@ -576,6 +628,12 @@ class PowerGridModel:
                 You can still retrieve the errors and succeeded/failed scenarios via the batch_error.
             decode_error (bool, optional):
                 Decode error messages to their derived types if possible.
+            island_threading (int, optional): Calculate the islands of the grid, each supplied by its own source,
+                concurrently. The result is the same as with the sequential calculation.
+
+                - < 0: Sequential (default)
+                - = 0: Parallel, use number of hardware threads
+                - > 0: Specify number of parallel threads
 
         Returns:
             Dictionary of results of all components.
@@ -602,6 +660,7 @@ class PowerGridModel:
             output_component_types=output_component_types,
             continue_on_batch_error=continue_on_batch_error,
             decode_error=decode_error,
+            island_threading=island_threading,
         )
 
     def calculate_short_circuit(
@@ -614,6 +673,8 @@ class PowerGridModel:
         continue_on_batch_error: bool = False,
         decode_error: bool = True,
         short_circuit_voltage_scaling: ShortCircuitVoltageScaling | str = ShortCircuitVoltageScaling.maximum,
+        short_circuit_sweep: bool = False,
+        island_threading: int = -1,
     ) -> dict[ComponentType, np.ndarray]:
         """
         Calculate a short circuit once with the current model attributes.
@@ -663,6 +724,16 @@ class PowerGridModel:
             short_circuit_voltage_scaling ({ShortCircuitVoltageSaling, str}, optional):
                 Whether to use the maximum or minimum voltage scaling.
                 By default, the maximum voltage scaling is used to calculate the short circuit.
+            short_circuit_sweep (bool, optional):
+                Whether to calculate the faults from a single factorization of the network without faults.
+                This is much faster for batches of scenarios that only differ in a few faults, e.g. a fault on each
+                node in turn. The result is the same up to numerical round-off. Disabled by default.
+            island_threading (int, optional): Calculate the islands of the grid, each supplied by its own source,
+                concurrently. The result is the same as with the sequential calculation.
+
+                - < 0: Sequential (default)
+                - = 0: Parallel, use number of hardware threads
+                - > 0: Specify number of parallel threads
 
         Returns:
             Dictionary of results of all components.
@@ -686,6 +757,8 @@ class PowerGridModel:
             continue_on_batch_error=continue_on_batch_error,
             decode_error=decode_error,
             short_circuit_voltage_scaling=short_circuit_voltage_scaling,
+            short_circuit_sweep=short_circuit_sweep,
+            island_threading=island_threading,
         )
 
     def __del__(self):
@@ -65,6 +65,7 @@ class CalculationMethod(IntEnum):
     iterative_current = 3
     linear_current = 4
     iec60909 = 5
+    fast_decoupled = 6
 
 
 class TapChangingStrategy(IntEnum):
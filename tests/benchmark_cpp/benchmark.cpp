@@ -5,160 +5,925 @@
 #include "fictional_grid_generator.hpp"
 
 #include <power_grid_model/auxiliary/meta_data_gen.hpp>
+#include <power_grid_model/common/calculation_info.hpp>
 #include <power_grid_model/common/common.hpp>
-#include <power_grid_model/common/timer.hpp>
+#include <power_grid_model/common/thread_pool.hpp>
 #include <power_grid_model/main_model.hpp>
 #include <power_grid_model/math_solver/math_solver.hpp>
+#include <power_grid_model/math_solver/newton_raphson_pf_solver.hpp>
+#include <power_grid_model/sparse_ordering.hpp>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <exception>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <map>
+#include <optional>
 #include <random>
+#include <set>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
 
 namespace power_grid_model::benchmark {
 namespace {
+using Clock = std::chrono::steady_clock;
+
 MathSolverDispatcher const& get_math_solver_dispatcher() {
     static constexpr MathSolverDispatcher math_solver_dispatcher{math_solver::math_solver_tag<MathSolver>{}};
     return math_solver_dispatcher;
 }
 
-struct PowerGridBenchmark {
-    PowerGridBenchmark()
-        : main_model{
-              std::make_unique<MainModel>(50.0, meta_data::meta_data_gen::meta_data, get_math_solver_dispatcher())} {}
+double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>{Clock::now() - start}.count();
+}
 
-    template <symmetry_tag sym>
-    void run_pf(CalculationMethod calculation_method, CalculationInfo& info, Idx batch_size = -1, Idx threading = -1) {
-        if (!main_model) {
-            std::cout << "\nNo main model available: skipping benchmark.\n";
+constexpr std::array<std::string_view, 9> all_suites{"pf",     "se",       "sc",       "tap",     "batch",
+                                                     "sparse", "ordering", "id_index", "jacobian"};
+
+constexpr std::string_view usage = R"(Usage: power_grid_model_benchmark_cpp [options]
+
+Grid (see FictionalGridGenerator):
+  --nodes <n>                      rough total number of nodes
+  --mv-feeders <n>                 number of mv feeders
+  --nodes-per-mv-feeder <n>        number of nodes per mv feeder
+  --lv-feeders <n>                 number of lv feeders per lv grid
+  --connections-per-lv-feeder <n>  number of connections per lv feeder
+  --meshing <radial|meshed|both>   radial feeders, rings of feeders, or both (default: both)
+  --seed <n>                       seed of the grid and the load profiles (default: 0)
+
+Cases:
+  --suites <list>    comma separated, out of pf, se, sc, tap, batch, sparse, ordering, id_index, jacobian
+                     (default: all)
+                       pf: power flow, all methods
+                       se: state estimation, iterative linear and Newton-Raphson
+                       sc: IEC 60909 short circuit, single fault and fault sweep
+                       tap: power flow with automatic tap changing
+                       batch: load profile, N-1 contingency and fault sweep batches for each thread count
+                       sparse: single power flow for each sparse solver thread count
+                       ordering: fill-reducing ordering of the node admittance graph
+                       id_index: model construction and lookup of components by ID
+                       jacobian: asymmetric Newton-Raphson jacobian blocks, scalar and AVX kernel
+  --batch-size <n>   number of scenarios of the batch calculations
+  --threads <list>   comma separated thread counts of the scaling sweeps, -1 is sequential and 0 uses all
+                     hardware threads (default: -1, the powers of two below the hardware threads, and those)
+  --repeat <n>       number of runs of each case (default: 3)
+
+Output:
+  --output <path>    write the results as JSON to this file
+  --help             show this message
+)";
+
+// configuration of a benchmark run, from the command line
+struct Config {
+    Option option{};
+    std::vector<bool> meshed{false, true};
+    std::random_device::result_type seed{0};
+    std::set<std::string, std::less<>> suites{all_suites.begin(), all_suites.end()};
+    Idx batch_size{};
+    std::vector<Idx> threads;
+    Idx repeat{3};
+    std::string output;
+
+    bool has_suite(std::string_view suite) const { return suites.contains(suite); }
+};
+
+// result of one benchmark case
+//    the wall time of each run is recorded, the calculation info is the one of the last run
+struct CaseResult {
+    using Value = std::variant<std::string, Idx, bool>;
+
+    std::string suite;
+    std::vector<std::pair<std::string, Value>> parameters;
+    std::vector<double> times;
+    std::vector<std::pair<std::string, double>> metrics;
+    CalculationInfo info;
+    std::string error;
+
+    double median() const {
+        if (times.empty()) {
+            return nan;
+        }
+        auto sorted = times;
+        std::ranges::sort(sorted);
+        auto const middle = sorted.size() / 2;
+        return sorted.size() % 2 == 1 ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2.0;
+    }
+};
+
+std::string to_string(CalculationType calculation_type) {
+    switch (calculation_type) {
+        using enum CalculationType;
+    case power_flow:
+        return "power_flow";
+    case state_estimation:
+        return "state_estimation";
+    case short_circuit:
+        return "short_circuit";
+    default:
+        throw MissingCaseForEnumError{"benchmark::to_string", calculation_type};
+    }
+}
+
+std::string to_string(CalculationMethod calculation_method) {
+    switch (calculation_method) {
+        using enum CalculationMethod;
+    case default_method:
+        return "default_method";
+    case linear:
+        return "linear";
+    case newton_raphson:
+        return "newton_raphson";
+    case iterative_linear:
+        return "iterative_linear";
+    case iterative_current:
+        return "iterative_current";
+    case linear_current:
+        return "linear_current";
+    case iec60909:
+        return "iec60909";
+    case fast_decoupled:
+        return "fast_decoupled";
+    default:
+        throw MissingCaseForEnumError{"benchmark::to_string", calculation_method};
+    }
+}
+
+std::string to_string(OptimizerStrategy optimizer_strategy) {
+    switch (optimizer_strategy) {
+        using enum OptimizerStrategy;
+    case any:
+        return "any";
+    case global_minimum:
+        return "global_minimum";
+    case global_maximum:
+        return "global_maximum";
+    case local_minimum:
+        return "local_minimum";
+    case local_maximum:
+        return "local_maximum";
+    case fast_any:
+        return "fast_any";
+    default:
+        throw MissingCaseForEnumError{"benchmark::to_string", optimizer_strategy};
+    }
+}
+
+// minimal JSON writer for the report
+//    the separators and the indentation are inserted automatically
+class JsonWriter {
+  public:
+    explicit JsonWriter(std::ostream& os) : os_{&os} { *os_ << std::setprecision(9); }
+
+    void begin_object() { open('{'); }
+    void end_object() { close('}'); }
+    void begin_array() { open('['); }
+    void end_array() { close(']'); }
+    void key(std::string_view name) {
+        separate();
+        write_string(name);
+        *os_ << ": ";
+        after_key_ = true;
+    }
+
+    void string(std::string_view value) {
+        separate();
+        write_string(value);
+    }
+    void number(double value) {
+        separate();
+        if (std::isfinite(value)) {
+            *os_ << value;
+        } else {
+            *os_ << "null";
+        }
+    }
+    void number(Idx value) {
+        separate();
+        *os_ << value;
+    }
+    void boolean(bool value) {
+        separate();
+        *os_ << (value ? "true" : "false");
+    }
+    void value(CaseResult::Value const& value) {
+        std::visit(
+            [this]<typename T>(T const& x) {
+                if constexpr (std::same_as<T, std::string>) {
+                    string(x);
+                } else if constexpr (std::same_as<T, bool>) {
+                    boolean(x);
+                } else {
+                    number(x);
+                }
+            },
+            value);
+    }
+
+  private:
+    std::ostream* os_;
+    std::vector<bool> is_first_; // whether the next value is the first of the object or array
+    bool after_key_{false};
+
+    void separate() {
+        if (after_key_) {
+            after_key_ = false;
             return;
         }
+        if (is_first_.empty()) {
+            return;
+        }
+        if (!is_first_.back()) {
+            *os_ << ',';
+        }
+        is_first_.back() = false;
+        *os_ << '\n' << std::string(2 * is_first_.size(), ' ');
+    }
+    void open(char bracket) {
+        separate();
+        *os_ << bracket;
+        is_first_.push_back(true);
+    }
+    void close(char bracket) {
+        bool const empty = is_first_.back();
+        is_first_.pop_back();
+        if (!empty) {
+            *os_ << '\n' << std::string(2 * is_first_.size(), ' ');
+        }
+        *os_ << bracket;
+    }
+    void write_string(std::string_view value) {
+        *os_ << '"';
+        for (char const c : value) {
+            if (c == '"' || c == '\\') {
+                *os_ << '\\' << c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                *os_ << ' ';
+            } else {
+                *os_ << c;
+            }
+        }
+        *os_ << '"';
+    }
+};
+
+class PowerGridBenchmark {
+  public:
+    explicit PowerGridBenchmark(Config config) : config_{std::move(config)} {}
+
+    void run() {
+        using Suite = void (PowerGridBenchmark::*)();
+        std::array<std::pair<std::string_view, Suite>, all_suites.size()> const suites{{
+            {"pf", &PowerGridBenchmark::run_pf_suite},
+            {"se", &PowerGridBenchmark::run_se_suite},
+            {"sc", &PowerGridBenchmark::run_sc_suite},
+            {"tap", &PowerGridBenchmark::run_tap_suite},
+            {"batch", &PowerGridBenchmark::run_batch_suite},
+            {"sparse", &PowerGridBenchmark::run_sparse_suite},
+            {"ordering", &PowerGridBenchmark::run_ordering_suite},
+            {"id_index", &PowerGridBenchmark::run_id_index_suite},
+            {"jacobian", &PowerGridBenchmark::run_jacobian_suite},
+        }};
+        for (auto const& [name, suite] : suites) {
+            if (config_.has_suite(name)) {
+                (this->*suite)();
+            }
+        }
+    }
+
+    void write_json(std::ostream& os) const {
+        JsonWriter json{os};
+        json.begin_object();
+        json.key("configuration");
+        json.begin_object();
+        json.key("n_node_total_specified");
+        json.number(config_.option.n_node_total_specified);
+        json.key("n_mv_feeder");
+        json.number(config_.option.n_mv_feeder);
+        json.key("n_node_per_mv_feeder");
+        json.number(config_.option.n_node_per_mv_feeder);
+        json.key("n_lv_feeder");
+        json.number(config_.option.n_lv_feeder);
+        json.key("n_connection_per_lv_feeder");
+        json.number(config_.option.n_connection_per_lv_feeder);
+        json.key("seed");
+        json.number(static_cast<Idx>(config_.seed));
+        json.key("batch_size");
+        json.number(config_.batch_size);
+        json.key("repeat");
+        json.number(config_.repeat);
+        json.key("hardware_threads");
+        json.number(ThreadPool::hardware_concurrency());
+        json.key("build_type");
+#ifdef NDEBUG
+        json.string("release");
+#else
+        json.string("debug");
+#endif
+        json.end_object();
+
+        json.key("cases");
+        json.begin_array();
+        for (CaseResult const& result : results_) {
+            json.begin_object();
+            json.key("suite");
+            json.string(result.suite);
+            for (auto const& [name, value] : result.parameters) {
+                json.key(name);
+                json.value(value);
+            }
+            json.key("times");
+            json.begin_array();
+            for (double const time : result.times) {
+                json.number(time);
+            }
+            json.end_array();
+            json.key("median");
+            json.number(result.median());
+            json.key("min");
+            json.number(result.times.empty() ? nan : std::ranges::min(result.times));
+            for (auto const& [name, value] : result.metrics) {
+                json.key(name);
+                json.number(value);
+            }
+            json.key("calculation_info");
+            json.begin_object();
+            for (Idx idx = 0; idx != n_log_events; ++idx) {
+                auto const event = static_cast<LogEvent>(idx);
+                if (result.info.has(event)) {
+                    json.key(describe(event).name);
+                    json.number(result.info.get(event));
+                }
+            }
+            json.end_object();
+            if (!result.error.empty()) {
+                json.key("error");
+                json.string(result.error);
+            }
+            json.end_object();
+        }
+        json.end_array();
+        json.end_object();
+        os << '\n';
+    }
+
+  private:
+    Config config_;
+    std::unique_ptr<MainModel> main_model_;
+    FictionalGridGenerator generator_;
+    bool meshed_{false};
+    std::vector<CaseResult> results_;
+
+    void generate_grid(Option option, bool meshed) {
+        option.has_mv_ring = meshed;
+        option.has_lv_ring = meshed;
+        generator_.generate_grid(option, config_.seed);
+        meshed_ = meshed;
+    }
 
-        OutputData<sym> output = generator.generate_output_data<sym>(batch_size);
-        BatchData const batch_data = generator.generate_batch_input(batch_size, 0);
-        std::cout << "Number of nodes: " << generator.input_data().node.size() << '\n';
-        Idx const max_iter = (calculation_method == CalculationMethod::iterative_current) ? 100 : 20;
+    CaseResult make_case(std::string_view suite, std::string_view name) const {
+        CaseResult result{};
+        result.suite = suite;
+        result.parameters.emplace_back("name", std::string{name});
+        result.parameters.emplace_back("grid", std::string{meshed_ ? "meshed" : "radial"});
+        result.parameters.emplace_back("n_node", std::ssize(generator_.input_data().node));
+        return result;
+    }
+
+    // run func repeat times and record the wall time of each run
+    template <typename Func> void time_runs(CaseResult& result, Func const& func) const {
+        for (Idx run = 0; run != config_.repeat; ++run) {
+            auto const start = Clock::now();
+            func();
+            result.times.push_back(seconds_since(start));
+        }
+    }
+
+    // print a summary line of the case and keep the result for the JSON report
+    void report(CaseResult result) {
+        std::ostringstream line;
+        line << std::setprecision(6) << std::boolalpha << result.suite;
+        for (auto const& [name, value] : result.parameters) {
+            line << ' ' << name << '=';
+            std::visit([&line](auto const& x) { line << x; }, value);
+        }
+        for (auto const& [name, value] : result.metrics) {
+            line << ' ' << name << '=' << value;
+        }
+        if (result.error.empty()) {
+            line << ": " << result.median() << " s";
+        } else {
+            line << ": error: " << result.error;
+        }
+        std::cout << line.str() << std::endl;
+        results_.push_back(std::move(result));
+    }
+
+    // build the model of the generated grid, the build time is recorded
+    void build_model(std::string_view suite) {
+        CaseResult result = make_case(suite, "build_model");
+        time_runs(result, [this] {
+            main_model_ =
+                std::make_unique<MainModel>(50.0, generator_.input_data().get_dataset(), get_math_solver_dispatcher());
+        });
+        report(std::move(result));
+    }
+
+    // run a (batch) calculation on the current model
+    void run_calculation(CaseResult result, MainModel::Options const& options, MutableDataset const& output,
+                         BatchData const& batch_data) {
+        ConstDataset const update_data = batch_data.get_dataset();
+        result.parameters.emplace_back("calculation_type", to_string(options.calculation_type));
+        result.parameters.emplace_back("symmetric", options.calculation_symmetry == CalculationSymmetry::symmetric);
+        result.parameters.emplace_back("calculation_method", to_string(options.calculation_method));
+        result.parameters.emplace_back("batch_size", batch_data.batch_size);
+        result.parameters.emplace_back("threading", options.threading);
+        result.parameters.emplace_back("sparse_solver_threading", options.sparse_solver_threading);
         try {
-            // calculate
-            main_model->calculate({.calculation_type = CalculationType::power_flow,
-                                   .calculation_symmetry = is_symmetric_v<sym> ? CalculationSymmetry::symmetric
-                                                                               : CalculationSymmetry::asymmetric,
-                                   .calculation_method = calculation_method,
-                                   .err_tol = 1e-8,
-                                   .max_iter = max_iter,
-                                   .threading = threading},
-                                  output.get_dataset(), batch_data.get_dataset());
-            CalculationInfo info_extra = main_model->calculation_info();
-            info.merge(info_extra);
+            time_runs(result, [this, &options, &output, &update_data] {
+                main_model_->calculate(options, output, update_data);
+            });
+            result.info = main_model_->calculation_info();
         } catch (std::exception const& e) {
-            std::cout << "\nAn exception was raised during execution: " << e.what() << '\n';
+            result.error = e.what();
         }
+        report(std::move(result));
     }
 
     template <symmetry_tag sym>
-    void run_benchmark(Option const& option, CalculationMethod calculation_method, Idx batch_size = -1,
-                       Idx threading = -1) {
-        CalculationInfo info;
-        generator.generate_grid(option, 0);
-        InputData const& input = generator.input_data();
-
-        std::string title = "Benchmark case: ";
-        title += option.has_mv_ring ? "meshed grid, " : "radial grid, ";
-        title += is_symmetric_v<sym> ? "symmetric, " : "asymmetric, ";
-        if (calculation_method == CalculationMethod::newton_raphson) {
-            title += "Newton-Raphson method";
-        } else if (calculation_method == CalculationMethod::linear) {
-            title += "Linear method";
-        } else {
-            title += "Iterative current method";
+    void run_pf(CaseResult result, MainModel::Options options, BatchData const& batch_data = {}) {
+        options.calculation_type = CalculationType::power_flow;
+        options.calculation_symmetry =
+            is_symmetric_v<sym> ? CalculationSymmetry::symmetric : CalculationSymmetry::asymmetric;
+        options.max_iter = options.calculation_method == CalculationMethod::iterative_current ? 100 : 20;
+        OutputData<sym> output = generator_.generate_output_data<sym>(batch_data.batch_size);
+        run_calculation(std::move(result), options, output.get_dataset(), batch_data);
+    }
+
+    template <symmetry_tag sym> void run_se(CaseResult result, MainModel::Options options) {
+        options.calculation_type = CalculationType::state_estimation;
+        options.calculation_symmetry =
+            is_symmetric_v<sym> ? CalculationSymmetry::symmetric : CalculationSymmetry::asymmetric;
+        options.max_iter = 100;
+        OutputData<sym> output = generator_.generate_output_data<sym>();
+        run_calculation(std::move(result), options, output.get_dataset(), BatchData{});
+    }
+
+    void run_sc(CaseResult result, MainModel::Options options, BatchData const& batch_data = {}) {
+        options.calculation_type = CalculationType::short_circuit;
+        options.calculation_method = CalculationMethod::iec60909;
+        result.parameters.emplace_back("short_circuit_sweep", options.short_circuit_sweep);
+        ShortCircuitOutputData output = generator_.generate_short_circuit_output_data(batch_data.batch_size);
+        run_calculation(std::move(result), options, output.get_dataset(), batch_data);
+    }
+
+    void run_pf_suite() {
+        using enum CalculationMethod;
+        for (bool const meshed : config_.meshed) {
+            generate_grid(config_.option, meshed);
+            build_model("pf");
+            for (auto const method : {newton_raphson, linear, iterative_current, linear_current}) {
+                run_pf<symmetric_t>(make_case("pf", "power_flow"), {.calculation_method = method});
+            }
+            for (auto const method : {newton_raphson, linear, linear_current}) {
+                run_pf<asymmetric_t>(make_case("pf", "power_flow"), {.calculation_method = method});
+            }
         }
-        std::cout << "=============" << title << "=============\n";
+    }
 
-        {
-            std::cout << "*****Run with initialization*****\n";
-            Timer const t_total(info, 0000, "Total");
+    void run_se_suite() {
+        using enum CalculationMethod;
+        for (bool const meshed : config_.meshed) {
+            generate_grid(config_.option, meshed);
             {
-                Timer const t_build(info, 1000, "Build model");
-                main_model = std::make_unique<MainModel>(50.0, input.get_dataset(), get_math_solver_dispatcher());
+                // the measurements are taken from an asymmetric power flow result
+                MainModel model{50.0, generator_.input_data().get_dataset(), get_math_solver_dispatcher()};
+                OutputData<asymmetric_t> output = generator_.generate_output_data<asymmetric_t>();
+                model.calculate({.calculation_symmetry = CalculationSymmetry::asymmetric,
+                                 .calculation_method = newton_raphson},
+                                output.get_dataset(), BatchData{}.get_dataset());
+                generator_.generate_measurements(output);
+            }
+            build_model("se");
+            for (auto const method : {iterative_linear, newton_raphson}) {
+                run_se<symmetric_t>(make_case("se", "state_estimation"), {.calculation_method = method});
+                run_se<asymmetric_t>(make_case("se", "state_estimation"), {.calculation_method = method});
+            }
+        }
+    }
+
+    void run_sc_suite() {
+        Option option = config_.option;
+        option.has_fault = true;
+        for (bool const meshed : config_.meshed) {
+            generate_grid(option, meshed);
+            build_model("sc");
+            run_sc(make_case("sc", "short_circuit"), {});
+            BatchData const fault_sweep = generator_.generate_fault_batch_input(config_.batch_size);
+            for (bool const sweep : {false, true}) {
+                CaseResult result = make_case("sc", "short_circuit");
+                result.parameters.emplace_back("batch", std::string{"fault_sweep"});
+                run_sc(std::move(result), {.short_circuit_sweep = sweep}, fault_sweep);
             }
-            run_pf<sym>(calculation_method, info);
         }
-        print(info);
-        info.clear();
-        {
-            std::cout << "\n*****Run without initialization*****\n";
-            Timer const t_total(info, 0000, "Total");
-            run_pf<sym>(calculation_method, info);
+    }
+
+    void run_tap_suite() {
+        using enum OptimizerStrategy;
+        Option option = config_.option;
+        option.has_tap_regulator = true;
+        auto const tap_case = [this](OptimizerStrategy strategy) {
+            CaseResult result = make_case("tap", "automatic_tap_adjustment");
+            result.parameters.emplace_back("optimizer_strategy", to_string(strategy));
+            return result;
+        };
+        auto const tap_options = [](OptimizerStrategy strategy) {
+            return MainModel::Options{.calculation_method = CalculationMethod::newton_raphson,
+                                      .optimizer_type = OptimizerType::automatic_tap_adjustment,
+                                      .optimizer_strategy = strategy};
+        };
+        for (bool const meshed : config_.meshed) {
+            generate_grid(option, meshed);
+            build_model("tap");
+            for (auto const strategy : {any, global_minimum, global_maximum, fast_any}) {
+                run_pf<symmetric_t>(tap_case(strategy), tap_options(strategy));
+            }
+            CaseResult result = tap_case(fast_any);
+            result.parameters.emplace_back("batch", std::string{"load_profile"});
+            run_pf<symmetric_t>(std::move(result), tap_options(fast_any),
+                                generator_.generate_batch_input(config_.batch_size, config_.seed));
         }
-        print(info);
+    }
 
-        if (batch_size > 0) {
-            info.clear();
-            std::cout << "\n*****Run with batch calculation*****\n";
-            Timer const t_total(info, 0000, "Total");
-            run_pf<sym>(calculation_method, info, batch_size, threading);
+    // batches without and with topology changes, for each thread count
+    void run_batch_suite() {
+        using enum CalculationMethod;
+        Option option = config_.option;
+        option.has_fault = true;
+        auto const batch_case = [this](std::string_view batch) {
+            CaseResult result = make_case("batch", "batch");
+            result.parameters.emplace_back("batch", std::string{batch});
+            return result;
+        };
+        for (bool const meshed : config_.meshed) {
+            generate_grid(option, meshed);
+            build_model("batch");
+            BatchData const load_profile = generator_.generate_batch_input(config_.batch_size, config_.seed);
+            BatchData const contingency = generator_.generate_contingency_batch_input(config_.batch_size);
+            BatchData const fault_sweep = generator_.generate_fault_batch_input(config_.batch_size);
+            for (Idx const threading : config_.threads) {
+                for (auto const method : {newton_raphson, linear}) {
+                    run_pf<symmetric_t>(batch_case("load_profile"),
+                                        {.calculation_method = method, .threading = threading}, load_profile);
+                }
+                run_pf<symmetric_t>(batch_case("contingency"),
+                                    {.calculation_method = newton_raphson, .threading = threading}, contingency);
+                run_sc(batch_case("fault_sweep"), {.threading = threading, .short_circuit_sweep = true}, fault_sweep);
+            }
         }
-        print(info);
+    }
 
-        std::cout << "\n\n";
+    // single calculations, sequential versus level-scheduled sparse solver
+    //    the level scheduling pays off for large meshed grids
+    void run_sparse_suite() {
+        using enum CalculationMethod;
+        generate_grid(config_.option, config_.meshed.back());
+        build_model("sparse");
+        for (Idx const threading : config_.threads) {
+            for (auto const method : {newton_raphson, linear}) {
+                run_pf<symmetric_t>(make_case("sparse", "power_flow"),
+                                    {.calculation_method = method, .sparse_solver_threading = threading});
+            }
+            run_pf<asymmetric_t>(make_case("sparse", "power_flow"),
+                                 {.calculation_method = newton_raphson, .sparse_solver_threading = threading});
+        }
     }
 
-    static void print(CalculationInfo const& info) {
-        for (auto const& [key, val] : info) {
-            std::cout << key << ": " << val << '\n';
+    // ordering of the node admittance graph of the whole grid, using minimum degree and approximate minimum degree
+    //    nnz(L + U) counts the diagonal, the branches and the fill-ins in both triangles
+    void run_ordering_suite() {
+        for (bool const meshed : config_.meshed) {
+            generate_grid(config_.option, meshed);
+            InputData const& input = generator_.input_data();
+
+            std::unordered_map<ID, Idx> node_idx;
+            for (auto const& node : input.node) {
+                node_idx.emplace(node.id, static_cast<Idx>(node_idx.size()));
+            }
+            std::vector<std::pair<Idx, Idx>> edges;
+            auto const add_edge = [&edges, &node_idx](ID from_node, ID to_node) {
+                auto const [from, to] = std::minmax(node_idx.at(from_node), node_idx.at(to_node));
+                edges.emplace_back(from, to);
+            };
+            for (auto const& line : input.line) {
+                add_edge(line.from_node, line.to_node);
+            }
+            for (auto const& transformer : input.transformer) {
+                add_edge(transformer.from_node, transformer.to_node);
+            }
+            std::ranges::sort(edges);
+            auto const duplicates = std::ranges::unique(edges);
+            edges.erase(duplicates.begin(), duplicates.end());
+
+            auto const n_node = static_cast<Idx>(node_idx.size());
+            auto const n_edges = static_cast<Idx>(edges.size());
+            auto const run_ordering = [this, n_node, n_edges](std::string_view method, auto const& ordering) {
+                CaseResult result = make_case("ordering", method);
+                result.parameters.emplace_back("n_branch", n_edges);
+                Idx n_fills{};
+                time_runs(result, [&ordering, &n_fills] { n_fills = std::ssize(ordering().second); });
+                result.metrics.emplace_back("fill_ins", static_cast<double>(n_fills));
+                result.metrics.emplace_back("nnz_lu", static_cast<double>(n_node + 2 * (n_edges + n_fills)));
+                report(std::move(result));
+            };
+            run_ordering("minimum_degree", [&edges] {
+                std::map<Idx, IdxVector> graph;
+                for (auto const& [from, to] : edges) {
+                    graph[from].push_back(to);
+                }
+                return minimum_degree_ordering(std::move(graph));
+            });
+            run_ordering("approximate_minimum_degree",
+                         [&edges, n_node] { return approximate_minimum_degree_ordering(n_node, edges); });
         }
     }
 
-    std::unique_ptr<MainModel> main_model;
-    FictionalGridGenerator generator;
+    // model construction and the lookup of the components of an update by ID, compared to a hash map
+    void run_id_index_suite() {
+        generate_grid(config_.option, config_.meshed.back());
+        build_model("id_index");
+        InputData const& input = generator_.input_data();
+
+        // IDs of all components and, shuffled, of the loads to update
+        std::vector<ID> ids;
+        auto const add_ids = [&ids](auto const& components) {
+            std::ranges::transform(components, std::back_inserter(ids), [](auto const& component) {
+                return component.id;
+            });
+        };
+        add_ids(input.node);
+        add_ids(input.transformer);
+        add_ids(input.line);
+        add_ids(input.source);
+        add_ids(input.sym_load);
+        add_ids(input.asym_load);
+        add_ids(input.shunt);
+        std::vector<ID> update_ids;
+        std::ranges::transform(input.sym_load, std::back_inserter(update_ids),
+                               [](SymLoadGenInput const& load) { return load.id; });
+        std::ranges::shuffle(update_ids, std::mt19937_64{0});
+        std::vector<Idx> indexer(update_ids.size());
+        constexpr Idx n_lookup_repeat = 100;
+        Idx const n_lookup = n_lookup_repeat * std::ssize(update_ids);
+
+        CaseResult build_threaded = make_case("id_index", "build_model_hardware_threads");
+        time_runs(build_threaded, [this, &input] {
+            main_model_ = std::make_unique<MainModel>(50.0, input.get_dataset(), get_math_solver_dispatcher(), 0, 0);
+        });
+        report(std::move(build_threaded));
+
+        CaseResult get_indexer = make_case("id_index", "get_indexer");
+        get_indexer.parameters.emplace_back("n_lookup", n_lookup);
+        time_runs(get_indexer, [this, &update_ids, &indexer] {
+            for (Idx repeat = 0; repeat != n_lookup_repeat; ++repeat) {
+                main_model_->get_indexer("sym_load", update_ids.data(), std::ssize(update_ids), indexer.data());
+            }
+        });
+        report(std::move(get_indexer));
+
+        auto const run_index = [this, &ids, &update_ids, n_lookup]<typename Index>(std::string_view name) {
+            Index index;
+            CaseResult build = make_case("id_index", std::string{name} + "_build");
+            build.parameters.emplace_back("n_component", std::ssize(ids));
+            time_runs(build, [&ids, &index] {
+                index = Index{};
+                index.reserve(std::ssize(ids));
+                for (Idx pos = 0; pos != std::ssize(ids); ++pos) {
+                    index.emplace(ids[pos], Idx2D{.group = 0, .pos = pos});
+                }
+            });
+            report(std::move(build));
+
+            CaseResult lookup = make_case("id_index", std::string{name} + "_lookup");
+            lookup.parameters.emplace_back("n_lookup", n_lookup);
+            Idx found{};
+            time_runs(lookup, [&update_ids, &index, &found] {
+                found = 0;
+                for (Idx repeat = 0; repeat != n_lookup_repeat; ++repeat) {
+                    for (ID const id : update_ids) {
+                        found += index.contains(id) ? 1 : 0;
+                    }
+                }
+            });
+            lookup.metrics.emplace_back("found", static_cast<double>(found));
+            report(std::move(lookup));
+        };
+        run_index.template operator()<std::unordered_map<ID, Idx2D>>("hash_map");
+        run_index.template operator()<container_impl::IdIndex>("open_addressing");
+    }
+
+    // construction of the asymmetric power flow jacobian blocks by the scalar kernel, the AVX kernel,
+    //     and the kernel selected at runtime
+    //    the number of blocks per pass is about the number of non-zeros of the node admittance matrix of the grid
+    void run_jacobian_suite() {
+        using math_solver::newton_raphson_pf::PFJacBlock;
+        generate_grid(config_.option, config_.meshed.back());
+        Idx const n_block = 3 * std::ssize(generator_.input_data().node);
+        constexpr Idx n_pass = 100;
+
+        std::mt19937_64 gen{config_.seed};
+        std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+        auto const random_complex = [&gen, &distribution] {
+            return DoubleComplex{distribution(gen), distribution(gen)};
+        };
+        ComplexTensorVector<asymmetric_t> ydata(n_block);
+        ComplexValueVector<asymmetric_t> u(n_block + 1);
+        for (auto& yij : ydata) {
+            std::generate(yij.data(), yij.data() + yij.size(), random_complex);
+        }
+        for (auto& ui : u) {
+            std::generate(ui.data(), ui.data() + ui.size(), random_complex);
+        }
+        std::vector<PFJacBlock<asymmetric_t>> blocks(n_block);
+
+        auto const run_kernel = [this, n_block, &ydata, &u, &blocks](std::string_view kernel, auto const& calculate) {
+            CaseResult result = make_case("jacobian", "jacobian_blocks");
+            result.parameters.emplace_back("kernel", std::string{kernel});
+            result.parameters.emplace_back("n_block", n_pass * n_block);
+            time_runs(result, [n_block, &ydata, &u, &blocks, &calculate] {
+                for (Idx pass = 0; pass != n_pass; ++pass) {
+                    for (Idx k = 0; k != n_block; ++k) {
+                        calculate(blocks[k], ydata[k], u[k], u[k + 1]);
+                    }
+                }
+            });
+            report(std::move(result));
+        };
+        run_kernel("scalar", [](auto& block, auto const& yij, auto const& ui, auto const& uj) {
+            math_solver::newton_raphson_pf::calculate_hnml_scalar(block, yij, ui, uj);
+        });
+#ifdef POWER_GRID_MODEL_AVX_JACOBIAN_KERNEL
+        if (math_solver::newton_raphson_pf::cpu_supports_avx()) {
+            run_kernel("avx", [](auto& block, auto const& yij, auto const& ui, auto const& uj) {
+                math_solver::newton_raphson_pf::calculate_hnml_avx(block, yij, ui, uj);
+            });
+        }
+#endif
+        run_kernel("dispatched", [](auto& block, auto const& yij, auto const& ui, auto const& uj) {
+            math_solver::newton_raphson_pf::calculate_hnml(block, yij, ui, uj);
+        });
+    }
 };
-} // namespace
-} // namespace power_grid_model::benchmark
 
-namespace {
-using power_grid_model::asymmetric_t;
-using power_grid_model::symmetric_t;
-} // namespace
+std::vector<Idx> default_threads() {
+    Idx const hardware_threads = std::max(ThreadPool::hardware_concurrency(), Idx{1});
+    std::vector<Idx> threads{MainModel::Options::sequential};
+    for (Idx n_threads = 2; n_threads < hardware_threads; n_threads *= 2) {
+        threads.push_back(n_threads);
+    }
+    threads.push_back(hardware_threads);
+    return threads;
+}
 
-int main(int /* argc */, char** /* argv */) {
-    using enum power_grid_model::CalculationMethod;
+std::vector<std::string_view> split(std::string_view list) {
+    std::vector<std::string_view> items;
+    while (!list.empty()) {
+        auto const end = std::min(list.find(','), list.size());
+        items.push_back(list.substr(0, end));
+        list.remove_prefix(std::min(end + 1, list.size()));
+    }
+    return items;
+}
 
-    power_grid_model::benchmark::PowerGridBenchmark benchmarker{};
-    power_grid_model::benchmark::Option option{};
+Idx parse_idx(std::string_view value) {
+    size_t pos{};
+    Idx const result = std::stoll(std::string{value}, &pos);
+    if (pos != value.size()) {
+        throw std::invalid_argument{"invalid number: " + std::string{value}};
+    }
+    return result;
+}
 
+// parse the command line, returns nothing when the usage is requested
+std::optional<Config> parse_arguments(std::span<char* const> args) {
+    Config config{};
 #ifndef NDEBUG
-    option.n_node_total_specified = 200;
-    option.n_mv_feeder = 3;
-    option.n_node_per_mv_feeder = 6;
-    option.n_lv_feeder = 2;
-    option.n_connection_per_lv_feeder = 4;
-    power_grid_model::Idx constexpr batch_size = 10;
+    config.option.n_node_total_specified = 200;
+    config.option.n_mv_feeder = 3;
+    config.option.n_node_per_mv_feeder = 6;
+    config.option.n_lv_feeder = 2;
+    config.option.n_connection_per_lv_feeder = 4;
+    config.batch_size = 10;
 #else
-    option.n_node_total_specified = 1500;
-    option.n_mv_feeder = 20;
-    option.n_node_per_mv_feeder = 10;
-    option.n_lv_feeder = 10;
-    option.n_connection_per_lv_feeder = 40;
-    power_grid_model::Idx constexpr batch_size = 1000;
+    config.option.n_node_total_specified = 1500;
+    config.option.n_mv_feeder = 20;
+    config.option.n_node_per_mv_feeder = 10;
+    config.option.n_lv_feeder = 10;
+    config.option.n_connection_per_lv_feeder = 40;
+    config.batch_size = 1000;
 #endif
+    config.threads = default_threads();
 
-    // radial
-    option.has_mv_ring = false;
-    option.has_lv_ring = false;
-    benchmarker.run_benchmark<symmetric_t>(option, newton_raphson, batch_size);
-    benchmarker.run_benchmark<symmetric_t>(option, newton_raphson, batch_size, 6);
-    benchmarker.run_benchmark<symmetric_t>(option, linear);
-    benchmarker.run_benchmark<symmetric_t>(option, iterative_current);
-    benchmarker.run_benchmark<asymmetric_t>(option, newton_raphson);
-    benchmarker.run_benchmark<asymmetric_t>(option, linear);
-    // benchmarker.run_benchmark<asymmetric_t>(option, iterative_current);
-
-    // with meshed ring
-    option.has_mv_ring = true;
-    option.has_lv_ring = true;
-    benchmarker.run_benchmark<symmetric_t>(option, newton_raphson);
-    benchmarker.run_benchmark<symmetric_t>(option, linear);
-    benchmarker.run_benchmark<symmetric_t>(option, iterative_current);
-    benchmarker.run_benchmark<asymmetric_t>(option, newton_raphson);
-    benchmarker.run_benchmark<asymmetric_t>(option, linear);
-    // benchmarker.run_benchmark<asymmetric_t>(option, iterative_current);
+    for (size_t idx = 1; idx < args.size(); ++idx) {
+        std::string_view const arg{args[idx]};
+        if (arg == "--help") {
+            return std::nullopt;
+        }
+        if (idx + 1 == args.size()) {
+            throw std::invalid_argument{"missing value of " + std::string{arg}};
+        }
+        std::string_view const value{args[++idx]};
+        if (arg == "--nodes") {
+            config.option.n_node_total_specified = parse_idx(value);
+        } else if (arg == "--mv-feeders") {
+            config.option.n_mv_feeder = parse_idx(value);
+        } else if (arg == "--nodes-per-mv-feeder") {
+            config.option.n_node_per_mv_feeder = parse_idx(value);
+        } else if (arg == "--lv-feeders") {
+            config.option.n_lv_feeder = parse_idx(value);
+        } else if (arg == "--connections-per-lv-feeder") {
+            config.option.n_connection_per_lv_feeder = parse_idx(value);
+        } else if (arg == "--meshing") {
+            if (value == "radial") {
+                config.meshed = {false};
+            } else if (value == "meshed") {
+                config.meshed = {true};
+            } else if (value == "both") {
+                config.meshed = {false, true};
+            } else {
+                throw std::invalid_argument{"invalid meshing: " + std::string{value}};
+            }
+        } else if (arg == "--seed") {
+            config.seed = static_cast<std::random_device::result_type>(parse_idx(value));
+        } else if (arg == "--suites") {
+            config.suites.clear();
+            for (std::string_view const suite : split(value)) {
+                if (std::ranges::find(all_suites, suite) == all_suites.end()) {
+                    throw std::invalid_argument{"invalid suite: " + std::string{suite}};
+                }
+                config.suites.emplace(suite);
+            }
+        } else if (arg == "--batch-size") {
+            config.batch_size = parse_idx(value);
+        } else if (arg == "--threads") {
+            config.threads.clear();
+            std::ranges::transform(split(value), std::back_inserter(config.threads), parse_idx);
+        } else if (arg == "--repeat") {
+            config.repeat = std::max(parse_idx(value), Idx{1});
+        } else if (arg == "--output") {
+            config.output = value;
+        } else {
+            throw std::invalid_argument{"unknown option: " + std::string{arg}};
+        }
+    }
+    if (config.option.n_node_total_specified <= 0 || config.option.n_mv_feeder <= 0 ||
+        config.option.n_node_per_mv_feeder <= 0 || config.option.n_lv_feeder <= 0 ||
+        config.option.n_connection_per_lv_feeder <= 0) {
+        throw std::invalid_argument{"the grid sizes should be positive"};
+    }
+    return config;
+}
+} // namespace
+} // namespace power_grid_model::benchmark
+
+int main(int argc, char** argv) {
+    namespace benchmark = power_grid_model::benchmark;
+
+    std::optional<benchmark::Config> config;
+    try {
+        config = benchmark::parse_arguments({argv, static_cast<size_t>(argc)});
+    } catch (std::exception const& e) {
+        std::cerr << e.what() << "\n\n" << benchmark::usage;
+        return 1;
+    }
+    if (!config) {
+        std::cout << benchmark::usage;
+        return 0;
+    }
+    std::string const output = config->output;
+
+    benchmark::PowerGridBenchmark benchmarker{std::move(*config)};
+    benchmarker.run();
+
+    if (!output.empty()) {
+        std::ofstream file{output};
+        benchmarker.write_json(file);
+        if (!file) {
+            std::cerr << "Could not write the results to " << output << '\n';
+            return 1;
+        }
+    }
     return 0;
 }
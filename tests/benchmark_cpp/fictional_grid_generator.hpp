@@ -8,6 +8,7 @@
 #include <power_grid_model/main_model.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <random>
 
 namespace power_grid_model::benchmark {
@@ -23,6 +24,8 @@ struct Option {
     double ratio_lv_grid;             // ratio when lv grid will be generated
     bool has_mv_ring;
     bool has_lv_ring;
+    bool has_fault;         // three phase fault at the mv busbar
+    bool has_tap_regulator; // voltage regulators of the mv/lv transformers
 };
 
 struct InputData {
@@ -33,6 +36,10 @@ struct InputData {
     std::vector<SymLoadGenInput> sym_load;
     std::vector<AsymLoadGenInput> asym_load;
     std::vector<ShuntInput> shunt;
+    std::vector<AsymVoltageSensorInput> asym_voltage_sensor;
+    std::vector<AsymPowerSensorInput> asym_power_sensor;
+    std::vector<FaultInput> fault;
+    std::vector<TransformerTapRegulatorInput> transformer_tap_regulator;
 
     ConstDataset get_dataset() const {
         ConstDataset dataset{false, 1, "input", meta_data::meta_data_gen::meta_data};
@@ -43,6 +50,13 @@ struct InputData {
         dataset.add_buffer("sym_load", sym_load.size(), sym_load.size(), nullptr, sym_load.data());
         dataset.add_buffer("asym_load", asym_load.size(), asym_load.size(), nullptr, asym_load.data());
         dataset.add_buffer("shunt", shunt.size(), shunt.size(), nullptr, shunt.data());
+        dataset.add_buffer("asym_voltage_sensor", asym_voltage_sensor.size(), asym_voltage_sensor.size(), nullptr,
+                           asym_voltage_sensor.data());
+        dataset.add_buffer("asym_power_sensor", asym_power_sensor.size(), asym_power_sensor.size(), nullptr,
+                           asym_power_sensor.data());
+        dataset.add_buffer("fault", fault.size(), fault.size(), nullptr, fault.data());
+        dataset.add_buffer("transformer_tap_regulator", transformer_tap_regulator.size(),
+                           transformer_tap_regulator.size(), nullptr, transformer_tap_regulator.data());
         return dataset;
     }
 };
@@ -72,9 +86,31 @@ template <symmetry_tag sym> struct OutputData {
     }
 };
 
+struct ShortCircuitOutputData {
+    std::vector<NodeShortCircuitOutput> node;
+    std::vector<BranchShortCircuitOutput> transformer;
+    std::vector<BranchShortCircuitOutput> line;
+    std::vector<ApplianceShortCircuitOutput> source;
+    std::vector<FaultShortCircuitOutput> fault;
+    Idx batch_size{1};
+
+    MutableDataset get_dataset() {
+        MutableDataset dataset{true, batch_size, "sc_output", meta_data::meta_data_gen::meta_data};
+        dataset.add_buffer("node", node.size() / batch_size, node.size(), nullptr, node.data());
+        dataset.add_buffer("transformer", transformer.size() / batch_size, transformer.size(), nullptr,
+                           transformer.data());
+        dataset.add_buffer("line", line.size() / batch_size, line.size(), nullptr, line.data());
+        dataset.add_buffer("source", source.size() / batch_size, source.size(), nullptr, source.data());
+        dataset.add_buffer("fault", fault.size() / batch_size, fault.size(), nullptr, fault.data());
+        return dataset;
+    }
+};
+
 struct BatchData {
     std::vector<SymLoadGenUpdate> sym_load;
     std::vector<AsymLoadGenUpdate> asym_load;
+    std::vector<BranchUpdate> line;
+    std::vector<FaultUpdate> fault;
     Idx batch_size{0};
 
     ConstDataset get_dataset() const {
@@ -84,6 +120,12 @@ struct BatchData {
         }
         dataset.add_buffer("sym_load", sym_load.size() / batch_size, sym_load.size(), nullptr, sym_load.data());
         dataset.add_buffer("asym_load", asym_load.size() / batch_size, asym_load.size(), nullptr, asym_load.data());
+        if (!line.empty()) {
+            dataset.add_buffer("line", line.size() / batch_size, line.size(), nullptr, line.data());
+        }
+        if (!fault.empty()) {
+            dataset.add_buffer("fault", fault.size() / batch_size, fault.size(), nullptr, fault.data());
+        }
         return dataset;
     }
 };
@@ -124,6 +166,9 @@ class FictionalGridGenerator {
             static_cast<Idx>(static_cast<double>(option.n_mv_feeder) * 10.0 * 1.1 / 60.0) + 1;
         // start generating grid
         generate_mv_grid();
+        if (option_.has_fault) {
+            generate_fault();
+        }
     }
 
     InputData const& input_data() const { return input_; }
@@ -142,6 +187,61 @@ class FictionalGridGenerator {
         return output;
     }
 
+    ShortCircuitOutputData generate_short_circuit_output_data(Idx batch_size = 1) const {
+        batch_size = std::max(batch_size, Idx{1});
+        ShortCircuitOutputData output{};
+        output.batch_size = batch_size;
+        output.node.resize(input_.node.size() * batch_size);
+        output.transformer.resize(input_.transformer.size() * batch_size);
+        output.line.resize(input_.line.size() * batch_size);
+        output.source.resize(input_.source.size() * batch_size);
+        output.fault.resize(input_.fault.size() * batch_size);
+        return output;
+    }
+
+    // measurements of a power flow result of the generated grid
+    //    voltage sensors at all nodes, power sensors at the from side of all branches and at all appliances
+    //    the measurements are per phase and consistent, the state estimation reproduces the power flow result
+    void generate_measurements(OutputData<asymmetric_t> const& power_flow_output) {
+        RealValue<asymmetric_t> const not_measured{nan};
+        auto const add_power_sensor = [this, &not_measured](ID measured_object, MeasuredTerminalType terminal_type,
+                                                            RealValue<asymmetric_t> const& p,
+                                                            RealValue<asymmetric_t> const& q) {
+            RealValue<asymmetric_t> const s = (p * p + q * q).sqrt();
+            input_.asym_power_sensor.push_back(AsymPowerSensorInput{.id = id_gen_++,
+                                                                    .measured_object = measured_object,
+                                                                    .measured_terminal_type = terminal_type,
+                                                                    .power_sigma = std::max(0.01 * max_val(s), 1.0),
+                                                                    .p_measured = p,
+                                                                    .q_measured = q,
+                                                                    .p_sigma = not_measured,
+                                                                    .q_sigma = not_measured});
+        };
+
+        for (auto const& node : power_flow_output.node) {
+            input_.asym_voltage_sensor.push_back(AsymVoltageSensorInput{.id = id_gen_++,
+                                                                        .measured_object = node.id,
+                                                                        .u_sigma = 1e-3 * max_val(node.u),
+                                                                        .u_measured = node.u,
+                                                                        .u_angle_measured = not_measured});
+        }
+        for (auto const& branch : power_flow_output.transformer) {
+            add_power_sensor(branch.id, MeasuredTerminalType::branch_from, branch.p_from, branch.q_from);
+        }
+        for (auto const& branch : power_flow_output.line) {
+            add_power_sensor(branch.id, MeasuredTerminalType::branch_from, branch.p_from, branch.q_from);
+        }
+        for (auto const& shunt : power_flow_output.shunt) {
+            add_power_sensor(shunt.id, MeasuredTerminalType::shunt, shunt.p, shunt.q);
+        }
+        for (auto const& load : power_flow_output.sym_load) {
+            add_power_sensor(load.id, MeasuredTerminalType::load, load.p, load.q);
+        }
+        for (auto const& load : power_flow_output.asym_load) {
+            add_power_sensor(load.id, MeasuredTerminalType::load, load.p, load.q);
+        }
+    }
+
     BatchData generate_batch_input(Idx batch_size) { return generate_batch_input(batch_size, std::random_device{}()); }
 
     BatchData generate_batch_input(Idx batch_size, std::random_device::result_type seed) {
@@ -154,6 +254,40 @@ class FictionalGridGenerator {
         return batch_data;
     }
 
+    // N-1 contingencies: each scenario switches off one line, cycling through all lines
+    //    the topology changes in every scenario
+    BatchData generate_contingency_batch_input(Idx batch_size) const {
+        batch_size = std::max(batch_size, Idx{0});
+        BatchData batch_data{};
+        batch_data.batch_size = batch_size;
+        if (input_.line.empty()) {
+            return batch_data;
+        }
+        batch_data.line.resize(batch_size);
+        for (Idx batch = 0; batch < batch_size; ++batch) {
+            auto const& line = input_.line[batch % std::ssize(input_.line)];
+            batch_data.line[batch] = BranchUpdate{.id = line.id, .from_status = 0, .to_status = 0};
+        }
+        return batch_data;
+    }
+
+    // fault sweep: each scenario moves the fault to another node, cycling through all nodes
+    BatchData generate_fault_batch_input(Idx batch_size) const {
+        batch_size = std::max(batch_size, Idx{0});
+        BatchData batch_data{};
+        batch_data.batch_size = batch_size;
+        if (input_.fault.empty()) {
+            return batch_data;
+        }
+        batch_data.fault.resize(batch_size);
+        for (Idx batch = 0; batch < batch_size; ++batch) {
+            batch_data.fault[batch] = FaultUpdate{.id = input_.fault.front().id,
+                                                  .status = 1,
+                                                  .fault_object = input_.node[batch % std::ssize(input_.node)].id};
+        }
+        return batch_data;
+    }
+
   private:
     Option option_{};
     std::mt19937_64 gen_;
@@ -341,6 +475,18 @@ class FictionalGridGenerator {
                                            .r_grounding_to = nan,
                                            .x_grounding_to = nan};
         input_.transformer.push_back(transformer);
+        if (option_.has_tap_regulator) {
+            // keep the lv busbar within 400 V +/- 20 V, the band is larger than one tap step
+            input_.transformer_tap_regulator.push_back(
+                TransformerTapRegulatorInput{.id = id_gen_++,
+                                             .regulated_object = transformer.id,
+                                             .status = 1,
+                                             .control_side = ControlSide::to,
+                                             .u_set = 400.0,
+                                             .u_band = 40.0,
+                                             .line_drop_compensation_r = 0.0,
+                                             .line_drop_compensation_x = 0.0});
+        }
 
         // template
         NodeInput const lv_node{.id = 0, .u_rated = 400.0};
@@ -459,6 +605,17 @@ class FictionalGridGenerator {
         }
     }
 
+    void generate_fault() {
+        // the second node is the mv busbar
+        input_.fault.push_back(FaultInput{.id = id_gen_++,
+                                          .status = 1,
+                                          .fault_type = FaultType::three_phase,
+                                          .fault_phase = FaultPhase::abc,
+                                          .fault_object = input_.node[1].id,
+                                          .r_f = 0.0,
+                                          .x_f = 0.0});
+    }
+
     static void scale_cable(LineInput& line, double cable_ratio) {
         line.r1 *= cable_ratio;
         line.x1 *= cable_ratio;
@@ -479,8 +636,8 @@ class FictionalGridGenerator {
                 U& update_obj = load_series[batch * n_object + object];
                 update_obj.id = input_obj.id;
                 update_obj.status = na_IntS;
-                update_obj.p_specified *= load_scaling_gen(gen_);
-                update_obj.q_specified *= load_scaling_gen(gen_);
+                update_obj.p_specified = input_obj.p_specified * load_scaling_gen(gen_);
+                update_obj.q_specified = input_obj.q_specified * load_scaling_gen(gen_);
             }
         }
     }
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/common/batch_pipeline.hpp>
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace power_grid_model {
+namespace {
+using Chunk = std::tuple<Idx, Idx, Idx>; // slot, begin, end
+} // namespace
+
+TEST_CASE("Batch pipeline") {
+    std::vector<Chunk> produced;
+    std::vector<Chunk> calculated;
+    std::vector<Chunk> consumed;
+    // chunk number stored in each slot, -1 if the slot is free
+    std::array<std::atomic<Idx>, batch_pipeline_n_slots> slots{};
+    for (auto& slot : slots) {
+        slot = -1;
+    }
+    std::atomic<Idx> in_flight{0};
+    std::atomic<Idx> max_in_flight{0};
+
+    auto produce = [&](Idx slot, Idx begin, Idx end) {
+        CHECK(slots[slot].exchange(static_cast<Idx>(produced.size())) == -1);
+        Idx const now_in_flight = ++in_flight;
+        Idx previous_max = max_in_flight;
+        while (now_in_flight > previous_max && !max_in_flight.compare_exchange_weak(previous_max, now_in_flight)) {
+        }
+        produced.emplace_back(slot, begin, end);
+    };
+    auto calculate = [&](Idx slot, Idx begin, Idx end) {
+        CHECK(slots[slot] == static_cast<Idx>(calculated.size()));
+        calculated.emplace_back(slot, begin, end);
+    };
+    auto consume = [&](Idx slot, Idx begin, Idx end) {
+        CHECK(slots[slot].exchange(-1) == static_cast<Idx>(consumed.size()));
+        --in_flight;
+        consumed.emplace_back(slot, begin, end);
+    };
+
+    SUBCASE("All chunks pass all stages in order") {
+        run_batch_pipeline(10, 3, produce, calculate, consume);
+        std::vector<Chunk> const expected{{0, 0, 3}, {1, 3, 6}, {2, 6, 9}, {0, 9, 10}};
+        CHECK(produced == expected);
+        CHECK(calculated == expected);
+        CHECK(consumed == expected);
+        CHECK(in_flight == 0);
+    }
+
+    SUBCASE("Number of chunks in flight is bounded") {
+        run_batch_pipeline(50, 1, produce, calculate, consume);
+        CHECK(consumed.size() == 50);
+        CHECK(max_in_flight >= 1);
+        CHECK(max_in_flight <= batch_pipeline_n_slots);
+    }
+
+    SUBCASE("Chunk size larger than batch") {
+        run_batch_pipeline(4, 10, produce, calculate, consume);
+        CHECK(consumed == std::vector<Chunk>{{0, 0, 4}});
+    }
+
+    SUBCASE("Empty batch") {
+        run_batch_pipeline(0, 2, produce, calculate, consume);
+        CHECK(produced.empty());
+        CHECK(calculated.empty());
+        CHECK(consumed.empty());
+    }
+
+    SUBCASE("Exception is propagated") {
+        auto const throw_at = [](Idx throw_begin, auto& stage) {
+            return [throw_begin, &stage](Idx slot, Idx begin, Idx end) {
+                if (begin == throw_begin) {
+                    throw std::runtime_error{"stage failed"};
+                }
+                stage(slot, begin, end);
+            };
+        };
+
+        SUBCASE("Producer") {
+            CHECK_THROWS_WITH_AS(run_batch_pipeline(10, 2, throw_at(4, produce), calculate, consume), "stage failed",
+                                 std::runtime_error);
+            CHECK(consumed.size() <= 2);
+        }
+        SUBCASE("Calculation") {
+            CHECK_THROWS_WITH_AS(run_batch_pipeline(10, 2, produce, throw_at(4, calculate), consume), "stage failed",
+                                 std::runtime_error);
+            CHECK(calculated.size() == 2);
+            CHECK(consumed.size() <= 2);
+        }
+        SUBCASE("Consumer") {
+            CHECK_THROWS_WITH_AS(run_batch_pipeline(10, 2, produce, calculate, throw_at(4, consume)), "stage failed",
+                                 std::runtime_error);
+            CHECK(consumed.size() == 2);
+            CHECK(produced.size() <= 2 + batch_pipeline_n_slots);
+        }
+    }
+}
+
+} // namespace power_grid_model
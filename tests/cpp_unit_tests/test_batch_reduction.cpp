@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/all_components.hpp>
+#include <power_grid_model/auxiliary/meta_data_gen.hpp>
+#include <power_grid_model/auxiliary/output.hpp>
+#include <power_grid_model/batch_reduction.hpp>
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <vector>
+
+namespace power_grid_model {
+namespace {
+namespace meta_data_gen = meta_data::meta_data_gen;
+using meta_data::asym_output_getter_s;
+using meta_data::sym_output_getter_s;
+
+// simulate the output of the calculation of a scenario with two nodes
+void calculate_scenario(BatchReduction::Accumulator& accumulator, Idx scenario, std::array<double, 2> const& u_pu,
+                        std::array<IntS, 2> const& energized) {
+    auto const span = accumulator.data().get_columnar_buffer_span<sym_output_getter_s, Node>(accumulator.position(0));
+    REQUIRE(span.size() == 2);
+    for (Idx idx = 0; idx != 2; ++idx) {
+        span[idx] = NodeOutput<symmetric_t>{.id = idx, .energized = energized[idx], .u_pu = u_pu[idx]};
+    }
+    accumulator.add_scenario(scenario);
+}
+} // namespace
+
+TEST_CASE("Batch reduction") {
+    BatchReduction reduction{"sym_output", meta_data_gen::meta_data};
+
+    std::array<double, 2> minimum{};
+    std::array<double, 2> maximum{};
+    std::array<double, 2> mean{};
+    std::array<Idx, 2> arg_minimum{};
+    std::array<Idx, 2> arg_maximum{};
+    std::array<Idx, 2> count_above{};
+    std::array<Idx, 2> count_below{};
+    std::array<Idx, 2> count_energized{};
+
+    reduction.add_request("node", "u_pu", ReductionType::minimum, nan, minimum.data());
+    reduction.add_request("node", "u_pu", ReductionType::maximum, nan, maximum.data());
+    reduction.add_request("node", "u_pu", ReductionType::mean, nan, mean.data());
+    reduction.add_request("node", "u_pu", ReductionType::arg_minimum, nan, arg_minimum.data());
+    reduction.add_request("node", "u_pu", ReductionType::arg_maximum, nan, arg_maximum.data());
+    reduction.add_request("node", "u_pu", ReductionType::count_above, 1.05, count_above.data());
+    reduction.add_request("node", "u_pu", ReductionType::count_below, 0.95, count_below.data());
+    reduction.add_request("node", "energized", ReductionType::count_above, 0.5, count_energized.data());
+    CHECK(reduction.requests().size() == 8);
+
+    std::vector<Idx> const n_elements(reduction.requests().size(), 2);
+
+    SUBCASE("Single accumulator") {
+        BatchReduction::Accumulator accumulator{reduction, n_elements};
+        calculate_scenario(accumulator, 0, {1.0, 0.9}, {1, 1});
+        calculate_scenario(accumulator, 1, {1.1, nan}, {1, 0});
+        calculate_scenario(accumulator, 2, {0.9, 0.9}, {1, 1});
+        accumulator.write_results();
+
+        CHECK(minimum[0] == doctest::Approx(0.9));
+        CHECK(maximum[0] == doctest::Approx(1.1));
+        CHECK(mean[0] == doctest::Approx(1.0));
+        CHECK(arg_minimum[0] == 2);
+        CHECK(arg_maximum[0] == 1);
+        CHECK(count_above[0] == 1);
+        CHECK(count_below[0] == 1);
+        CHECK(count_energized[0] == 3);
+
+        // NaN values are skipped, on equal values the first scenario is reported
+        CHECK(minimum[1] == doctest::Approx(0.9));
+        CHECK(maximum[1] == doctest::Approx(0.9));
+        CHECK(mean[1] == doctest::Approx(0.9));
+        CHECK(arg_minimum[1] == 0);
+        CHECK(arg_maximum[1] == 0);
+        CHECK(count_above[1] == 0);
+        CHECK(count_below[1] == 2);
+        CHECK(count_energized[1] == 2);
+    }
+
+    SUBCASE("Merge accumulators of threads") {
+        BatchReductionResult result{reduction, n_elements};
+        auto thread_0 = result.thread_result();
+        auto thread_1 = result.thread_result();
+        calculate_scenario(thread_1, 3, {0.9, 1.2}, {1, 1});
+        calculate_scenario(thread_0, 0, {1.0, 1.2}, {1, 1});
+        calculate_scenario(thread_1, 2, {0.9, 1.0}, {1, 1});
+        calculate_scenario(thread_0, 1, {1.1, 1.0}, {1, 1});
+        result.merge(thread_1);
+        result.merge(thread_0);
+        result.write_results();
+
+        CHECK(minimum[0] == doctest::Approx(0.9));
+        CHECK(maximum[0] == doctest::Approx(1.1));
+        CHECK(mean[0] == doctest::Approx(0.975));
+        CHECK(arg_minimum[0] == 2);
+        CHECK(arg_maximum[0] == 1);
+        CHECK(arg_minimum[1] == 1);
+        CHECK(arg_maximum[1] == 0);
+        CHECK(count_above[1] == 2);
+        CHECK(count_energized[1] == 4);
+    }
+
+    SUBCASE("No scenarios") {
+        BatchReductionResult const result{reduction, n_elements};
+        result.write_results();
+        CHECK(is_nan(minimum[0]));
+        CHECK(is_nan(mean[1]));
+        CHECK(arg_maximum[0] == BatchReduction::no_scenario);
+        CHECK(count_above[1] == 0);
+    }
+
+    SUBCASE("Asymmetric attribute") {
+        BatchReduction asym_reduction{"asym_output", meta_data_gen::meta_data};
+        std::array<double, 3> asym_maximum{};
+        asym_reduction.add_request("node", "u_pu", ReductionType::maximum, nan, asym_maximum.data());
+        BatchReduction::Accumulator accumulator{asym_reduction, {1}};
+        auto const span = accumulator.data().get_columnar_buffer_span<asym_output_getter_s, Node>(0);
+        span[0] = NodeOutput<asymmetric_t>{.u_pu = RealValue<asymmetric_t>{1.0, 0.8, 1.2}};
+        accumulator.add_scenario(0);
+        span[0] = NodeOutput<asymmetric_t>{.u_pu = RealValue<asymmetric_t>{0.9, 1.1, 1.0}};
+        accumulator.add_scenario(1);
+        accumulator.write_results();
+        CHECK(asym_maximum[0] == doctest::Approx(1.0));
+        CHECK(asym_maximum[1] == doctest::Approx(1.1));
+        CHECK(asym_maximum[2] == doctest::Approx(1.2));
+    }
+
+    SUBCASE("Invalid requests") {
+        CHECK_THROWS_AS(reduction.add_request("node", "u_pu", ReductionType::minimum, nan, nullptr), DatasetError);
+        CHECK_THROWS_AS(reduction.add_request("node", "loading", ReductionType::minimum, nan, minimum.data()),
+                        std::out_of_range);
+        CHECK_THROWS_AS(
+            reduction.add_request("node", "u_pu", static_cast<ReductionType>(IntS{99}), nan, minimum.data()),
+            MissingCaseForEnumError);
+    }
+}
+
+} // namespace power_grid_model
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/common/calculation_info.hpp>
+#include <power_grid_model/common/timer.hpp>
+#include <power_grid_model/main_core/calculation_info.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+
+namespace power_grid_model {
+TEST_CASE("Calculation info") {
+    CalculationInfo info;
+    CHECK(info.empty());
+
+    SUBCASE("Add events") {
+        info.add(LogEvent::math_solver, 1.0);
+        info.add(LogEvent::math_solver, 2.0);
+        info.add(LogEvent::max_num_iter, 5.0);
+        info.add(LogEvent::max_num_iter, 3.0);
+
+        CHECK_FALSE(info.empty());
+        CHECK(info.has(LogEvent::math_solver));
+        CHECK_FALSE(info.has(LogEvent::prepare));
+        CHECK(info.get(LogEvent::math_solver) == 3.0);
+        CHECK(info.get(LogEvent::max_num_iter) == 5.0);
+        CHECK(info.get(LogEvent::prepare) == 0.0);
+
+        info.clear();
+        CHECK(info.empty());
+    }
+
+    SUBCASE("Merge") {
+        CalculationInfo first;
+        first.add(LogEvent::iterations, 3.0);
+        first.add(LogEvent::max_num_iter, 3.0);
+        CalculationInfo second;
+        second.add(LogEvent::iterations, 4.0);
+        second.add(LogEvent::max_num_iter, 4.0);
+        second.add(LogEvent::factorizations, 1.0);
+
+        auto const merged = main_core::merge_calculation_info({first, second, info});
+        CHECK(merged.get(LogEvent::iterations) == 7.0);
+        CHECK(merged.get(LogEvent::max_num_iter) == 4.0);
+        CHECK(merged.get(LogEvent::factorizations) == 1.0);
+        CHECK_FALSE(merged.has(LogEvent::pivot_perturbations));
+    }
+
+    SUBCASE("Shared by calculations") {
+        info.add(LogEvent::math_solver, 3.0);
+        info.add(LogEvent::factorizations, 1.0);
+        info.add(LogEvent::max_num_iter, 2.0);
+
+        auto const share = info.shared_by(4);
+        CHECK(share.get(LogEvent::math_solver) == 0.75);
+        CHECK(share.get(LogEvent::factorizations) == 0.25);
+        CHECK(share.get(LogEvent::max_num_iter) == 2.0);
+        CHECK_FALSE(share.has(LogEvent::prepare));
+
+        auto const merged = main_core::merge_calculation_info({share, share, share, share});
+        CHECK(merged.get(LogEvent::math_solver) == 3.0);
+        CHECK(merged.get(LogEvent::factorizations) == 1.0);
+        CHECK(merged.get(LogEvent::max_num_iter) == 2.0);
+    }
+
+    SUBCASE("Report") {
+        info.add(LogEvent::total, 1.0);
+        info.add(LogEvent::math_solver, 2.0);
+        info.add(LogEvent::max_num_iter, 3.0);
+        info.add(LogEvent::max_num_iter_se, 4.0);
+
+        auto const report = info.report();
+        CHECK(report.size() == 4);
+        CHECK(report.at("0000.Total") == 1.0);
+        CHECK(report.at("2220.\t\t\tMath solver") == 2.0);
+        CHECK(report.at("2226.\t\t\t\tMax number of iterations") == 3.0);
+        CHECK(report.at("2228.\t\t\t\tMax number of iterations") == 4.0);
+    }
+
+    SUBCASE("Report keys of the solver steps") {
+        info.add(LogEvent::total_batch_calculation_in_thread, 1.0);
+        info.add(LogEvent::prepare_matrix, 1.0);
+        info.add(LogEvent::solve_sparse_linear_equation, 1.0);
+        info.add(LogEvent::solve_sparse_linear_equation_linear_pf, 1.0);
+        info.add(LogEvent::solve_sparse_linear_equation_se, 1.0);
+        info.add(LogEvent::iterate_unknown, 1.0);
+        info.add(LogEvent::iterate_unknown_se, 1.0);
+        info.add(LogEvent::calculate_math_result, 1.0);
+        info.add(LogEvent::calculate_math_result_linear_pf, 1.0);
+        info.add(LogEvent::calculate_math_result_se, 1.0);
+
+        auto const report = info.report();
+        CHECK(report.size() == 10);
+        CHECK(report.contains("0000.Total in thread"));
+        CHECK(report.contains("2221.\t\t\t\tPrepare matrix"));
+        CHECK(report.contains("2222.\t\t\t\tSolve sparse linear equation"));
+        CHECK(report.contains("2223.\t\t\t\tSolve sparse linear equation"));
+        CHECK(report.contains("2225.\t\t\t\tSolve sparse linear equation"));
+        CHECK(report.contains("2224.\t\t\t\tIterate unknown"));
+        CHECK(report.contains("2226.\t\t\t\tIterate unknown"));
+        CHECK(report.contains("2223.\t\t\t\tCalculate math result"));
+        CHECK(report.contains("2225.\t\t\t\tCalculate math result"));
+        CHECK(report.contains("2227.\t\t\t\tCalculate math result"));
+    }
+
+    SUBCASE("Timer") {
+        {
+            Timer const timer{info, LogEvent::prepare};
+        }
+        CHECK(info.has(LogEvent::prepare));
+        CHECK(info.get(LogEvent::prepare) >= 0.0);
+
+        Timer timer{info, LogEvent::math_calculation};
+        timer = Timer{info, LogEvent::produce_output};
+        CHECK(info.has(LogEvent::math_calculation));
+        CHECK_FALSE(info.has(LogEvent::produce_output));
+        timer.stop();
+        CHECK(info.has(LogEvent::produce_output));
+    }
+}
+
+TEST_CASE("Log2 histogram") {
+    using log2_histogram::bin;
+    using log2_histogram::min_exponent;
+    using log2_histogram::n_bins;
+
+    CHECK(bin(0.0) == 0);
+    CHECK(bin(-1.0) == 0);
+    CHECK(bin(std::ldexp(1.0, min_exponent - 10)) == 0);
+    CHECK(bin(std::ldexp(1.0, min_exponent)) == 0);
+    CHECK(bin(1.0) == -min_exponent);
+    CHECK(bin(1.5) == -min_exponent);
+    CHECK(bin(2.0) == -min_exponent + 1);
+    CHECK(bin(0.75) == -min_exponent - 1);
+    CHECK(bin(1e300) == n_bins - 1);
+}
+} // namespace power_grid_model
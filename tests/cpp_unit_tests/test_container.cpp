@@ -6,6 +6,8 @@
 
 #include <doctest/doctest.h>
 
+#include <utility>
+
 namespace power_grid_model {
 
 namespace {
@@ -200,6 +202,74 @@ TEST_CASE("Test component container") {
         CHECK(const_container.get_group_idx<C2>() == 2);
     }
 
+    SUBCASE("Test copy") {
+        CompContainer copy{container};
+        CHECK(copy.n_shared_pages<C>() == 0);
+        CHECK(copy.n_shared_pages<C1>() == 0);
+        CHECK(container.n_shared_pages<C1>() == 0);
+        copy.get_item<C1>(22).a = 77;
+        CHECK(const_container.get_item<C1>(22).a == 66);
+    }
+
+    SUBCASE("Test copy-on-write") {
+        container.set_share_storage_on_copy(true);
+        CompContainer copy{container};
+        container.set_share_storage_on_copy(false);
+        CHECK(copy.n_shared_pages<C>() == 1);
+        CHECK(copy.n_shared_pages<C1>() == 1);
+        CHECK(copy.n_shared_pages<C2>() == 1);
+
+        // reading does not copy the storage
+        CHECK(std::as_const(copy).get_item<C>(11).a == 55);
+        CHECK(copy.n_shared_pages<C>() == 1);
+
+        // modifying only copies the storage of the modified type
+        auto const& storage = std::as_const(copy).storage<C1>();
+        copy.get_item<C1>(22).a = 77;
+        CHECK(storage[1].a == 77);
+        CHECK(copy.n_shared_pages<C>() == 1);
+        CHECK(copy.n_shared_pages<C1>() == 0);
+        CHECK(copy.n_shared_pages<C2>() == 1);
+        CHECK(container.n_shared_pages<C1>() == 0);
+        CHECK(copy.get_item<C1>(22).a == 77);
+        CHECK(const_container.get_item<C1>(22).a == 66);
+        CHECK(copy.get_item<C1>(2).a == 6);
+
+        // ids are shared
+        CHECK(copy.get_seq<C>(22) == 4);
+        CHECK_THROWS_AS(copy.get_item<C>(8), IDNotFound);
+
+        copy.make_exclusive<C>();
+        CHECK(copy.n_shared_pages<C>() == 0);
+        CHECK(copy.get_item_by_seq<C>(0).a == 5);
+    }
+
+    SUBCASE("Test copy-on-write with multiple pages") {
+        using Vector = container_impl::CopyOnWriteVector<C>;
+        Vector vec;
+        Idx const size = 3 * Vector::page_size + 1;
+        for (Idx i = 0; i != size; ++i) {
+            vec.emplace_back(i);
+        }
+        vec.set_share_on_copy(true);
+        Vector copy{vec};
+        CHECK(copy.n_shared_pages() == 4);
+
+        // copies of the copy do not share the storage by default
+        Vector const deep_copy{copy};
+        CHECK(deep_copy.n_shared_pages() == 0);
+
+        copy.mutable_at(Vector::page_size + 1).a = -1;
+        CHECK(copy.n_shared_pages() == 3);
+        CHECK(copy[Vector::page_size + 1].a == -1);
+        CHECK(vec[Vector::page_size + 1].a == Vector::page_size + 1);
+        for (Idx i = 0; i != size; ++i) {
+            if (i != Vector::page_size + 1) {
+                CHECK(copy[i].a == i);
+            }
+        }
+    }
+
 #ifndef NDEBUG
     SUBCASE("Test get id by idx2d") {
         CHECK(const_container.get_id_by_idx(Idx2D{0, 0}) == 1);
@@ -212,4 +282,50 @@ TEST_CASE("Test component container") {
 #endif // NDEBUG
 }
 
+TEST_CASE("Test ID index") {
+    using container_impl::IdIndex;
+
+    IdIndex index;
+    CHECK(index.size() == 0);
+    CHECK(index.capacity() == 0);
+    CHECK_FALSE(index.contains(1));
+    CHECK_FALSE(index.find(1).has_value());
+
+    SUBCASE("Insert and find") {
+        // consecutive, strided and negative IDs, so that the table grows several times
+        constexpr Idx n_ids = 1000;
+        auto const id_of = [](Idx idx) { return static_cast<ID>(idx % 2 == 0 ? idx * 1024 : -idx); };
+        for (Idx idx = 0; idx != n_ids; ++idx) {
+            CHECK(index.emplace(id_of(idx), Idx2D{.group = idx % 3, .pos = idx}));
+        }
+        CHECK(index.size() == n_ids);
+        CHECK(index.capacity() >= 2 * n_ids);
+        for (Idx idx = 0; idx != n_ids; ++idx) {
+            auto const found = index.find(id_of(idx));
+            REQUIRE(found.has_value());
+            CHECK(*found == Idx2D{.group = idx % 3, .pos = idx});
+        }
+        CHECK_FALSE(index.contains(1));
+        CHECK_FALSE(index.contains(1023));
+        CHECK(index.find_id(Idx2D{.group = 1, .pos = 7}) == -7);
+        CHECK_FALSE(index.find_id(Idx2D{.group = 0, .pos = 7}).has_value());
+
+        // an existing ID is not inserted again
+        CHECK_FALSE(index.emplace(-1, Idx2D{.group = 2, .pos = 0}));
+        CHECK(index.size() == n_ids);
+        CHECK(index.find(-1) == Idx2D{.group = 1, .pos = 1});
+    }
+
+    SUBCASE("Reserve") {
+        index.reserve(100);
+        Idx const capacity = index.capacity();
+        CHECK(capacity >= 200);
+        for (ID id = 0; id != 100; ++id) {
+            CHECK(index.emplace(id, Idx2D{.group = 0, .pos = id}));
+        }
+        CHECK(index.capacity() == capacity);
+        CHECK(index.find(99) == Idx2D{.group = 0, .pos = 99});
+    }
+}
+
 } // namespace power_grid_model
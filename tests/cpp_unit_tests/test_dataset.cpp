@@ -274,6 +274,43 @@ TEST_CASE_TEMPLATE("Test range object", RangeObjectType, const_range_object<A::I
                 test::check_equal(proxy.get(), expected);
             }
         }
+        SUBCASE("Assign") {
+            std::vector<A::InputType> const new_values{{.id = 20, .a0 = -10.0, .a1 = 3.0},
+                                                       {.id = 21, .a0 = -11.0, .a1 = nan}};
+            range_object.assign(1, new_values);
+            CHECK(id_buffer == std::vector<ID>{0, 20, 21});
+            CHECK(a1_buffer[0] == 0.0);
+            CHECK(a1_buffer[1] == 3.0);
+            test::check_nan(a1_buffer[2]);
+            check_buffer(range_object);
+        }
+        SUBCASE("Block writer") {
+            using BlockWriter = typename RangeObjectType::BlockWriter;
+
+            for (Idx const size : {Idx{0}, Idx{1}, BlockWriter::block_size, 2 * BlockWriter::block_size + 3}) {
+                CAPTURE(size);
+                std::vector<ID> ids(size, na_IntID);
+                std::vector<double> a1s(size, nan);
+                AttributeBuffer<Data> const block_attribute_id{.data = static_cast<Data*>(ids.data()),
+                                                               .meta_attribute = &all_attributes.get_attribute("id")};
+                AttributeBuffer<Data> const block_attribute_a1{.data = static_cast<Data*>(a1s.data()),
+                                                               .meta_attribute = &all_attributes.get_attribute("a1")};
+                std::vector<AttributeBuffer<Data>> const block_elements{block_attribute_id, block_attribute_a1};
+
+                BlockWriter writer{RangeObjectType{size, block_elements}};
+                std::ranges::transform(std::ranges::iota_view{ID{0}, static_cast<ID>(size)}, writer.begin(),
+                                       [](ID value) {
+                                           return A::InputType{
+                                               .id = value, .a0 = -1.0, .a1 = static_cast<double>(2 * value)};
+                                       });
+                writer.flush();
+
+                for (Idx idx = 0; idx < size; ++idx) {
+                    CHECK(ids[idx] == idx);
+                    CHECK(a1s[idx] == static_cast<double>(2 * idx));
+                }
+            }
+        }
     }
 
     SUBCASE("Iterator access") {
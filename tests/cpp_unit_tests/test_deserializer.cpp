@@ -9,10 +9,14 @@
 #include <power_grid_model/auxiliary/input.hpp>
 #include <power_grid_model/auxiliary/meta_data_gen.hpp>
 #include <power_grid_model/auxiliary/serialization/deserializer.hpp>
+#include <power_grid_model/auxiliary/serialization/serializer.hpp>
 #include <power_grid_model/auxiliary/update.hpp>
 
 #include <doctest/doctest.h>
 
+#include <filesystem>
+#include <fstream>
+
 namespace power_grid_model::meta_data {
 
 using namespace std::string_literals;
@@ -577,6 +581,131 @@ TEST_CASE("Deserializer") {
             CHECK(asym_load_q_specified[3](1) == doctest::Approx(80.0));
             CHECK(asym_load_q_specified[3](2) == std::numeric_limits<double>::infinity());
         }
+
+        SUBCASE("Check parse scenario range") {
+            CHECK(deserializer.get_scenario_range_total_elements("sym_load", 1, 3) == 2);
+            CHECK(deserializer.get_scenario_range_total_elements("asym_load", 1, 3) == 2);
+            CHECK(deserializer.get_scenario_range_total_elements("sym_load", 2, 2) == 0);
+
+            std::vector<SymLoadGenUpdate> sym_load(2);
+            std::vector<AsymLoadGenUpdate> asym_load(2);
+            IdxVector sym_load_indptr(3);
+            auto& info = deserializer.get_dataset_info();
+            info.set_buffer("sym_load", sym_load_indptr.data(), sym_load.data());
+            info.set_buffer("asym_load", nullptr, asym_load.data());
+
+            deserializer.parse(1, 3);
+
+            // sym_load
+            CHECK(sym_load_indptr == IdxVector{0, 0, 2});
+            CHECK(sym_load[0].id == 7);
+            CHECK(is_nan(sym_load[0].p_specified));
+            CHECK(sym_load[0].q_specified == doctest::Approx(10.0));
+            CHECK(sym_load[1].id == 8);
+            CHECK(sym_load[1].status == 0);
+
+            // asym_load
+            CHECK(asym_load[0].id == 9);
+            CHECK(is_nan(asym_load[0].p_specified));
+            CHECK(is_nan(asym_load[0].q_specified));
+            CHECK(asym_load[1].id == 9);
+            CHECK(asym_load[1].q_specified(0) == doctest::Approx(70.0));
+
+            // the next chunk reuses the same buffers
+            deserializer.parse(3, 4);
+            CHECK(sym_load_indptr[0] == 0);
+            CHECK(sym_load_indptr[1] == 1);
+            CHECK(sym_load[0].id == 37);
+            CHECK(asym_load[0].id == 31);
+            CHECK(asym_load[0].p_specified(1) == doctest::Approx(75.0));
+
+            CHECK_THROWS_AS(deserializer.parse(2, 5), SerializationError);
+            CHECK_THROWS_AS(deserializer.parse(2, 1), SerializationError);
+            CHECK_THROWS_AS(deserializer.get_scenario_range_total_elements("sym_load", -1, 1), SerializationError);
+        }
+    }
+}
+
+TEST_CASE("Deserializer from file") {
+    auto const file_path = std::filesystem::temp_directory_path() / "power_grid_model_test_deserializer_file";
+    auto const write_file = [&file_path](std::span<char const> data) {
+        std::ofstream file{file_path, std::ios::binary};
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    };
+
+    SUBCASE("Json file") {
+        write_file(json_batch);
+        Deserializer deserializer{from_file, file_path, SerializationFormat::json, meta_data_gen::meta_data};
+        CHECK(deserializer.get_dataset_info().batch_size() == 4);
+
+        std::vector<SymLoadGenUpdate> sym_load(4);
+        std::vector<AsymLoadGenUpdate> asym_load(4);
+        IdxVector sym_load_indptr(5);
+        auto& info = deserializer.get_dataset_info();
+        info.set_buffer("sym_load", sym_load_indptr.data(), sym_load.data());
+        info.set_buffer("asym_load", nullptr, asym_load.data());
+        deserializer.parse();
+        CHECK(sym_load_indptr == IdxVector{0, 1, 1, 3, 4});
+        CHECK(asym_load[3].id == 31);
+    }
+
+    SUBCASE("Msgpack file") {
+        // write the batch dataset as msgpack
+        {
+            Deserializer json_deserializer{from_json, json_batch, meta_data_gen::meta_data};
+            std::vector<SymLoadGenUpdate> sym_load(4);
+            std::vector<AsymLoadGenUpdate> asym_load(4);
+            IdxVector sym_load_indptr(5);
+            auto& info = json_deserializer.get_dataset_info();
+            info.set_buffer("sym_load", sym_load_indptr.data(), sym_load.data());
+            info.set_buffer("asym_load", nullptr, asym_load.data());
+            json_deserializer.parse();
+            Serializer serializer{ConstDataset{info}, SerializationFormat::msgpack};
+            write_file(serializer.get_binary_buffer(false));
+        }
+
+        Deserializer deserializer{from_file, file_path, SerializationFormat::msgpack, meta_data_gen::meta_data};
+        Deserializer moved_deserializer{std::move(deserializer)};
+        CHECK(moved_deserializer.get_dataset_info().batch_size() == 4);
+
+        // parse in chunks of two scenarios
+        std::vector<SymLoadGenUpdate> sym_load(2);
+        std::vector<AsymLoadGenUpdate> asym_load(2);
+        IdxVector sym_load_indptr(3);
+        auto& info = moved_deserializer.get_dataset_info();
+        info.set_buffer("sym_load", sym_load_indptr.data(), sym_load.data());
+        info.set_buffer("asym_load", nullptr, asym_load.data());
+
+        CHECK(moved_deserializer.get_scenario_range_total_elements("sym_load", 0, 2) == 1);
+        moved_deserializer.parse(0, 2);
+        CHECK(sym_load_indptr == IdxVector{0, 1, 1});
+        CHECK(sym_load[0].id == 7);
+        CHECK(sym_load[0].p_specified == doctest::Approx(20.0));
+        CHECK(asym_load[0].p_specified(2) == doctest::Approx(200.0));
+        CHECK(is_nan(asym_load[1].p_specified));
+
+        CHECK(moved_deserializer.get_scenario_range_total_elements("sym_load", 2, 4) == 3);
+        sym_load.resize(3);
+        info.set_buffer("sym_load", sym_load_indptr.data(), sym_load.data());
+        moved_deserializer.parse(2, 4);
+        CHECK(sym_load_indptr == IdxVector{0, 2, 3});
+        CHECK(sym_load[1].id == 8);
+        CHECK(sym_load[2].q_specified == std::numeric_limits<double>::infinity());
+        CHECK(asym_load[1].q_specified(0) == std::numeric_limits<double>::infinity());
+    }
+
+    SUBCASE("Empty file") {
+        write_file({});
+        CHECK_THROWS_AS((Deserializer{from_file, file_path, SerializationFormat::msgpack, meta_data_gen::meta_data}),
+                        SerializationError);
+    }
+
+    std::filesystem::remove(file_path);
+
+    SUBCASE("Missing file") {
+        CHECK_THROWS_WITH_AS(
+            (Deserializer{from_file, file_path, SerializationFormat::msgpack, meta_data_gen::meta_data}),
+            doctest::Contains("Cannot open file"), SerializationError);
     }
 }
 
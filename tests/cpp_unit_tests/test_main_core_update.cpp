@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/auxiliary/meta_data_gen.hpp>
+#include <power_grid_model/main_core/state.hpp>
+#include <power_grid_model/main_core/state_queries.hpp>
+#include <power_grid_model/main_core/update.hpp>
+
+#include <doctest/doctest.h>
+
+namespace power_grid_model::main_core::update {
+TEST_CASE("Test main core update - topology grouping") {
+    using ComponentContainer = Container<ExtraRetrievableTypes<Base, Node, Branch, Appliance>, Node, Link, Source>;
+    using State = MainModelState<ComponentContainer>;
+
+    State state;
+    emplace_component<Node>(state, 1, NodeInput{.id = 1, .u_rated = 10e3});
+    emplace_component<Node>(state, 2, NodeInput{.id = 2, .u_rated = 10e3});
+    emplace_component<Link>(state, 3, LinkInput{.id = 3, .from_node = 1, .to_node = 2, .from_status = 1, .to_status = 1},
+                            10e3, 10e3);
+    emplace_component<Link>(state, 4, LinkInput{.id = 4, .from_node = 1, .to_node = 2, .from_status = 1, .to_status = 0},
+                            10e3, 10e3);
+    emplace_component<Source>(state, 5, SourceInput{.id = 5, .node = 1, .status = 1, .u_ref = 1.0}, 10e3);
+    state.components.set_construction_complete();
+
+    constexpr Idx n_scenarios = 6;
+    std::vector<BranchUpdate> const link_update{{.id = 3, .from_status = 1, .to_status = na_IntS},
+                                                {.id = 3, .from_status = 0, .to_status = na_IntS},
+                                                {.id = 4, .from_status = na_IntS, .to_status = 1},
+                                                {.id = 3, .from_status = 0, .to_status = 1},
+                                                {.id = 99, .from_status = 0, .to_status = 0},
+                                                {.id = 4, .from_status = 1, .to_status = 0}};
+    std::vector<SourceUpdate> const source_update(n_scenarios, SourceUpdate{.id = 5, .status = na_IntS, .u_ref = 1.1});
+
+    ConstDataset update_data{true, n_scenarios, "update", meta_data::meta_data_gen::meta_data};
+    update_data.add_buffer("link", 1, n_scenarios, nullptr, link_update.data());
+    update_data.add_buffer("source", 1, n_scenarios, nullptr, source_update.data());
+
+    auto const independence = independence::check_update_independence<Node, Link, Source>(state, update_data);
+
+    SUBCASE("Status updates") {
+        auto const groups = topology_grouping::group_scenarios_by_topology<Node, Link, Source>(
+            state, update_data, n_scenarios, {false, true, true}, independence);
+
+        // unchanged, link 3 opened (twice), link 4 closed, unknown link
+        CHECK(groups.n_groups == 4);
+        CHECK(groups.group == IdxVector{0, 1, 2, 1, 3, 0});
+        CHECK(groups.scenario_order == IdxVector{0, 5, 1, 3, 2, 4});
+    }
+
+    SUBCASE("No status updates") {
+        auto const groups = topology_grouping::group_scenarios_by_topology<Node, Link, Source>(
+            state, update_data, n_scenarios, {false, false, false}, independence);
+
+        CHECK(groups.n_groups == 1);
+        CHECK(groups.group == IdxVector(n_scenarios, 0));
+        CHECK(groups.scenario_order == IdxVector{0, 1, 2, 3, 4, 5});
+    }
+}
+} // namespace power_grid_model::main_core::update
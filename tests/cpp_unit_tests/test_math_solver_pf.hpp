@@ -12,6 +12,8 @@
 #include <power_grid_model/math_solver/sparse_lu_solver.hpp>
 #include <power_grid_model/math_solver/y_bus.hpp>
 
+#include <vector>
+
 namespace power_grid_model {
 template <typename SolverType>
 inline auto run_power_flow(SolverType& solver, YBus<typename SolverType::sym> const& y_bus,
@@ -24,6 +26,18 @@ inline auto run_power_flow(SolverType& solver, YBus<typename SolverType::sym> co
     }
 };
 
+// the linear methods solve a panel of inputs together
+template <typename SolverType>
+inline auto run_power_flow_panel(SolverType& solver, YBus<typename SolverType::sym> const& y_bus,
+                                 std::vector<PowerFlowInput<typename SolverType::sym>> const& inputs,
+                                 CalculationInfo& calculation_info) {
+    if constexpr (SolverType::is_iterative) {
+        return solver.run_linear_current_panel(y_bus, inputs, calculation_info);
+    } else {
+        return solver.run_power_flow_panel(y_bus, inputs, calculation_info);
+    }
+};
+
 template <symmetry_tag sym_type> struct PFSolverTestGrid : public SteadyStateSolverTestGrid<sym_type> {
     using sym = sym_type;
 
@@ -106,6 +120,29 @@ TEST_CASE_TEMPLATE_DEFINE("Test math solver - PF", SolverType, test_math_solver_
         assert_output(output, grid.output_ref_z()); // for const z, all methods (including linear) should be accurate
     }
 
+    SUBCASE("Test pf solver with changed parameters") {
+        SolverType solver{y_bus, topo_ptr};
+        CalculationInfo info;
+        PowerFlowInput<sym> const pf_input = grid.pf_input();
+        run_power_flow(solver, y_bus, pf_input, 1e-12, 20, info);
+
+        // the factorization of the previous calculation is updated for the changed branch
+        auto changed_param = grid.param();
+        for (auto& value : changed_param.branch_param[1].value) {
+            value *= 1.1;
+        }
+        y_bus.update_admittance_increment(
+            std::make_shared<MathModelParam<sym> const>(changed_param),
+            MathModelParamIncrement{.branch_param_to_change = {1}, .shunt_param_to_change = {}});
+        if constexpr (requires { solver.parameters_changed(true); }) {
+            solver.parameters_changed(true);
+        }
+        SolverType new_solver{y_bus, topo_ptr};
+        SolverOutput<sym> const output = run_power_flow(solver, y_bus, pf_input, 1e-12, 20, info);
+        SolverOutput<sym> const output_ref = run_power_flow(new_solver, y_bus, pf_input, 1e-12, 20, info);
+        assert_output(output, output_ref, false, 1e-12);
+    }
+
     if constexpr (SolverType::is_iterative) {
         SUBCASE("Test pf solver with single iteration") {
             // low precision
@@ -119,6 +156,36 @@ TEST_CASE_TEMPLATE_DEFINE("Test math solver - PF", SolverType, test_math_solver_
             SolverOutput<sym> const output = run_power_flow(solver, y_bus, pf_input, error_tolerance, 1, info);
             assert_output(output, grid.output_ref(), false, result_tolerance);
         }
+        SUBCASE("Test pf solver with initial voltage") {
+            SolverType solver{y_bus, topo_ptr};
+            CalculationInfo info;
+
+            // start from the solution, except for the last bus
+            PowerFlowInput<sym> pf_input = grid.pf_input();
+            pf_input.u_init = grid.output_ref().u;
+            pf_input.u_init.back() = ComplexValue<sym>{DoubleComplex{nan, nan}};
+            SolverOutput<sym> const output = run_power_flow(solver, y_bus, pf_input, 1e-12, 20, info);
+            assert_output(output, grid.output_ref(), false, 1e-12);
+        }
+        SUBCASE("Test pf solver with warm start") {
+            SolverType solver{y_bus, topo_ptr};
+            solver.set_warm_start(true);
+            CalculationInfo first_info;
+            CalculationInfo second_info;
+
+            PowerFlowInput<sym> const pf_input = grid.pf_input();
+            SolverOutput<sym> const first = run_power_flow(solver, y_bus, pf_input, 1e-12, 20, first_info);
+            SolverOutput<sym> const second = run_power_flow(solver, y_bus, pf_input, 1e-12, 20, second_info);
+            assert_output(second, grid.output_ref(), false, 1e-12);
+            CHECK(second_info.get(LogEvent::iterations) < first_info.get(LogEvent::iterations));
+
+            // disabling the warm start discards the previous voltages
+            solver.set_warm_start(false);
+            CalculationInfo third_info;
+            SolverOutput<sym> const third = run_power_flow(solver, y_bus, pf_input, 1e-12, 20, third_info);
+            CHECK(third_info.get(LogEvent::iterations) == first_info.get(LogEvent::iterations));
+            assert_output(third, first, false, 1e-15);
+        }
         SUBCASE("Test not converge") {
             SolverType solver{y_bus, topo_ptr};
             CalculationInfo info;
@@ -129,6 +196,30 @@ TEST_CASE_TEMPLATE_DEFINE("Test math solver - PF", SolverType, test_math_solver_
         }
     }
 
+    if constexpr (!SolverType::is_iterative || requires { &SolverType::run_linear_current_panel; }) {
+        SUBCASE("Test pf solver with panel of inputs") {
+            SolverType solver{y_bus, topo_ptr};
+            SolverType single_solver{y_bus, topo_ptr};
+            CalculationInfo info;
+
+            // the const z inputs have a different matrix in the linear method
+            std::vector<PowerFlowInput<sym>> const inputs{grid.pf_input(), grid.pf_input_z(), grid.pf_input_z(),
+                                                          grid.pf_input()};
+            std::vector<SolverOutput<sym>> const outputs = run_power_flow_panel(solver, y_bus, inputs, info);
+            REQUIRE(outputs.size() == inputs.size());
+            for (size_t idx = 0; idx != inputs.size(); ++idx) {
+                CAPTURE(idx);
+                SolverOutput<sym> const output_ref = run_power_flow(
+                    single_solver, y_bus, inputs[idx], std::numeric_limits<double>::infinity(), 1, info);
+                assert_output(outputs[idx], output_ref, false, 1e-15);
+            }
+            assert_output(outputs[1], grid.output_ref_z(), false, SolverType::is_iterative ? 0.15 : 1e-12);
+
+            // an empty panel
+            CHECK(run_power_flow_panel(solver, y_bus, {}, info).empty());
+        }
+    }
+
     SUBCASE("Test singular ybus") {
         auto singular_param = grid.param();
         singular_param.branch_param[0] = BranchCalcParam<sym>{};
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "test_math_solver_pf.hpp"
+
+#include <power_grid_model/math_solver/fast_decoupled_pf_solver.hpp>
+
+#include <doctest/doctest.h>
+
+namespace power_grid_model::math_solver {
+namespace {
+static_assert(!std::constructible_from<FastDecoupledPFSolver<symmetric_t>, YBus<asymmetric_t> const&,
+                                       std::shared_ptr<MathModelTopology const> const&>);
+} // namespace
+
+// the test grid has a low X/R ratio and a large phase shift, so the fast decoupled method needs more iterations
+TEST_CASE("Test math solver - PF fast decoupled") {
+    using SolverType = FastDecoupledPFSolver<symmetric_t>;
+    constexpr Idx max_iter{200};
+
+    PFSolverTestGrid<symmetric_t> const grid;
+
+    auto param_ptr = std::make_shared<MathModelParam<symmetric_t> const>(grid.param());
+    auto topo_ptr = std::make_shared<MathModelTopology const>(grid.topo());
+    YBus<symmetric_t> y_bus{topo_ptr, param_ptr};
+
+    SUBCASE("Test pf solver") {
+        SolverType solver{y_bus, topo_ptr};
+        CalculationInfo info;
+
+        SolverOutput<symmetric_t> const output =
+            run_power_flow(solver, y_bus, grid.pf_input(), 1e-12, max_iter, info);
+        assert_output(output, grid.output_ref(), false, 1e-12);
+        CHECK(info.get(LogEvent::iterations) > 1.0);
+    }
+
+    SUBCASE("Test const z pf solver") {
+        SolverType solver{y_bus, topo_ptr};
+        CalculationInfo info;
+
+        SolverOutput<symmetric_t> const output =
+            run_power_flow(solver, y_bus, grid.pf_input_z(), 1e-12, max_iter, info);
+        assert_output(output, grid.output_ref_z());
+    }
+
+    SUBCASE("Test reuse of the prefactorized matrices") {
+        SolverType solver{y_bus, topo_ptr};
+        CalculationInfo info;
+
+        SolverOutput<symmetric_t> const first = run_power_flow(solver, y_bus, grid.pf_input(), 1e-12, max_iter, info);
+        SolverOutput<symmetric_t> const second =
+            run_power_flow(solver, y_bus, grid.pf_input(), 1e-12, max_iter, info);
+        assert_output(second, first, false, 1e-15);
+    }
+
+    SUBCASE("Test pf solver with warm start") {
+        SolverType solver{y_bus, topo_ptr};
+        solver.set_warm_start(true);
+        CalculationInfo first_info;
+        CalculationInfo second_info;
+
+        SolverOutput<symmetric_t> const first =
+            run_power_flow(solver, y_bus, grid.pf_input(), 1e-12, max_iter, first_info);
+        SolverOutput<symmetric_t> const second =
+            run_power_flow(solver, y_bus, grid.pf_input(), 1e-12, max_iter, second_info);
+        assert_output(first, grid.output_ref(), false, 1e-12);
+        assert_output(second, grid.output_ref(), false, 1e-12);
+        CHECK(second_info.get(LogEvent::iterations) < first_info.get(LogEvent::iterations));
+    }
+
+    SUBCASE("Test pf solver with single iteration") {
+        SolverType solver{y_bus, topo_ptr};
+        CalculationInfo info;
+
+        SolverOutput<symmetric_t> const output =
+            run_power_flow(solver, y_bus, grid.pf_input(), std::numeric_limits<double>::infinity(), 1, info);
+        // a single decoupled iteration is only a rough approximation on this low X/R grid
+        assert_output(output, grid.output_ref(), false, 0.5);
+    }
+
+    SUBCASE("Test not converge") {
+        SolverType solver{y_bus, topo_ptr};
+        CalculationInfo info;
+
+        PowerFlowInput<symmetric_t> pf_input = grid.pf_input();
+        pf_input.s_injection[6] = ComplexValue<symmetric_t>{1e6};
+        CHECK_THROWS_AS(run_power_flow(solver, y_bus, pf_input, 1e-12, max_iter, info), IterationDiverge);
+    }
+
+    SUBCASE("Test singular ybus") {
+        auto singular_param = grid.param();
+        singular_param.branch_param[0] = BranchCalcParam<symmetric_t>{};
+        singular_param.branch_param[1] = BranchCalcParam<symmetric_t>{};
+        singular_param.shunt_param[0] = ComplexTensor<symmetric_t>{};
+        y_bus.update_admittance(std::make_shared<MathModelParam<symmetric_t> const>(singular_param));
+        SolverType solver{y_bus, topo_ptr};
+        CalculationInfo info;
+
+        CHECK_THROWS_AS(run_power_flow(solver, y_bus, grid.pf_input(), 1e-12, max_iter, info), SparseMatrixError);
+    }
+}
+
+} // namespace power_grid_model::math_solver
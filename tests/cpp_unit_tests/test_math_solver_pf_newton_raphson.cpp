@@ -15,7 +15,81 @@ TYPE_TO_STRING_AS("NewtonRaphsonPFSolver<asymmetric_t>",
 
 namespace power_grid_model::math_solver {
 namespace {
+using newton_raphson_pf::calculate_hnml;
+using newton_raphson_pf::calculate_hnml_scalar;
 using newton_raphson_pf::PFJacBlock;
+
+// reference formulation of the jacobian blocks in complex arithmetic
+// power_flow_ij = (ui @* conj(uj)) .* conj(yij), H = L = imag(power_flow_ij), N = -M = real(power_flow_ij)
+template <symmetry_tag sym>
+PFJacBlock<sym> calculate_hnml_complex(ComplexTensor<sym> const& yij, ComplexValue<sym> const& ui,
+                                       ComplexValue<sym> const& uj) {
+    PFJacBlock<sym> block{};
+    ComplexTensor<sym> const power_flow_ij = vector_outer_product(ui, conj(uj)) * conj(yij);
+    block.h() = imag(power_flow_ij);
+    block.n() = real(power_flow_ij);
+    block.m() = -block.n();
+    block.l() = block.h();
+    return block;
+}
+
+template <symmetry_tag sym> void check_hnml_meshed_grid() {
+    SteadyStateSolverTestGrid<sym> const grid;
+
+    // close the loop with a branch from bus0 to bus2
+    MathModelTopology topo = grid.topo();
+    topo.branch_bus_idx.push_back({0, 2});
+    topo.power_sensors_per_branch_from = {from_sparse, {0, 1, 1, 1}};
+    topo.power_sensors_per_branch_to = {from_sparse, {0, 2, 3, 3}};
+    MathModelParam<sym> param = grid.param();
+    param.branch_param.push_back(param.branch_param.front());
+    auto const topo_ptr = std::make_shared<MathModelTopology const>(std::move(topo));
+    auto const param_ptr = std::make_shared<MathModelParam<sym> const>(std::move(param));
+    YBus<sym> const y_bus{topo_ptr, param_ptr};
+
+    // unbalanced voltages in the asymmetric case
+    auto const voltage = [](DoubleComplex u, double unbalance) {
+        ComplexValue<sym> result{u};
+        if constexpr (is_asymmetric_v<sym>) {
+            result(1) *= (1.0 - unbalance) * std::exp(1.0i * unbalance);
+            result(2) *= (1.0 + unbalance) * std::exp(-2.0i * unbalance);
+        }
+        return result;
+    };
+    ComplexValueVector<sym> const u{voltage(grid.u0, 0.01), voltage(grid.u1, 0.03), voltage(grid.u2, -0.02)};
+
+    IdxVector const& indptr = y_bus.row_indptr();
+    IdxVector const& indices = y_bus.col_indices();
+    ComplexTensorVector<sym> const& ydata = y_bus.admittance();
+    REQUIRE(y_bus.nnz() == 9); // the loop couples every pair of buses
+    for (Idx row = 0; row != y_bus.size(); ++row) {
+        for (Idx k = indptr[row]; k != indptr[row + 1]; ++k) {
+            Idx const col = indices[k];
+            PFJacBlock<sym> block{};
+            calculate_hnml(block, ydata[k], u[row], u[col]);
+            PFJacBlock<sym> block_ref = calculate_hnml_complex<sym>(ydata[k], u[row], u[col]);
+
+            check_close<sym>(RealTensor<sym>{block.h()}, RealTensor<sym>{block_ref.h()}, numerical_tolerance);
+            check_close<sym>(RealTensor<sym>{block.n()}, RealTensor<sym>{block_ref.n()}, numerical_tolerance);
+            check_close<sym>(RealTensor<sym>{block.m()}, RealTensor<sym>{block_ref.m()}, numerical_tolerance);
+            check_close<sym>(RealTensor<sym>{block.l()}, RealTensor<sym>{block_ref.l()}, numerical_tolerance);
+
+            // the dispatched kernel gives the same blocks as the scalar one
+            PFJacBlock<sym> block_scalar{};
+            calculate_hnml_scalar(block_scalar, ydata[k], u[row], u[col]);
+            CHECK((block - block_scalar).abs().maxCoeff() < numerical_tolerance);
+#ifdef POWER_GRID_MODEL_AVX_JACOBIAN_KERNEL
+            if constexpr (is_asymmetric_v<sym>) {
+                if (newton_raphson_pf::cpu_supports_avx()) {
+                    PFJacBlock<sym> block_avx{};
+                    newton_raphson_pf::calculate_hnml_avx(block_avx, ydata[k], u[row], u[col]);
+                    CHECK((block_avx - block_scalar).abs().maxCoeff() < numerical_tolerance);
+                }
+            }
+#endif
+        }
+    }
+}
 } // namespace
 
 TEST_CASE("Test block") {
@@ -48,6 +122,11 @@ TEST_CASE("Test block") {
     }
 }
 
+TEST_CASE("Test jacobian blocks") {
+    SUBCASE("symmetric") { check_hnml_meshed_grid<symmetric_t>(); }
+    SUBCASE("asymmetric") { check_hnml_meshed_grid<asymmetric_t>(); }
+}
+
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_pf_id, NewtonRaphsonPFSolver<symmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_pf_id, NewtonRaphsonPFSolver<asymmetric_t>);
 
@@ -298,6 +298,68 @@ TEST_CASE("Short circuit solver") {
         assert_sc_output<symmetric_t>(sym_output, sym_sc_output_ref);
     }
 
+    SUBCASE("Test short circuit solver fault sweep") {
+        YBus<symmetric_t> const y_bus_sym{topo_sc_ptr, param_sym_ptr};
+        YBus<asymmetric_t> const y_bus_asym{topo_sc_ptr, param_asym_ptr};
+        ShortCircuitSolver<symmetric_t> sweep_solver_sym{y_bus_sym, topo_sc_ptr};
+        ShortCircuitSolver<asymmetric_t> sweep_solver_asym{y_bus_asym, topo_sc_ptr};
+        sweep_solver_sym.set_sweep(true);
+        sweep_solver_asym.set_sweep(true);
+
+        auto const check_sweep = [&y_bus_sym, &y_bus_asym, &topo_sc_ptr, &sweep_solver_sym,
+                                  &sweep_solver_asym](ShortCircuitInput const& sc_input, bool check_sym) {
+            ShortCircuitSolver<asymmetric_t> solver_asym{y_bus_asym, topo_sc_ptr};
+            assert_sc_output<asymmetric_t>(sweep_solver_asym.run_short_circuit(y_bus_asym, sc_input),
+                                           solver_asym.run_short_circuit(y_bus_asym, sc_input));
+            if (check_sym) {
+                ShortCircuitSolver<symmetric_t> solver_sym{y_bus_sym, topo_sc_ptr};
+                assert_sc_output<symmetric_t>(sweep_solver_sym.run_short_circuit(y_bus_sym, sc_input),
+                                              solver_sym.run_short_circuit(y_bus_sym, sc_input));
+            }
+        };
+
+        DenseGroupedIdxVector const fault_on_source_bus{from_sparse, {0, 1, 1}};
+        for (auto const& y : {y_fault, y_fault_solid}) {
+            for (auto const& buses : {fault_buses, fault_on_source_bus}) {
+                check_sweep(create_sc_test_input(three_phase, FaultPhase::abc, y, vref, buses), true);
+                check_sweep(create_sc_test_input(single_phase_to_ground, FaultPhase::a, y, vref, buses), false);
+                check_sweep(create_sc_test_input(two_phase, FaultPhase::bc, y, vref, buses), false);
+                check_sweep(create_sc_test_input(two_phase_to_ground, FaultPhase::bc, y, vref, buses), false);
+            }
+        }
+
+        SUBCASE("Faults on multiple buses") {
+            ShortCircuitInput sc_input;
+            sc_input.fault_buses = {from_sparse, {0, 1, 3}};
+            sc_input.source = {vref};
+            sc_input.faults = {{.y_fault = y_fault, .fault_type = two_phase_to_ground, .fault_phase = FaultPhase::ab},
+                               {.y_fault = y_fault, .fault_type = two_phase_to_ground, .fault_phase = FaultPhase::ab},
+                               {.y_fault = y_fault_solid,
+                                .fault_type = two_phase_to_ground,
+                                .fault_phase = FaultPhase::ab}};
+            check_sweep(sc_input, false);
+        }
+
+        SUBCASE("No faults") {
+            ShortCircuitInput sc_input;
+            sc_input.source = {vref};
+            sc_input.fault_buses = {from_dense, {}, topo_sc_ptr->n_bus()};
+            check_sweep(sc_input, true);
+        }
+
+        SUBCASE("Changed parameters") {
+            MathModelParam<symmetric_t> param_changed{param_sc_sym};
+            param_changed.source_param.front().y1 = 2.0 * yref;
+            YBus<symmetric_t> const y_bus_changed{topo_sc_ptr,
+                                                  std::make_shared<MathModelParam<symmetric_t> const>(param_changed)};
+            auto const sc_input = create_sc_test_input(three_phase, FaultPhase::abc, y_fault, vref, fault_buses);
+            sweep_solver_sym.parameters_changed(true);
+            ShortCircuitSolver<symmetric_t> solver_sym{y_bus_changed, topo_sc_ptr};
+            assert_sc_output<symmetric_t>(sweep_solver_sym.run_short_circuit(y_bus_changed, sc_input),
+                                          solver_sym.run_short_circuit(y_bus_changed, sc_input));
+        }
+    }
+
     SUBCASE("Test fault on source bus") {
         // Grid for short circuit
         MathModelTopology topo_comp;
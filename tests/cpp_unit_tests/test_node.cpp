@@ -61,17 +61,64 @@ TEST_CASE("Test node") {
     }
 
     SUBCASE("Test node update") {
-        BaseUpdate const base_update{};
-        UpdateChange update_change = Node::update(base_update);
+        Node node_to_update{node};
+        CHECK(is_nan(node_to_update.calc_param<symmetric_t>()));
+
+        NodeUpdate const node_update{.id = 1, .u_init = 1.05, .u_init_angle = -0.1};
+        UpdateChange update_change = node_to_update.update(node_update);
         CHECK(update_change.topo == false);
         CHECK(update_change.param == false);
+        DoubleComplex const u_init = node_to_update.calc_param<symmetric_t>();
+        CHECK(cabs(u_init) == doctest::Approx(1.05));
+        CHECK(arg(u_init) == doctest::Approx(-0.1));
+        ComplexValue<asymmetric_t> const u_init_asym = node_to_update.calc_param<asymmetric_t>();
+        CHECK(cabs(u_init_asym(1)) == doctest::Approx(1.05));
+        CHECK(arg(u_init_asym(1)) == doctest::Approx(-0.1 - deg_120));
+
+        // a missing value leaves the initial voltage unchanged
+        update_change = node_to_update.update(NodeUpdate{.id = 1, .u_init = 0.95, .u_init_angle = nan});
+        CHECK(update_change.topo == false);
+        CHECK(update_change.param == false);
+        CHECK(cabs(node_to_update.calc_param<symmetric_t>()) == doctest::Approx(0.95));
+        CHECK(arg(node_to_update.calc_param<symmetric_t>()) == doctest::Approx(-0.1));
+        node_to_update.update(NodeUpdate{.id = 1, .u_init = nan, .u_init_angle = nan});
+        CHECK(cabs(node_to_update.calc_param<symmetric_t>()) == doctest::Approx(0.95));
+
+        // an incomplete initial voltage is not used
+        Node incomplete_node{node};
+        incomplete_node.update(NodeUpdate{.id = 1, .u_init = 1.05, .u_init_angle = nan});
+        CHECK(is_nan(incomplete_node.calc_param<symmetric_t>()));
     }
 
     SUBCASE("Test update inverse") {
-        BaseUpdate const base_update{1};
-        auto expected = base_update;
-        auto const inv = Node::inverse(base_update);
-        CHECK(inv.id == expected.id);
+        Node node_to_update{node};
+        NodeUpdate const node_update{.id = 1, .u_init = 1.05, .u_init_angle = -0.1};
+
+        auto const inv = node_to_update.inverse(node_update);
+        CHECK(inv.id == 1);
+        CHECK(is_nan(inv.u_init));
+        CHECK(is_nan(inv.u_init_angle));
+
+        node_to_update.update(node_update);
+        auto const inv_updated = node_to_update.inverse(NodeUpdate{.id = 1, .u_init = 0.95, .u_init_angle = 0.0});
+        CHECK(inv_updated.u_init == 1.05);
+        CHECK(inv_updated.u_init_angle == -0.1);
+
+        // the inverse holds the complete initial voltage
+        auto const inv_partial = node_to_update.inverse(NodeUpdate{.id = 1, .u_init = 0.95, .u_init_angle = nan});
+        CHECK(inv_partial.u_init == 1.05);
+        CHECK(inv_partial.u_init_angle == -0.1);
+
+        // restoring the inverse unsets the initial voltage again
+        auto const update_change = node_to_update.restore(inv);
+        CHECK(!update_change.topo);
+        CHECK(!update_change.param);
+        CHECK(is_nan(node_to_update.calc_param<symmetric_t>()));
+
+        node_to_update.restore(inv_updated);
+        DoubleComplex const u_init = node_to_update.calc_param<symmetric_t>();
+        CHECK(cabs(u_init) == doctest::Approx(1.05));
+        CHECK(arg(u_init) == doctest::Approx(-0.1));
     }
 }
 
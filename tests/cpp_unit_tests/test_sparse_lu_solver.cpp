@@ -7,6 +7,8 @@
 
 #include <doctest/doctest.h>
 
+#include <set>
+
 namespace power_grid_model::math_solver {
 namespace {
 using lu_trait_double = math_solver::sparse_lu_entry_trait<double, double, double>;
@@ -36,6 +38,23 @@ using Tensor = Eigen::Array<double, 2, 2, Eigen::ColMajor>;
 using Array = Eigen::Array<double, 2, 1, Eigen::ColMajor>;
 } // namespace
 
+TEST_CASE("Test Sparse LU symbolic factorization") {
+    // 3 * 3 matrix, with diagonal, two fill-ins
+    /// x x x
+    /// x x f
+    /// x f x
+    SparseLUSymbolic const symbolic{{0, 3, 6, 9}, {0, 1, 2, 0, 1, 2, 0, 1, 2}, {0, 4, 8}};
+
+    CHECK(symbolic.transpose_entry == IdxVector{0, 3, 6, 1, 4, 7, 2, 5, 8});
+    // pivot 0 updates (1, 1), (1, 2), (2, 1), (2, 2); pivot 1 updates (2, 2); pivot 2 updates nothing
+    CHECK(symbolic.update_indptr == IdxVector{0, 4, 5, 5});
+    CHECK(symbolic.update_target == IdxVector{4, 5, 7, 8, 8});
+    // elimination tree 0 -> 1 -> 2
+    CHECK(symbolic.n_levels() == 3);
+    CHECK(symbolic.level_indptr == IdxVector{0, 1, 2, 3});
+    CHECK(symbolic.level_pivots == IdxVector{0, 1, 2});
+}
+
 TEST_CASE("Test Sparse LU solver") {
     // 3 * 3 matrix, with diagonal, two fill-ins
     /// x x x
@@ -77,6 +96,31 @@ TEST_CASE("Test Sparse LU solver") {
             check_result(x, x_ref);
         }
 
+        SUBCASE("Log factorizations") {
+            CalculationInfo info;
+            solver.prefactorize(data, block_perm);
+            solver.solve_with_prefactorized_matrix((std::vector<double> const&)data, block_perm, rhs, x);
+            solver.log_factorizations(info);
+            CHECK(info.get(LogEvent::factorizations) == 1.0);
+            CHECK(info.get(LogEvent::pivot_perturbations) == 0.0);
+
+            // the statistics are reset after logging
+            solver.log_factorizations(info);
+            CHECK(info.get(LogEvent::factorizations) == 1.0);
+        }
+
+        SUBCASE("Shared symbolic factorization") {
+            auto const symbolic = std::make_shared<SparseLUSymbolic const>(*row_indptr, *col_indices, *diag_lu);
+            SparseLUSolver<double, double, double> shared_solver_1{row_indptr, col_indices, diag_lu, symbolic};
+            SparseLUSolver<double, double, double> shared_solver_2{row_indptr, col_indices, diag_lu, symbolic};
+            auto data_2 = data;
+            std::vector<double> x_2(3, 0.0);
+            shared_solver_1.prefactorize_and_solve(data, block_perm, rhs, x);
+            shared_solver_2.prefactorize_and_solve(data_2, block_perm, rhs, x_2);
+            check_result(x, x_ref);
+            check_result(x_2, x_ref);
+        }
+
         SUBCASE("Data is prefactorized by solve") {
             auto prefactorized_data = data;
             auto prefactorized_block_perm = block_perm;
@@ -84,6 +128,36 @@ TEST_CASE("Test Sparse LU solver") {
             solver.prefactorize_and_solve(data, block_perm, rhs, x);
             CHECK(prefactorized_data == data);
         }
+
+        SUBCASE("Level-scheduled calculation") {
+            auto sequential_data = data;
+            solver.prefactorize(sequential_data, block_perm);
+            solver.set_n_threads(4);
+            CHECK(solver.n_threads() == 4);
+            solver.prefactorize_and_solve(data, block_perm, rhs, x);
+            check_result(x, x_ref);
+            CHECK(data == sequential_data);
+        }
+
+        SUBCASE("Panel of right hand sides") {
+            // the right hand sides rhs, 2 * rhs and -rhs, stored row by row
+            std::vector<double> const panel_rhs = {21, 42, -21, 2, 4, -2, 18, 36, -18};
+            std::vector<double> const panel_x_ref = {3, 6, -3, -1, -2, 1, 2, 4, -2};
+            std::vector<double> panel_x(9, 0.0);
+            solver.prefactorize(data, block_perm);
+            solver.solve_panel_with_prefactorized_matrix(data, block_perm, panel_rhs, panel_x, 3);
+            check_result(panel_x, panel_x_ref);
+
+            // in place, level-scheduled
+            solver.set_n_threads(4);
+            panel_x = panel_rhs;
+            solver.solve_panel_with_prefactorized_matrix(data, block_perm, panel_x, panel_x, 3);
+            check_result(panel_x, panel_x_ref);
+
+            // same as the solve of a single right hand side
+            solver.solve_panel_with_prefactorized_matrix(data, block_perm, rhs, x, 1);
+            check_result(x, x_ref);
+        }
     }
 
     SUBCASE("Block(double 2*2) calculation") {
@@ -126,6 +200,316 @@ TEST_CASE("Test Sparse LU solver") {
             solver.solve_with_prefactorized_matrix((std::vector<Tensor> const&)data, block_perm, rhs, x);
             check_result(x, x_ref);
         }
+
+        SUBCASE("Level-scheduled calculation") {
+            auto sequential_data = data;
+            solver.prefactorize(sequential_data, block_perm);
+            solver.set_n_threads(4);
+            solver.prefactorize_and_solve(data, block_perm, rhs, x);
+            check_result(x, x_ref);
+            for (size_t i = 0; i < data.size(); i++) {
+                CHECK((data[i] == sequential_data[i]).all());
+            }
+        }
+
+        SUBCASE("Panel of right hand sides") {
+            // the right hand sides rhs and -rhs, stored row by row
+            std::vector<Array> const panel_rhs = {{38, 356}, {-38, -356}, {-389, 2}, {389, -2}, {44, 611}, {-44, -611}};
+            std::vector<Array> const panel_x_ref = {{3, 4}, {-3, -4}, {-1, -2}, {1, 2}, {5, 6}, {-5, -6}};
+            std::vector<Array> panel_x(6, Array::Zero());
+            solver.prefactorize(data, block_perm);
+            solver.solve_panel_with_prefactorized_matrix(data, block_perm, panel_rhs, panel_x, 2);
+            check_result(panel_x, panel_x_ref);
+        }
+    }
+}
+
+TEST_CASE("Test Sparse LU solver level-scheduled on a wide elimination tree") {
+    // groups of leaves, each leaf is connected to the hub of its group and to the root
+    //    the fill-ins between the hubs and the root are already present
+    //    the elimination tree has all leaves at level 0, the hubs at level 1 and the root at level 2
+    constexpr Idx n_groups = 8;
+    constexpr Idx n_leaves = 40;
+    constexpr Idx n_threads = 4;
+    constexpr Idx size = n_groups * (n_leaves + 1) + 1;
+    constexpr Idx root = size - 1;
+    auto const hub = [](Idx group) { return n_groups * n_leaves + group; };
+
+    std::vector<std::set<Idx>> rows(size);
+    for (Idx row = 0; row != size; ++row) {
+        rows[row].insert(row);
+    }
+    auto const connect = [&rows](Idx row, Idx col) {
+        rows[row].insert(col);
+        rows[col].insert(row);
+    };
+    for (Idx group = 0; group != n_groups; ++group) {
+        connect(hub(group), root);
+        for (Idx leaf = group * n_leaves; leaf != (group + 1) * n_leaves; ++leaf) {
+            connect(leaf, hub(group));
+            connect(leaf, root);
+        }
+    }
+    IdxVector row_indptr_vec{0};
+    IdxVector col_indices_vec;
+    IdxVector diag_lu_vec;
+    for (Idx row = 0; row != size; ++row) {
+        for (Idx const col : rows[row]) {
+            if (col == row) {
+                diag_lu_vec.push_back(static_cast<Idx>(col_indices_vec.size()));
+            }
+            col_indices_vec.push_back(col);
+        }
+        row_indptr_vec.push_back(static_cast<Idx>(col_indices_vec.size()));
+    }
+    auto const row_indptr = std::make_shared<IdxVector const>(row_indptr_vec);
+    auto const col_indices = std::make_shared<IdxVector const>(col_indices_vec);
+    auto const diag_lu = std::make_shared<IdxVector const>(diag_lu_vec);
+    auto const symbolic = std::make_shared<SparseLUSymbolic const>(*row_indptr, *col_indices, *diag_lu);
+    auto const entry = [&row_indptr_vec, &col_indices_vec](Idx row, Idx col) {
+        auto const row_begin = col_indices_vec.cbegin() + row_indptr_vec[row];
+        auto const row_end = col_indices_vec.cbegin() + row_indptr_vec[row + 1];
+        return static_cast<Idx>(std::find(row_begin, row_end, col) - col_indices_vec.cbegin());
+    };
+
+    REQUIRE(symbolic->n_levels() == 3);
+    CHECK(symbolic->level_indptr == IdxVector{0, n_groups * n_leaves, n_groups * (n_leaves + 1), size});
+
+    // non-symmetric values, diagonally dominant
+    auto const off_diagonal = [](Idx row, Idx col) {
+        return -1.0 - 0.001 * static_cast<double>(row) - 0.002 * static_cast<double>(col);
+    };
+    auto const diagonal = [&rows, &off_diagonal](Idx row) {
+        double result = 1.0;
+        for (Idx const col : rows[row]) {
+            result += col == row ? 0.0 : std::abs(off_diagonal(row, col));
+        }
+        return result;
+    };
+
+    SUBCASE("Scalar calculation") {
+        std::vector<double> data;
+        for (Idx row = 0; row != size; ++row) {
+            for (Idx const col : rows[row]) {
+                data.push_back(col == row ? diagonal(row) : off_diagonal(row, col));
+            }
+        }
+        std::vector<double> rhs(size);
+        for (Idx row = 0; row != size; ++row) {
+            rhs[row] = 1.0 + 0.01 * static_cast<double>(row);
+        }
+        std::vector<double> x_sequential(size);
+        std::vector<double> x_parallel(size);
+        Idx block_perm{};
+        auto const matrix = data;
+        auto data_parallel = data;
+
+        SparseLUSolver<double, double, double> sequential_solver{row_indptr, col_indices, diag_lu, symbolic};
+        SparseLUSolver<double, double, double> parallel_solver{row_indptr, col_indices, diag_lu, symbolic};
+        parallel_solver.set_n_threads(n_threads);
+        sequential_solver.prefactorize_and_solve(data, block_perm, rhs, x_sequential);
+        parallel_solver.prefactorize_and_solve(data_parallel, block_perm, rhs, x_parallel);
+
+        CHECK(data_parallel == data);
+        CHECK(x_parallel == x_sequential);
+
+        SUBCASE("Partial solve with sparse right hand side") {
+            // rhs at a leaf and a hub, solution at a leaf of another group, a hub and the root
+            IdxVector const rhs_rows{3, hub(2)};
+            IdxVector const x_rows{n_leaves + 1, hub(5), root};
+            std::vector<double> sparse_rhs(size);
+            for (Idx const row : rhs_rows) {
+                sparse_rhs[row] = rhs[row];
+            }
+            std::vector<double> x_full(size);
+            std::vector<double> x_partial(size);
+            sequential_solver.solve_with_prefactorized_matrix(data, block_perm, sparse_rhs, x_full);
+            sequential_solver.solve_partial_with_prefactorized_matrix(data, block_perm, sparse_rhs, rhs_rows, x_rows,
+                                                                      x_partial);
+            for (Idx row = 0; row != size; ++row) {
+                if (std::ranges::find(x_rows, row) != x_rows.end()) {
+                    CHECK(x_partial[row] == doctest::Approx(x_full[row]));
+                } else {
+                    CHECK(x_partial[row] == 0.0);
+                }
+            }
+        }
+
+        SUBCASE("Refactorize after a change of a few entries") {
+            SparseLUSolver<double, double, double> solver{row_indptr, col_indices, diag_lu, symbolic};
+            std::vector<double> previous_matrix;
+            std::vector<double> lu_matrix;
+            CalculationInfo info;
+
+            // without previous matrix, it is a full factorization
+            solver.refactorize(matrix, previous_matrix, lu_matrix, block_perm);
+            CHECK(lu_matrix == data);
+            CHECK(previous_matrix == matrix);
+            solver.log_factorizations(info);
+            CHECK(info.get(LogEvent::factorizations) == 1.0);
+            CHECK(info.get(LogEvent::partial_factorizations) == 0.0);
+
+            // change the connection of a leaf to its hub, only the leaf, the hub and the root are affected
+            auto changed_matrix = matrix;
+            changed_matrix[entry(3, hub(0))] *= 2.0;
+            changed_matrix[entry(hub(0), 3)] *= 2.0;
+            changed_matrix[entry(3, 3)] += 1.0;
+            auto expected_lu_matrix = changed_matrix;
+            sequential_solver.prefactorize(expected_lu_matrix, block_perm);
+
+            info = CalculationInfo{};
+            solver.refactorize(changed_matrix, previous_matrix, lu_matrix, block_perm);
+            CHECK(lu_matrix == expected_lu_matrix);
+            CHECK(previous_matrix == changed_matrix);
+            solver.log_factorizations(info);
+            CHECK(info.get(LogEvent::factorizations) == 0.0);
+            CHECK(info.get(LogEvent::partial_factorizations) == 1.0);
+
+            // nothing changed
+            info = CalculationInfo{};
+            solver.refactorize(changed_matrix, previous_matrix, lu_matrix, block_perm);
+            CHECK(lu_matrix == expected_lu_matrix);
+            solver.log_factorizations(info);
+            CHECK(info.get(LogEvent::factorizations) == 0.0);
+            CHECK(info.get(LogEvent::partial_factorizations) == 0.0);
+
+            // all diagonal entries changed, it falls back to a full factorization
+            for (Idx row = 0; row != size; ++row) {
+                changed_matrix[entry(row, row)] += 1.0;
+            }
+            expected_lu_matrix = changed_matrix;
+            sequential_solver.prefactorize(expected_lu_matrix, block_perm);
+            info = CalculationInfo{};
+            solver.refactorize(changed_matrix, previous_matrix, lu_matrix, block_perm);
+            CHECK(lu_matrix == expected_lu_matrix);
+            solver.log_factorizations(info);
+            CHECK(info.get(LogEvent::factorizations) == 1.0);
+            CHECK(info.get(LogEvent::partial_factorizations) == 0.0);
+        }
+
+        SUBCASE("Factorize in place before the first refactorize") {
+            SparseLUSolver<double, double, double> solver{row_indptr, col_indices, diag_lu, symbolic};
+            std::vector<double> previous_matrix;
+            std::vector<double> lu_matrix;
+            CalculationInfo info;
+
+            // without previous factorization, the matrix is factorized in place and not kept
+            auto new_matrix = matrix;
+            solver.prefactorize_or_refactorize(new_matrix, previous_matrix, lu_matrix, block_perm);
+            CHECK(lu_matrix == data);
+            CHECK(new_matrix.empty());
+            CHECK(previous_matrix.empty());
+
+            // the next factorization is a full one, because the previous matrix was not kept, and it keeps the matrix
+            new_matrix = matrix;
+            new_matrix[entry(3, 3)] += 1.0;
+            auto expected_lu_matrix = new_matrix;
+            sequential_solver.prefactorize(expected_lu_matrix, block_perm);
+            solver.prefactorize_or_refactorize(new_matrix, previous_matrix, lu_matrix, block_perm);
+            CHECK(lu_matrix == expected_lu_matrix);
+            CHECK(previous_matrix == new_matrix);
+            solver.log_factorizations(info);
+            CHECK(info.get(LogEvent::factorizations) == 2.0);
+            CHECK(info.get(LogEvent::partial_factorizations) == 0.0);
+
+            // from then on, only the affected pivots are factorized again
+            new_matrix[entry(3, 3)] += 1.0;
+            expected_lu_matrix = new_matrix;
+            sequential_solver.prefactorize(expected_lu_matrix, block_perm);
+            info = CalculationInfo{};
+            solver.prefactorize_or_refactorize(new_matrix, previous_matrix, lu_matrix, block_perm);
+            CHECK(lu_matrix == expected_lu_matrix);
+            solver.log_factorizations(info);
+            CHECK(info.get(LogEvent::factorizations) == 0.0);
+            CHECK(info.get(LogEvent::partial_factorizations) == 1.0);
+        }
+    }
+
+    SUBCASE("Block calculation") {
+        std::vector<Tensor> data;
+        for (Idx row = 0; row != size; ++row) {
+            for (Idx const col : rows[row]) {
+                double const value = col == row ? diagonal(row) : off_diagonal(row, col);
+                // off-diagonal values within the block, so that the blocks are pivoted
+                data.push_back(Tensor{{0.1 * value, value}, {value, -0.2 * value}});
+            }
+        }
+        std::vector<Array> rhs(size);
+        for (Idx row = 0; row != size; ++row) {
+            rhs[row] = Array{1.0 + 0.01 * static_cast<double>(row), -1.0};
+        }
+        std::vector<Array> x_sequential(size, Array::Zero());
+        std::vector<Array> x_parallel(size, Array::Zero());
+        SparseLUSolver<Tensor, Array, Array>::BlockPermArray block_perm_sequential(size);
+        SparseLUSolver<Tensor, Array, Array>::BlockPermArray block_perm_parallel(size);
+        auto const matrix = data;
+        auto data_parallel = data;
+
+        SparseLUSolver<Tensor, Array, Array> sequential_solver{row_indptr, col_indices, diag_lu, symbolic};
+        SparseLUSolver<Tensor, Array, Array> parallel_solver{row_indptr, col_indices, diag_lu, symbolic};
+        parallel_solver.set_n_threads(n_threads);
+        sequential_solver.prefactorize_and_solve(data, block_perm_sequential, rhs, x_sequential);
+        parallel_solver.prefactorize_and_solve(data_parallel, block_perm_parallel, rhs, x_parallel);
+
+        for (Idx i = 0; i != static_cast<Idx>(data.size()); ++i) {
+            CHECK((data_parallel[i] == data[i]).all());
+        }
+        for (Idx row = 0; row != size; ++row) {
+            CHECK((x_parallel[row] == x_sequential[row]).all());
+        }
+
+        SUBCASE("Partial solve with sparse right hand side") {
+            IdxVector const rhs_rows{3, hub(2)};
+            IdxVector const x_rows{n_leaves + 1, hub(5), root};
+            std::vector<Array> sparse_rhs(size, Array::Zero());
+            for (Idx const row : rhs_rows) {
+                sparse_rhs[row] = rhs[row];
+            }
+            std::vector<Array> x_full(size, Array::Zero());
+            std::vector<Array> x_partial(size, Array::Zero());
+            sequential_solver.solve_with_prefactorized_matrix(data, block_perm_sequential, sparse_rhs, x_full);
+            sequential_solver.solve_partial_with_prefactorized_matrix(data, block_perm_sequential, sparse_rhs,
+                                                                      rhs_rows, x_rows, x_partial);
+            for (Idx row = 0; row != size; ++row) {
+                if (std::ranges::find(x_rows, row) != x_rows.end()) {
+                    CHECK((abs(x_partial[row] - x_full[row]) < 1e-12).all());
+                } else {
+                    CHECK((x_partial[row] == 0.0).all());
+                }
+            }
+        }
+
+        SUBCASE("Refactorize after a change of a few entries") {
+            SparseLUSolver<Tensor, Array, Array> solver{row_indptr, col_indices, diag_lu, symbolic};
+            std::vector<Tensor> previous_matrix;
+            std::vector<Tensor> lu_matrix;
+            SparseLUSolver<Tensor, Array, Array>::BlockPermArray block_perm(size);
+            solver.refactorize(matrix, previous_matrix, lu_matrix, block_perm);
+
+            // change the connection of a leaf to its hub, and the pivoting within the block of the leaf
+            auto changed_matrix = matrix;
+            changed_matrix[entry(3, hub(0))] *= 2.0;
+            changed_matrix[entry(hub(0), 3)] *= 2.0;
+            changed_matrix[entry(3, 3)] = matrix[entry(3, 3)].rowwise().reverse().eval();
+            auto expected_lu_matrix = changed_matrix;
+            SparseLUSolver<Tensor, Array, Array>::BlockPermArray expected_block_perm(size);
+            sequential_solver.prefactorize(expected_lu_matrix, expected_block_perm);
+
+            CalculationInfo info;
+            solver.refactorize(changed_matrix, previous_matrix, lu_matrix, block_perm);
+            solver.log_factorizations(info);
+            CHECK(info.get(LogEvent::partial_factorizations) == 1.0);
+            for (Idx i = 0; i != static_cast<Idx>(lu_matrix.size()); ++i) {
+                CHECK((lu_matrix[i] == expected_lu_matrix[i]).all());
+            }
+            std::vector<Array> x(size, Array::Zero());
+            solver.solve_with_prefactorized_matrix(lu_matrix, block_perm, rhs, x);
+            sequential_solver.solve_with_prefactorized_matrix(expected_lu_matrix, expected_block_perm, rhs,
+                                                              x_sequential);
+            for (Idx row = 0; row != size; ++row) {
+                CHECK((x[row] == x_sequential[row]).all());
+            }
+        }
     }
 }
 
@@ -165,6 +549,21 @@ TEST_CASE("LU solver with ill-conditioned system") {
             CHECK_NOTHROW(solver.prefactorize(data, perm, true));
             solver.solve_with_prefactorized_matrix(data, perm, rhs, x);
             check_result(x, x_ref);
+
+            CalculationInfo info;
+            solver.log_factorizations(info);
+            CHECK(info.get(LogEvent::factorizations) == 1.0);
+            CHECK(info.get(LogEvent::pivot_perturbations) == 1.0);
+        }
+
+        SUBCASE("Panel with perturbation") {
+            // the right hand sides are refined one by one
+            std::vector<double> const panel_rhs = {0, 0, 0, 0, 50, 100, 2, 4};
+            std::vector<double> const panel_x_ref = {8, 16, 0, 0, 10, 20, 0, 0};
+            std::vector<double> panel_x(8, 0.0);
+            CHECK_NOTHROW(solver.prefactorize(data, perm, true));
+            solver.solve_panel_with_prefactorized_matrix(data, perm, panel_rhs, panel_x, 2);
+            check_result(panel_x, panel_x_ref);
         }
     }
 
@@ -194,6 +593,13 @@ TEST_CASE("LU solver with ill-conditioned system") {
             solver.solve_with_prefactorized_matrix(data, block_perm, rhs, x);
             check_result(x, x_ref);
         }
+
+        SUBCASE("Success with perturbation level-scheduled") {
+            solver.set_n_threads(2);
+            CHECK_NOTHROW(solver.prefactorize(data, block_perm, true));
+            solver.solve_with_prefactorized_matrix(data, block_perm, rhs, x);
+            check_result(x, x_ref);
+        }
     }
 }
 
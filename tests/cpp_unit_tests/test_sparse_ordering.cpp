@@ -6,12 +6,66 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
+#include <numeric>
 #include <sstream>
 
 namespace {
 using power_grid_model::Idx;
+using power_grid_model::IdxVector;
+
+std::vector<std::pair<Idx, Idx>> sorted_edges(std::vector<std::pair<Idx, Idx>> edges) {
+    for (auto& [from, to] : edges) {
+        if (from > to) {
+            std::swap(from, to);
+        }
+    }
+    std::ranges::sort(edges);
+    return edges;
+}
+
+// compressed adjacency in both directions
+std::pair<IdxVector, IdxVector> adjacency(Idx n_vertices, std::vector<std::pair<Idx, Idx>> const& edges) {
+    std::vector<IdxVector> adjacent(n_vertices);
+    for (auto const& [from, to] : edges) {
+        adjacent[from].push_back(to);
+        adjacent[to].push_back(from);
+    }
+    IdxVector indptr{0};
+    IdxVector indices;
+    for (auto const& vertex_adjacent : adjacent) {
+        indices.insert(indices.end(), vertex_adjacent.begin(), vertex_adjacent.end());
+        indptr.push_back(static_cast<Idx>(indices.size()));
+    }
+    return {indptr, indices};
+}
+
+Idx n_minimum_degree_fill_ins(std::vector<std::pair<Idx, Idx>> const& edges) {
+    std::map<Idx, IdxVector> graph;
+    for (auto const& [from, to] : edges) {
+        graph[from].push_back(to);
+    }
+    return std::ssize(power_grid_model::minimum_degree_ordering(std::move(graph)).second);
+}
+
+// rings of feeders from a substation (vertex 0), neighbouring rings are linked halfway
+std::vector<std::pair<Idx, Idx>> ring_grid(Idx n_rings, Idx n_ring_nodes) {
+    std::vector<std::pair<Idx, Idx>> edges;
+    for (Idx ring = 0; ring != n_rings; ++ring) {
+        Idx const first = 1 + ring * n_ring_nodes;
+        edges.emplace_back(0, first);
+        for (Idx node = first + 1; node != first + n_ring_nodes; ++node) {
+            edges.emplace_back(node - 1, node);
+        }
+        edges.emplace_back(first + n_ring_nodes - 1, 0);
+        if (ring + 1 != n_rings) {
+            edges.emplace_back(first + n_ring_nodes / 2, first + n_ring_nodes + n_ring_nodes / 2);
+        }
+    }
+    return edges;
+}
 } // namespace
 
 TEST_CASE("Test sparse ordering") {
@@ -29,4 +83,58 @@ TEST_CASE("Test sparse ordering") {
         CHECK(alpha == std::vector<Idx>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
         CHECK(fills == std::vector<std::pair<Idx, Idx>>{{3, 5}, {4, 5}, {5, 8}, {5, 6}, {5, 7}});
     }
+
+    std::vector<std::pair<Idx, Idx>> const edges{{0, 3}, {0, 5}, {1, 4}, {1, 5}, {1, 8}, {2, 4}, {2, 5}, {2, 6},
+                                                 {3, 6}, {3, 7}, {4, 6}, {4, 8}, {6, 7}, {6, 8}, {6, 9}, {7, 8},
+                                                 {7, 9}, {8, 9}};
+    Idx const n_vertices = 10;
+
+    SUBCASE("elimination_fill_ins") {
+        auto const [indptr, indices] = adjacency(n_vertices, edges);
+        auto const fills =
+            power_grid_model::detail::elimination_fill_ins(indptr, indices, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+        CHECK(sorted_edges(fills) == std::vector<std::pair<Idx, Idx>>{{3, 5}, {4, 5}, {5, 6}, {5, 7}, {5, 8}});
+    }
+
+    SUBCASE("approximate_minimum_degree_ordering") {
+        auto const [alpha, fills] = power_grid_model::approximate_minimum_degree_ordering(n_vertices, edges);
+
+        // the ordering is a permutation
+        IdxVector sorted_alpha{alpha};
+        std::ranges::sort(sorted_alpha);
+        IdxVector all_vertices(n_vertices);
+        std::iota(all_vertices.begin(), all_vertices.end(), Idx{0});
+        CHECK(sorted_alpha == all_vertices);
+
+        // the fill-ins make the graph chordal: eliminating the filled graph in the same order has no fill-ins
+        std::vector<std::pair<Idx, Idx>> filled_edges{edges};
+        filled_edges.insert(filled_edges.end(), fills.begin(), fills.end());
+        auto const [indptr, indices] = adjacency(n_vertices, filled_edges);
+        CHECK(power_grid_model::detail::elimination_fill_ins(indptr, indices, alpha).empty());
+
+        // no fill-in is an existing edge and no fill-in is repeated
+        auto const unique_fills = sorted_edges(fills);
+        CHECK(std::ranges::adjacent_find(unique_fills) == unique_fills.end());
+        auto const existing_edges = sorted_edges(edges);
+        CHECK(std::ranges::none_of(
+            unique_fills, [&existing_edges](auto const& e) { return std::ranges::binary_search(existing_edges, e); }));
+    }
+
+    SUBCASE("approximate minimum degree has no more fill-ins than minimum degree") {
+        CHECK(std::ssize(power_grid_model::approximate_minimum_degree_ordering(n_vertices, edges).second) <=
+              n_minimum_degree_fill_ins(edges));
+
+        for (Idx const n_rings : {2, 3, 5, 8}) {
+            for (Idx const n_ring_nodes : {3, 5, 8}) {
+                CAPTURE(n_rings);
+                CAPTURE(n_ring_nodes);
+                auto const grid = ring_grid(n_rings, n_ring_nodes);
+                auto const [alpha, fills] =
+                    power_grid_model::approximate_minimum_degree_ordering(1 + n_rings * n_ring_nodes, grid);
+                CHECK(std::ssize(alpha) == 1 + n_rings * n_ring_nodes);
+                CHECK(std::ssize(fills) <= n_minimum_degree_fill_ins(grid));
+            }
+        }
+    }
 }
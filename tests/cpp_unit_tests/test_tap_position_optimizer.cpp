@@ -11,6 +11,7 @@
 #include <doctest/doctest.h>
 
 #include <algorithm>
+#include <array>
 #include <map>
 #include <ranges>
 
@@ -1573,6 +1574,88 @@ TEST_CASE("Test Tap position optimizer") {
             }
         }
 
+        SUBCASE("Sensitivity search") {
+            state_b.rank = 0;
+            state_b.u_pu = [&state_b, &regulator_b](ControlSide /*side*/) {
+                return state_b.tap_side == regulator_b.control_side()
+                           ? static_cast<DoubleComplex>(
+                                 test::normalized_lerp(state_b.tap_pos, state_b.tap_min, state_b.tap_max))
+                           : static_cast<DoubleComplex>(
+                                 test::normalized_lerp(state_b.tap_pos, state_b.tap_max, state_b.tap_min));
+            };
+            regulator_b.update(TransformerTapRegulatorUpdate{.id = 4, .u_set = 0.5, .u_band = 0.015});
+
+            // only tap position 50 is within the voltage band
+            state_b.tap_min = 0;
+            state_b.tap_max = 100;
+
+            for (auto strategy_side : test::strategies_and_sides) {
+                auto strategy = strategy_side.strategy;
+                auto tap_side = strategy_side.side;
+                CAPTURE(strategy);
+                CAPTURE(tap_side);
+
+                if (strategy != OptimizerStrategy::any && strategy != OptimizerStrategy::fast_any) {
+                    CHECK_THROWS_AS(get_optimizer(strategy, SearchMethod::sensitivity_search),
+                                    TapSearchStrategyIncompatibleError);
+                    continue;
+                }
+
+                state_b.tap_side = tap_side;
+                state_b.tap_pos = 0;
+
+                auto optimizer = get_optimizer(strategy, SearchMethod::sensitivity_search);
+                auto const result = optimizer.optimize(state, CalculationMethod::default_method);
+                REQUIRE(result.solver_output.size() == 1);
+                CHECK(result.solver_output.front().state_tap_positions.at(state_b.id) == 50);
+
+                // one step to measure the sensitivity, one jump to the predicted tap position and one confirmation
+                CHECK(optimizer.get_total_iterations() == 3);
+                if (strategy == OptimizerStrategy::any) {
+                    auto linear_optimizer = get_optimizer(strategy, SearchMethod::linear_search);
+                    std::ignore = linear_optimizer.optimize(state, CalculationMethod::default_method);
+                    CHECK(linear_optimizer.get_total_iterations() == 51);
+                }
+            }
+        }
+
+        SUBCASE("Regulator order cache") {
+            state_a.rank = 0;
+            state_b.rank = 1;
+
+            pgm_tap::RegulatorOrderCache regulator_order;
+            auto const optimize = [&] {
+                auto optimizer =
+                    pgm_tap::TapPositionOptimizer<MockStateCalculator, std::remove_const_t<decltype(updater)>,
+                                                  MockState, MockTransformerRanker>{
+                        test::mock_state_calculator, updater, OptimizerStrategy::any, meta_data, std::nullopt,
+                        &regulator_order};
+                auto const result = optimizer.optimize(state, CalculationMethod::default_method);
+                auto const& tap_positions = result.optimizer_output.transformer_tap_positions;
+                REQUIRE(tap_positions.size() == 2);
+                return std::array{tap_positions[0].transformer_id, tap_positions[1].transformer_id};
+            };
+
+            CHECK(optimize() == std::array<ID, 2>{1, 2});
+            REQUIRE(regulator_order != nullptr);
+            auto const group = main_core::get_component_type_index<MockTransformer>(state);
+            CHECK(regulator_order->transformers ==
+                  pgm_tap::RankedTransformerGroups{{{.group = group, .pos = 0}}, {{.group = group, .pos = 1}}});
+            CHECK(regulator_order->regulators == std::vector<std::vector<Idx>>{{0}, {1}});
+
+            // the ranking is not redone as long as the cache is not reset
+            state_a.rank = 1;
+            state_b.rank = 0;
+            auto const* const cached = regulator_order.get();
+            CHECK(optimize() == std::array<ID, 2>{1, 2});
+            CHECK(regulator_order.get() == cached);
+
+            regulator_order.reset();
+            CHECK(optimize() == std::array<ID, 2>{2, 1});
+            REQUIRE(regulator_order != nullptr);
+            CHECK(regulator_order->regulators == std::vector<std::vector<Idx>>{{1}, {0}});
+        }
+
         SUBCASE("Check throw as MaxIterationReached") { // This only applies to non-binary search
             state_b.rank = 0;
             state_b.u_pu = [&state_b, &regulator_b](ControlSide /*side*/) {
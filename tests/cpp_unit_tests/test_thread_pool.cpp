@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/common/thread_pool.hpp>
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+namespace power_grid_model {
+TEST_CASE("Thread pool") {
+    ThreadPool pool;
+
+    SUBCASE("Single worker runs in calling thread") {
+        auto const this_thread = std::this_thread::get_id();
+        std::thread::id worker_thread{};
+        pool.parallel_run(1, [&worker_thread](Idx /* worker_idx */) { worker_thread = std::this_thread::get_id(); });
+        CHECK(worker_thread == this_thread);
+        CHECK(pool.size() == 0);
+    }
+
+    SUBCASE("All workers are run exactly once") {
+        std::vector<std::atomic<Idx>> counts(4);
+        pool.parallel_run(4, [&counts](Idx worker_idx) { ++counts[worker_idx]; });
+        for (auto const& count : counts) {
+            CHECK(count == 1);
+        }
+        CHECK(pool.size() == 3);
+
+        // threads are reused
+        pool.parallel_run(3, [&counts](Idx worker_idx) { ++counts[worker_idx]; });
+        CHECK(counts[0] == 2);
+        CHECK(counts[1] == 2);
+        CHECK(counts[2] == 2);
+        CHECK(counts[3] == 1);
+        CHECK(pool.size() == 3);
+    }
+
+    SUBCASE("Nested parallel run") {
+        std::atomic<Idx> count{0};
+        pool.parallel_run(3, [&pool, &count](Idx /* outer_idx */) {
+            pool.parallel_run(3, [&count](Idx /* inner_idx */) { ++count; });
+        });
+        CHECK(count == 9);
+    }
+
+    SUBCASE("Exception is propagated") {
+        std::atomic<Idx> count{0};
+        CHECK_THROWS_AS(pool.parallel_run(3,
+                                          [&count](Idx worker_idx) {
+                                              ++count;
+                                              if (worker_idx == 2) {
+                                                  throw std::runtime_error{"worker failed"};
+                                              }
+                                          }),
+                        std::runtime_error);
+        CHECK(count == 3);
+    }
+}
+
+TEST_CASE("Thread pool - idle timeout") {
+    using namespace std::chrono_literals;
+
+    ThreadPool pool{20ms};
+    std::atomic<Idx> count{0};
+    pool.parallel_run(4, [&count](Idx /* worker_idx */) { ++count; });
+    CHECK(count == 4);
+
+    // idle workers retire
+    auto const deadline = std::chrono::steady_clock::now() + 10s;
+    while (pool.size() != 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(5ms);
+    }
+    CHECK(pool.size() == 0);
+
+    // and are recreated on demand
+    pool.parallel_run(3, [&count](Idx /* worker_idx */) { ++count; });
+    CHECK(count == 7);
+    CHECK(pool.size() <= 2);
+}
+
+TEST_CASE("Chunk cursor") {
+    SUBCASE("Consecutive chunks") {
+        ChunkCursor chunks{7, 3};
+        auto chunk = chunks.next();
+        REQUIRE(chunk.has_value());
+        CHECK(chunk->front() == 0);
+        CHECK(chunk->size() == 3);
+        chunk = chunks.next();
+        REQUIRE(chunk.has_value());
+        CHECK(chunk->front() == 3);
+        CHECK(chunk->size() == 3);
+        chunk = chunks.next();
+        REQUIRE(chunk.has_value());
+        CHECK(chunk->front() == 6);
+        CHECK(chunk->size() == 1);
+        CHECK_FALSE(chunks.next().has_value());
+        CHECK_FALSE(chunks.next().has_value());
+    }
+
+    SUBCASE("Non-positive chunk size") {
+        ChunkCursor chunks{2, 0};
+        CHECK(chunks.next()->size() == 1);
+        CHECK(chunks.next()->size() == 1);
+        CHECK_FALSE(chunks.next().has_value());
+    }
+
+    SUBCASE("Empty range") {
+        ChunkCursor chunks{0, 4};
+        CHECK_FALSE(chunks.next().has_value());
+    }
+
+    SUBCASE("Concurrent claims cover the full range once") {
+        constexpr Idx size = 1000;
+        ThreadPool pool;
+        ChunkCursor chunks{size, 7};
+        std::vector<std::atomic<Idx>> visited(size);
+        pool.parallel_run(4, [&chunks, &visited](Idx /* worker_idx */) {
+            while (auto const chunk = chunks.next()) {
+                for (Idx const idx : *chunk) {
+                    ++visited[idx];
+                }
+            }
+        });
+        for (auto const& count : visited) {
+            CHECK(count == 1);
+        }
+    }
+}
+} // namespace power_grid_model
@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#include <power_grid_model/main_core/topology.hpp>
 #include <power_grid_model/topology.hpp>
 
 #include <doctest/doctest.h>
@@ -284,42 +285,110 @@ TEST_CASE("Test topology") {
     std::vector<MathModelTopology> math_topology_ref = {math0, math1};
 
     SUBCASE("Test topology result") {
+        // the result does not depend on the number of threads
+        for (Idx const n_threads : {1, 2}) {
+            CAPTURE(n_threads);
+            Topology topo{comp_topo, comp_conn};
+            topo.set_n_threads(n_threads);
+            auto const [math_topology, topo_comp_coup_ptr] = topo.build_topology();
+
+            REQUIRE(topo_comp_coup_ptr != nullptr);
+            auto const& topo_comp_coup = *topo_comp_coup_ptr;
+
+            CHECK(math_topology.size() == 2);
+            // test component coupling
+            CHECK(topo_comp_coup.node == comp_coup_ref.node);
+            CHECK(topo_comp_coup.source == comp_coup_ref.source);
+            CHECK(topo_comp_coup.branch == comp_coup_ref.branch);
+            CHECK(topo_comp_coup.branch3 == comp_coup_ref.branch3);
+            CHECK(topo_comp_coup.load_gen == comp_coup_ref.load_gen);
+            CHECK(topo_comp_coup.voltage_sensor == comp_coup_ref.voltage_sensor);
+            CHECK(topo_comp_coup.power_sensor == comp_coup_ref.power_sensor);
+
+            for (size_t i = 0; i < math_topology.size(); i++) {
+                auto const& math = *math_topology[i];
+                auto const& math_ref = math_topology_ref[i];
+                CHECK(math.slack_bus == math_ref.slack_bus);
+                CHECK(math.n_bus() == math_ref.n_bus());
+                check_equal(math.sources_per_bus, math_ref.sources_per_bus);
+                CHECK(math.branch_bus_idx == math_ref.branch_bus_idx);
+                CHECK(math.phase_shift == math_ref.phase_shift);
+                check_equal(math.load_gens_per_bus, math_ref.load_gens_per_bus);
+                CHECK(math.load_gen_type == math_ref.load_gen_type);
+                check_equal(math.shunts_per_bus, math_ref.shunts_per_bus);
+                check_equal(math.voltage_sensors_per_bus, math_ref.voltage_sensors_per_bus);
+                check_equal(math.power_sensors_per_bus, math_ref.power_sensors_per_bus);
+                check_equal(math.power_sensors_per_source, math_ref.power_sensors_per_source);
+                check_equal(math.power_sensors_per_shunt, math_ref.power_sensors_per_shunt);
+                check_equal(math.power_sensors_per_load_gen, math_ref.power_sensors_per_load_gen);
+                check_equal(math.power_sensors_per_branch_from, math_ref.power_sensors_per_branch_from);
+                check_equal(math.power_sensors_per_branch_to, math_ref.power_sensors_per_branch_to);
+                CHECK(math.fill_in == math_ref.fill_in);
+            }
+        }
+    }
+
+    SUBCASE("Test consistency of the topology with the components") {
         Topology topo{comp_topo, comp_conn};
         auto const [math_topology, topo_comp_coup_ptr] = topo.build_topology();
-
         REQUIRE(topo_comp_coup_ptr != nullptr);
-        auto const& topo_comp_coup = *topo_comp_coup_ptr;
+        CHECK(main_core::is_consistent_math_topology(
+            comp_topo, {.math_topology = math_topology, .topo_comp_coup = topo_comp_coup_ptr}));
 
-        CHECK(math_topology.size() == 2);
-        // test component coupling
-        CHECK(topo_comp_coup.node == comp_coup_ref.node);
-        CHECK(topo_comp_coup.source == comp_coup_ref.source);
-        CHECK(topo_comp_coup.branch == comp_coup_ref.branch);
-        CHECK(topo_comp_coup.branch3 == comp_coup_ref.branch3);
-        CHECK(topo_comp_coup.load_gen == comp_coup_ref.load_gen);
-        CHECK(topo_comp_coup.voltage_sensor == comp_coup_ref.voltage_sensor);
-        CHECK(topo_comp_coup.power_sensor == comp_coup_ref.power_sensor);
+        auto const is_consistent_after = [&](auto change_math_topology, auto change_coupling) {
+            main_core::MathTopologyCache topology{.math_topology = {}, .topo_comp_coup = {}};
+            for (auto const& math_topo : math_topology) {
+                MathModelTopology changed{*math_topo};
+                change_math_topology(changed, static_cast<Idx>(topology.math_topology.size()));
+                topology.math_topology.push_back(std::make_shared<MathModelTopology const>(std::move(changed)));
+            }
+            TopologicalComponentToMathCoupling coupling{*topo_comp_coup_ptr};
+            change_coupling(coupling);
+            topology.topo_comp_coup = std::make_shared<TopologicalComponentToMathCoupling const>(std::move(coupling));
+            return main_core::is_consistent_math_topology(comp_topo, topology);
+        };
+        auto const unchanged = [](auto&&...) {};
+        auto const in_math_model = [](Idx math_model, auto change) {
+            return [math_model, change](MathModelTopology& math_topo, Idx idx) {
+                if (idx == math_model) {
+                    change(math_topo);
+                }
+            };
+        };
 
-        for (size_t i = 0; i < math_topology.size(); i++) {
-            auto const& math = *math_topology[i];
-            auto const& math_ref = math_topology_ref[i];
-            CHECK(math.slack_bus == math_ref.slack_bus);
-            CHECK(math.n_bus() == math_ref.n_bus());
-            check_equal(math.sources_per_bus, math_ref.sources_per_bus);
-            CHECK(math.branch_bus_idx == math_ref.branch_bus_idx);
-            CHECK(math.phase_shift == math_ref.phase_shift);
-            check_equal(math.load_gens_per_bus, math_ref.load_gens_per_bus);
-            CHECK(math.load_gen_type == math_ref.load_gen_type);
-            check_equal(math.shunts_per_bus, math_ref.shunts_per_bus);
-            check_equal(math.voltage_sensors_per_bus, math_ref.voltage_sensors_per_bus);
-            check_equal(math.power_sensors_per_bus, math_ref.power_sensors_per_bus);
-            check_equal(math.power_sensors_per_source, math_ref.power_sensors_per_source);
-            check_equal(math.power_sensors_per_shunt, math_ref.power_sensors_per_shunt);
-            check_equal(math.power_sensors_per_load_gen, math_ref.power_sensors_per_load_gen);
-            check_equal(math.power_sensors_per_branch_from, math_ref.power_sensors_per_branch_from);
-            check_equal(math.power_sensors_per_branch_to, math_ref.power_sensors_per_branch_to);
-            CHECK(math.fill_in == math_ref.fill_in);
-        }
+        CHECK(is_consistent_after(unchanged, unchanged));
+        CHECK_FALSE(is_consistent_after(
+            in_math_model(0, [](MathModelTopology& math_topo) { math_topo.slack_bus = math_topo.n_bus(); }),
+            unchanged));
+        CHECK_FALSE(is_consistent_after(
+            in_math_model(0, [](MathModelTopology& math_topo) { math_topo.branch_bus_idx[0][1] = math_topo.n_bus(); }),
+            unchanged));
+        CHECK_FALSE(is_consistent_after(
+            in_math_model(0, [](MathModelTopology& math_topo) { math_topo.fill_in.clear(); }), unchanged));
+        CHECK_FALSE(is_consistent_after(in_math_model(0,
+                                                      [](MathModelTopology& math_topo) {
+                                                          math_topo.fill_in.push_back(math_topo.branch_bus_idx[0]);
+                                                      }),
+                                        unchanged));
+        CHECK_FALSE(is_consistent_after(
+            in_math_model(0, [](MathModelTopology& math_topo) { math_topo.phase_shift.pop_back(); }), unchanged));
+        CHECK_FALSE(is_consistent_after(
+            in_math_model(0, [](MathModelTopology& math_topo) { math_topo.load_gen_type.pop_back(); }), unchanged));
+        CHECK_FALSE(is_consistent_after(
+            in_math_model(0, [](MathModelTopology& math_topo) { math_topo.power_sensors_per_shunt = {}; }),
+            unchanged));
+        CHECK_FALSE(is_consistent_after(unchanged, [](TopologicalComponentToMathCoupling& coupling) {
+            coupling.node.pop_back();
+        }));
+        CHECK_FALSE(is_consistent_after(unchanged, [](TopologicalComponentToMathCoupling& coupling) {
+            coupling.source[0].group = 2;
+        }));
+        CHECK_FALSE(is_consistent_after(unchanged, [](TopologicalComponentToMathCoupling& coupling) {
+            std::swap(coupling.node[0], coupling.node[1]);
+        }));
+        CHECK_FALSE(is_consistent_after(unchanged, [](TopologicalComponentToMathCoupling& coupling) {
+            std::swap(coupling.power_sensor[1], coupling.power_sensor[3]);
+        }));
     }
 }
 
@@ -411,6 +480,20 @@ TEST_CASE("Test cycle reorder") {
         auto const& math_topo = *pair.first[0];
         CHECK(topo_comp_coup.node == comp_coup_ref.node);
         CHECK(math_topo.fill_in == fill_in_ref);
+
+        // approximate minimum degree: all nodes are kept, the cyclic nodes may be ordered differently,
+        // without more fill-ins
+        Topology amd_topo{comp_topo, comp_conn, SparseOrderingMethod::approximate_minimum_degree};
+        auto amd_pair = amd_topo.build_topology();
+        auto const& amd_comp_coup = *amd_pair.second;
+        auto const& amd_math_topo = *amd_pair.first[0];
+        std::vector<Idx> amd_bus;
+        std::ranges::transform(amd_comp_coup.node, std::back_inserter(amd_bus),
+                               [](Idx2D const& math_idx) { return math_idx.pos; });
+        std::ranges::sort(amd_bus);
+        CHECK(amd_bus == std::vector<Idx>{0, 1, 2, 3, 4, 5, 6});
+        CHECK(amd_math_topo.n_bus() == 7);
+        CHECK(amd_math_topo.fill_in.size() <= fill_in_ref.size());
     }
 }
 
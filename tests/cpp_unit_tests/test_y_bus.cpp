@@ -427,6 +427,38 @@ TEST_CASE("Incremental update y-bus") {
         ybus.update_admittance_increment(param_update_ptr, math_model_param_incrmt);
         verify_admittance(ybus.admittance(), admittance_sym_2);
     }
+
+    SUBCASE("Test in-place update") {
+        auto const param_ptr = std::make_shared<MathModelParam<symmetric_t> const>(param_sym);
+        YBus<symmetric_t> ybus{topo_ptr, param_ptr};
+        YBus<symmetric_t> const ybus_before{ybus};
+
+        MathModelParamIncrement math_model_param_incrmt;
+        math_model_param_incrmt.branch_param_to_change = {0, 1, 2, 3, 5};
+        math_model_param_incrmt.shunt_param_to_change = {0};
+
+        // the given parameters are copied before they are changed
+        MathModelParam<symmetric_t>& param = ybus.math_model_param_to_update();
+        CHECK(&param != param_ptr.get());
+        param = param_sym_update;
+        ybus.update_admittance_increment(math_model_param_incrmt);
+        verify_admittance(ybus.admittance(), admittance_sym_2);
+        verify_admittance(ybus_before.admittance(), admittance_sym);
+        CHECK(ybus_before.math_model_param().shunt_param[0] == param_sym.shunt_param[0]);
+
+        // afterwards they are changed in place
+        CHECK(&ybus.math_model_param_to_update() == &param);
+
+        // unless they are shared with a copy of the y bus
+        YBus<symmetric_t> const ybus_updated{ybus};
+        MathModelParam<symmetric_t>& param_reverted = ybus.math_model_param_to_update();
+        CHECK(&param_reverted != &param);
+        param_reverted = param_sym;
+        ybus.update_admittance_increment(math_model_param_incrmt);
+        verify_admittance(ybus.admittance(), admittance_sym);
+        verify_admittance(ybus_updated.admittance(), admittance_sym_2);
+        CHECK(ybus_updated.math_model_param().shunt_param[0] == param_sym_update.shunt_param[0]);
+    }
 }
 
 // TODO:
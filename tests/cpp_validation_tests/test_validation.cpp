@@ -284,7 +284,8 @@ std::map<std::string, PGM_CalculationType, std::less<>> const calculation_type_m
 std::map<std::string, PGM_CalculationMethod, std::less<>> const calculation_method_mapping = {
     {"newton_raphson", PGM_newton_raphson},       {"linear", PGM_linear},
     {"iterative_current", PGM_iterative_current}, {"iterative_linear", PGM_iterative_linear},
-    {"linear_current", PGM_linear_current},       {"iec60909", PGM_iec60909}};
+    {"linear_current", PGM_linear_current},       {"iec60909", PGM_iec60909},
+    {"fast_decoupled", PGM_fast_decoupled}};
 std::map<std::string, PGM_ShortCircuitVoltageScaling, std::less<>> const sc_voltage_scaling_mapping = {
     {"", PGM_short_circuit_voltage_scaling_maximum}, // not provided returns default value
     {"minimum", PGM_short_circuit_voltage_scaling_minimum},
@@ -523,6 +524,24 @@ void validate_single_case(CaseParam const& param) {
 
         // check results
         assert_result(result, validation_case.output.value(), param.atol, param.rtol);
+
+        // level-scheduled sparse solver
+        auto parallel_options = get_options(param);
+        parallel_options.set_sparse_solver_threading(2);
+        model.calculate(parallel_options, result.dataset);
+        assert_result(result, validation_case.output.value(), param.atol, param.rtol);
+
+        // islands calculated in parallel
+        auto island_options = get_options(param);
+        island_options.set_island_threading(2);
+        model.calculate(island_options, result.dataset);
+        assert_result(result, validation_case.output.value(), param.atol, param.rtol);
+
+        // approximate minimum degree ordering
+        auto ordering_options = get_options(param);
+        ordering_options.set_sparse_ordering(PGM_sparse_ordering_approximate_minimum_degree);
+        model.calculate(ordering_options, result.dataset);
+        assert_result(result, validation_case.output.value(), param.atol, param.rtol);
     });
 }
 
@@ -548,6 +567,18 @@ void validate_batch_case(CaseParam const& param) {
             // check results
             assert_result(batch_result, validation_case.output_batch.value(), param.atol, param.rtol);
         }
+
+        // dynamic scheduling with single-scenario chunks
+        auto options = get_options(param, 2);
+        options.set_batch_chunk_size(1);
+        model.calculate(options, batch_result.dataset, validation_case.update_batch.value().dataset);
+        assert_result(batch_result, validation_case.output_batch.value(), param.atol, param.rtol);
+
+        // consecutive scenarios solved together in panels, only applicable for the linear methods
+        auto panel_options = get_options(param);
+        panel_options.set_linear_panel_size(4);
+        model.calculate(panel_options, batch_result.dataset, validation_case.update_batch.value().dataset);
+        assert_result(batch_result, validation_case.output_batch.value(), param.atol, param.rtol);
     });
 }
 
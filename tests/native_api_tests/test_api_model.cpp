@@ -12,11 +12,20 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <cstring>
 #include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <limits>
 #include <map>
+#include <numeric>
+#include <random>
+#include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 /*
 Testing network
@@ -298,6 +307,26 @@ TEST_CASE("API Model") {
         }
     }
 
+    SUBCASE("Columnar output of the requested attributes") {
+        // only the node voltage in p.u. is requested, the lines have a columnar buffer without any attribute
+        //    the memory after the requested column is a guard that should not be written
+        constexpr double sentinel = -123.0;
+        std::vector<double> columnar_node_u_pu(4 + 1, sentinel);
+        DatasetMutable columnar_output_dataset{"sym_output", true, 2};
+        columnar_output_dataset.add_buffer("node", 2, 4, nullptr, nullptr);
+        columnar_output_dataset.add_attribute_buffer("node", "u_pu", columnar_node_u_pu.data());
+        columnar_output_dataset.add_buffer("line", 2, 4, nullptr, nullptr);
+
+        model.calculate(options, columnar_output_dataset, batch_update_dataset);
+        model.calculate(options, batch_output_dataset, batch_update_dataset);
+        node_batch_output.get_value(PGM_def_sym_output_node_u_pu, batch_node_result_u_pu.data(), -1);
+        for (Idx idx = 0; idx != 4; ++idx) {
+            CAPTURE(idx);
+            CHECK(columnar_node_u_pu[idx] == batch_node_result_u_pu[idx]);
+        }
+        CHECK(columnar_node_u_pu.back() == sentinel);
+    }
+
     SUBCASE("Batch power flow") {
         model.calculate(options, batch_output_dataset, batch_update_dataset);
         node_batch_output.get_value(PGM_def_sym_output_node_id, batch_node_result_id.data(), -1);
@@ -327,6 +356,248 @@ TEST_CASE("API Model") {
         CHECK(batch_node_result_u_angle[3] == doctest::Approx(0.0));
     }
 
+    SUBCASE("Pipelined batch power flow") {
+        // the two scenarios of the batch update repeated, one scenario per chunk
+        Idx const batch_size = 4;
+        double const nan = std::numeric_limits<double>::quiet_NaN();
+        std::array<double, batch_size> const q_specified{100.0, 300.0, 100.0, 300.0};
+        std::array<double, batch_size> const u_ref{0.5, nan, 0.5, nan};
+        ID const load_id = 2;
+        ID const source_id = 1;
+
+        struct Slot {
+            Buffer load{PGM_def_update_sym_load, 1};
+            Buffer source{PGM_def_update_source, 1};
+            Buffer node{PGM_def_sym_output_node, 2};
+            DatasetConst update{"update", true, 1};
+            DatasetMutable output{"sym_output", true, 1};
+        };
+        std::array<Slot, 3> slots;
+        for (auto& slot : slots) {
+            slot.load.set_nan();
+            slot.source.set_nan();
+            slot.load.set_value(PGM_def_update_sym_load_id, &load_id, -1);
+            slot.source.set_value(PGM_def_update_source_id, &source_id, -1);
+            slot.update.add_buffer("sym_load", 1, 1, nullptr, slot.load);
+            slot.update.add_buffer("source", 1, 1, nullptr, slot.source);
+            slot.output.add_buffer("node", 2, 2, nullptr, slot.node);
+        }
+
+        auto produce = [&](Idx slot_idx, Idx scenario_begin, Idx /* scenario_end */) {
+            auto& slot = slots[slot_idx];
+            slot.load.set_value(PGM_def_update_sym_load_q_specified, &q_specified[scenario_begin], -1);
+            slot.source.set_value(PGM_def_update_source_u_ref, &u_ref[scenario_begin], -1);
+            slot.node.set_nan();
+            return Model::BatchChunk{slot.update, slot.output};
+        };
+        std::vector<double> result_u(batch_size * 2);
+        auto consume = [&](Idx slot_idx, Idx scenario_begin, Idx /* scenario_end */) {
+            slots[slot_idx].node.get_value(PGM_def_sym_output_node_u, &result_u[scenario_begin * 2], -1);
+        };
+
+        SUBCASE("Results of all chunks") {
+            model.calculate_pipelined(options, batch_size, 1, produce, consume);
+            CHECK(result_u[0] == doctest::Approx(40.0));
+            CHECK(result_u[1] == doctest::Approx(0.0));
+            CHECK(result_u[2] == doctest::Approx(70.0));
+            CHECK(result_u[4] == doctest::Approx(40.0));
+            CHECK(result_u[6] == doctest::Approx(70.0));
+            CHECK(model.calculation_profile_n_scenarios() == batch_size);
+        }
+
+        SUBCASE("Exception in callback is re-thrown") {
+            auto throwing_produce = [&produce](Idx slot_idx, Idx scenario_begin, Idx scenario_end) {
+                if (scenario_begin == 2) {
+                    throw std::runtime_error{"producer failed"};
+                }
+                return produce(slot_idx, scenario_begin, scenario_end);
+            };
+            CHECK_THROWS_AS(model.calculate_pipelined(options, batch_size, 1, throwing_produce, consume),
+                            std::runtime_error);
+        }
+    }
+
+    SUBCASE("Reduced batch power flow") {
+        std::array<double, 2> u_maximum{};
+        std::array<double, 2> u_pu_mean{};
+        std::array<Idx, 2> u_arg_maximum{};
+        std::array<Idx, 2> n_u_above{};
+
+        BatchReduction reduction{"sym_output"};
+        reduction.add("node", "u", PGM_reduction_maximum, 0.0, u_maximum.data());
+        reduction.add("node", "u_pu", PGM_reduction_mean, 0.0, u_pu_mean.data());
+        reduction.add("node", "u", PGM_reduction_arg_maximum, 0.0, u_arg_maximum.data());
+        reduction.add("node", "u", PGM_reduction_count_above, 50.0, n_u_above.data());
+
+        model.calculate_reduced(options, reduction, batch_update_dataset);
+        CHECK(u_maximum[0] == doctest::Approx(70.0));
+        CHECK(u_maximum[1] == doctest::Approx(0.0));
+        CHECK(u_pu_mean[0] == doctest::Approx(0.55));
+        CHECK(u_pu_mean[1] == doctest::Approx(0.0));
+        CHECK(u_arg_maximum[0] == 1);
+        CHECK(u_arg_maximum[1] == 0);
+        CHECK(n_u_above[0] == 1);
+        CHECK(n_u_above[1] == 0);
+        CHECK(model.calculation_profile_n_scenarios() == 2);
+
+        SUBCASE("Output dataset mismatch") {
+            BatchReduction const asym_reduction{"asym_output"};
+            CHECK_THROWS_AS(model.calculate_reduced(options, asym_reduction, batch_update_dataset),
+                            PowerGridRegularError);
+        }
+        SUBCASE("Invalid request") {
+            CHECK_THROWS_AS(reduction.add("node", "loading", PGM_reduction_maximum, 0.0, u_maximum.data()),
+                            PowerGridRegularError);
+        }
+    }
+
+    SUBCASE("Calculation profile") {
+        Idx const n_entries = Model::calculation_profile_n_entries();
+        Idx const n_bins = Model::calculation_profile_n_histogram_bins();
+        REQUIRE(n_entries > 0);
+        REQUIRE(n_bins > 0);
+
+        Idx iterations_entry = -1;
+        for (Idx entry = 0; entry != n_entries; ++entry) {
+            if (Model::calculation_profile_entry_name(entry) == "Number of iterations") {
+                iterations_entry = entry;
+            }
+        }
+        REQUIRE(iterations_entry >= 0);
+        CHECK_THROWS_AS(Model::calculation_profile_entry_name(n_entries), PowerGridRegularError);
+        CHECK_THROWS_AS(Model::calculation_profile_entry_code(n_entries), PowerGridRegularError);
+
+        // power flow and state estimation keep their own code for the maximum number of iterations
+        std::vector<Idx> max_iterations_codes;
+        for (Idx entry = 0; entry != n_entries; ++entry) {
+            if (Model::calculation_profile_entry_name(entry) == "Max number of iterations") {
+                max_iterations_codes.push_back(Model::calculation_profile_entry_code(entry));
+            }
+        }
+        CHECK(max_iterations_codes == std::vector<Idx>{2226, 2228});
+
+        model.calculate(options, batch_output_dataset, batch_update_dataset);
+        Idx const n_scenarios = model.calculation_profile_n_scenarios();
+        CHECK(n_scenarios == 2);
+
+        std::vector<double> scenario_profile(n_scenarios * n_entries);
+        std::vector<double> aggregated_profile(n_entries);
+        std::vector<Idx> histogram(n_entries * n_bins);
+        model.get_calculation_profile(scenario_profile.data(), aggregated_profile.data(), histogram.data());
+
+        double const scenario_0_iterations = scenario_profile[iterations_entry];
+        double const scenario_1_iterations = scenario_profile[n_entries + iterations_entry];
+        CHECK(scenario_0_iterations >= 1.0);
+        CHECK(scenario_1_iterations >= 1.0);
+        CHECK(aggregated_profile[iterations_entry] == doctest::Approx(scenario_0_iterations + scenario_1_iterations));
+        auto const histogram_begin = histogram.cbegin() + iterations_entry * n_bins;
+        CHECK(std::accumulate(histogram_begin, histogram_begin + n_bins, Idx{0}) == n_scenarios);
+
+        // single calculation
+        model.calculate(options, single_output_dataset);
+        CHECK(model.calculation_profile_n_scenarios() == 1);
+        model.get_calculation_profile(nullptr, aggregated_profile.data(), nullptr);
+        CHECK(aggregated_profile[iterations_entry] >= 1.0);
+    }
+
+    SUBCASE("Warm start") {
+        Idx const n_entries = Model::calculation_profile_n_entries();
+        Idx iterations_entry = -1;
+        for (Idx entry = 0; entry != n_entries; ++entry) {
+            if (Model::calculation_profile_entry_name(entry) == "Number of iterations") {
+                iterations_entry = entry;
+            }
+        }
+        REQUIRE(iterations_entry >= 0);
+        auto const get_iterations = [&model, n_entries, iterations_entry]() {
+            std::vector<double> aggregated_profile(n_entries);
+            model.get_calculation_profile(nullptr, aggregated_profile.data(), nullptr);
+            return aggregated_profile[iterations_entry];
+        };
+        auto const check_u_pu = [&]() {
+            node_output.get_value(PGM_def_sym_output_node_u_pu, node_result_u_pu.data(), -1);
+            CHECK(node_result_u_pu[0] == doctest::Approx(0.5));
+        };
+
+        options.set_calculation_method(PGM_newton_raphson);
+
+        model.calculate(options, single_output_dataset);
+        check_u_pu();
+        double const cold_start_iterations = get_iterations();
+        CHECK(cold_start_iterations > 1.0);
+
+        SUBCASE("Previous calculation") {
+            options.set_warm_start(1);
+            model.calculate(options, single_output_dataset);
+            check_u_pu();
+            model.calculate(options, single_output_dataset);
+            check_u_pu();
+            CHECK(get_iterations() < cold_start_iterations);
+
+            options.set_warm_start(0);
+            model.calculate(options, single_output_dataset);
+            check_u_pu();
+            CHECK(get_iterations() == cold_start_iterations);
+        }
+
+        SUBCASE("Initial voltage in update data") {
+            std::vector<ID> const node_update_id{0};
+            std::vector<double> const node_update_u_init{0.5};
+            std::vector<double> const node_update_u_init_angle{0.0};
+            DatasetConst node_update_dataset{"update", false, 1};
+            node_update_dataset.add_buffer("node", 1, 1, nullptr, nullptr);
+            node_update_dataset.add_attribute_buffer("node", "id", node_update_id.data());
+            node_update_dataset.add_attribute_buffer("node", "u_init", node_update_u_init.data());
+            node_update_dataset.add_attribute_buffer("node", "u_init_angle", node_update_u_init_angle.data());
+
+            model.update(node_update_dataset);
+            model.calculate(options, single_output_dataset);
+            check_u_pu();
+            CHECK(get_iterations() < cold_start_iterations);
+
+            // a flat start ignores the initial voltage without removing it from the node
+            options.set_warm_start(-1);
+            model.calculate(options, single_output_dataset);
+            check_u_pu();
+            CHECK(get_iterations() == cold_start_iterations);
+
+            options.set_warm_start(0);
+            model.calculate(options, single_output_dataset);
+            check_u_pu();
+            CHECK(get_iterations() < cold_start_iterations);
+        }
+
+        SUBCASE("Initial voltage in batch update data") {
+            // only the first scenario sets an initial voltage
+            std::vector<Idx> const node_update_indptr{0, 1, 1};
+            std::vector<ID> const node_update_id{0};
+            std::vector<double> const node_update_u_init{0.5};
+            std::vector<double> const node_update_u_init_angle{0.0};
+            DatasetConst node_update_dataset{"update", true, 2};
+            node_update_dataset.add_buffer("node", -1, 1, node_update_indptr.data(), nullptr);
+            node_update_dataset.add_attribute_buffer("node", "id", node_update_id.data());
+            node_update_dataset.add_attribute_buffer("node", "u_init", node_update_u_init.data());
+            node_update_dataset.add_attribute_buffer("node", "u_init_angle", node_update_u_init_angle.data());
+
+            model.calculate(options, batch_output_dataset, node_update_dataset);
+            node_batch_output.get_value(PGM_def_sym_output_node_u_pu, batch_node_result_u_pu.data(), -1);
+            CHECK(batch_node_result_u_pu[0] == doctest::Approx(0.5));
+            CHECK(batch_node_result_u_pu[2] == doctest::Approx(0.5));
+
+            REQUIRE(model.calculation_profile_n_scenarios() == 2);
+            std::vector<double> scenario_profile(2 * n_entries);
+            model.get_calculation_profile(scenario_profile.data(), nullptr, nullptr);
+            CHECK(scenario_profile[iterations_entry] < cold_start_iterations);
+            // the second scenario is calculated as if the first one had not set the initial voltage
+            CHECK(scenario_profile[n_entries + iterations_entry] == cold_start_iterations);
+
+            // the initial voltage of the batch does not remain on the model either
+            model.calculate(options, single_output_dataset);
+            check_u_pu();
+            CHECK(get_iterations() == cold_start_iterations);
+        }
+    }
+
     SUBCASE("Input error handling") {
         SUBCASE("Construction error") {
             auto const bad_load_id_state_json = R"json({
@@ -850,11 +1121,11 @@ TEST_CASE("API Model") {
         constexpr auto all_types = std::array{PGM_power_flow, PGM_state_estimation, PGM_short_circuit};
         constexpr auto all_methods =
             std::array{PGM_default_method,    PGM_linear,           PGM_newton_raphson, PGM_linear_current,
-                       PGM_iterative_current, PGM_iterative_linear, PGM_iec60909};
+                       PGM_iterative_current, PGM_iterative_linear, PGM_iec60909,       PGM_fast_decoupled};
 
         auto supported_methods = std::map<PGM_CalculationType, std::vector<PGM_CalculationMethod>>{
             {PGM_power_flow, std::vector{PGM_default_method, PGM_newton_raphson, PGM_linear, PGM_linear_current,
-                                         PGM_iterative_current}},
+                                         PGM_iterative_current, PGM_fast_decoupled}},
             {PGM_state_estimation, std::vector{PGM_default_method, PGM_iterative_linear, PGM_newton_raphson}},
             {PGM_short_circuit, std::vector{PGM_default_method, PGM_iec60909}}};
 
@@ -1105,4 +1376,351 @@ TEST_CASE("API Model") {
     }
 }
 
+TEST_CASE("API Model - multi-threading") {
+    // islands of rings of nodes, each with a source and a load per node
+    constexpr Idx n_islands = 4;
+    constexpr Idx n_nodes_per_island = 1000;
+    constexpr Idx n_nodes = n_islands * n_nodes_per_island;
+
+    std::vector<ID> node_id(n_nodes);
+    std::vector<double> const node_u_rated(n_nodes, 10.0e3);
+    std::vector<ID> line_id(n_nodes);
+    std::vector<ID> line_from_node(n_nodes);
+    std::vector<ID> line_to_node(n_nodes);
+    std::vector<int8_t> const line_status(n_nodes, 1);
+    std::vector<double> const line_r1(n_nodes, 0.01);
+    std::vector<double> const line_x1(n_nodes, 0.02);
+    std::vector<double> const line_c1(n_nodes, 0.0);
+    std::vector<double> const line_tan1(n_nodes, 0.0);
+    std::vector<ID> load_id(n_nodes);
+    std::vector<int8_t> const load_status(n_nodes, 1);
+    std::vector<int8_t> const load_type(n_nodes, 0);
+    std::vector<double> const load_p_specified(n_nodes, 1.0e3);
+    std::vector<double> const load_q_specified(n_nodes, 0.0);
+    std::vector<ID> source_id(n_islands);
+    std::vector<ID> source_node(n_islands);
+    std::vector<int8_t> const source_status(n_islands, 1);
+    std::vector<double> const source_u_ref(n_islands, 1.0);
+
+    for (Idx idx = 0; idx != n_nodes; ++idx) {
+        Idx const island_begin = idx - (idx % n_nodes_per_island);
+        node_id[idx] = static_cast<ID>(idx);
+        line_id[idx] = static_cast<ID>(n_nodes + idx);
+        line_from_node[idx] = static_cast<ID>(idx);
+        line_to_node[idx] = static_cast<ID>(island_begin + ((idx + 1) % n_nodes_per_island));
+        load_id[idx] = static_cast<ID>(2 * n_nodes + idx);
+    }
+    for (Idx island = 0; island != n_islands; ++island) {
+        source_id[island] = static_cast<ID>(3 * n_nodes + island);
+        source_node[island] = static_cast<ID>(island * n_nodes_per_island);
+    }
+
+    DatasetConst input_dataset{"input", false, 1};
+    input_dataset.add_buffer("node", n_nodes, n_nodes, nullptr, nullptr);
+    input_dataset.add_attribute_buffer("node", "id", node_id.data());
+    input_dataset.add_attribute_buffer("node", "u_rated", node_u_rated.data());
+    input_dataset.add_buffer("line", n_nodes, n_nodes, nullptr, nullptr);
+    input_dataset.add_attribute_buffer("line", "id", line_id.data());
+    input_dataset.add_attribute_buffer("line", "from_node", line_from_node.data());
+    input_dataset.add_attribute_buffer("line", "to_node", line_to_node.data());
+    input_dataset.add_attribute_buffer("line", "from_status", line_status.data());
+    input_dataset.add_attribute_buffer("line", "to_status", line_status.data());
+    input_dataset.add_attribute_buffer("line", "r1", line_r1.data());
+    input_dataset.add_attribute_buffer("line", "x1", line_x1.data());
+    input_dataset.add_attribute_buffer("line", "c1", line_c1.data());
+    input_dataset.add_attribute_buffer("line", "tan1", line_tan1.data());
+    input_dataset.add_buffer("sym_load", n_nodes, n_nodes, nullptr, nullptr);
+    input_dataset.add_attribute_buffer("sym_load", "id", load_id.data());
+    input_dataset.add_attribute_buffer("sym_load", "node", node_id.data());
+    input_dataset.add_attribute_buffer("sym_load", "status", load_status.data());
+    input_dataset.add_attribute_buffer("sym_load", "type", load_type.data());
+    input_dataset.add_attribute_buffer("sym_load", "p_specified", load_p_specified.data());
+    input_dataset.add_attribute_buffer("sym_load", "q_specified", load_q_specified.data());
+    input_dataset.add_buffer("source", n_islands, n_islands, nullptr, nullptr);
+    input_dataset.add_attribute_buffer("source", "id", source_id.data());
+    input_dataset.add_attribute_buffer("source", "node", source_node.data());
+    input_dataset.add_attribute_buffer("source", "status", source_status.data());
+    input_dataset.add_attribute_buffer("source", "u_ref", source_u_ref.data());
+
+    auto const calculate = [](Model& model, Options const& options) {
+        std::vector<double> u_pu(n_nodes);
+        DatasetMutable output_dataset{"sym_output", false, 1};
+        output_dataset.add_buffer("node", n_nodes, n_nodes, nullptr, nullptr);
+        output_dataset.add_attribute_buffer("node", "u_pu", u_pu.data());
+        model.calculate(options, output_dataset);
+        return u_pu;
+    };
+    Model sequential_model{50.0, input_dataset};
+    std::vector<double> const sequential_u_pu = calculate(sequential_model, Options{});
+    CHECK(sequential_u_pu.front() == doctest::Approx(1.0));
+    CHECK(sequential_u_pu[n_nodes_per_island / 2] < 1.0);
+
+    SUBCASE("Same result as sequential construction") {
+        for (Idx const threading : {0, 2, 4}) {
+            CAPTURE(threading);
+            Model threaded_model{50.0, input_dataset, threading};
+            CHECK(calculate(threaded_model, Options{}) == sequential_u_pu);
+        }
+    }
+
+    SUBCASE("Same result as sequential calculation of the islands") {
+        for (Idx const island_threading : {0, 2, 3, 8}) {
+            CAPTURE(island_threading);
+            Options options{};
+            options.set_island_threading(island_threading);
+            CHECK(calculate(sequential_model, options) == sequential_u_pu);
+        }
+    }
+
+    SUBCASE("Same result as the linear power flow of the scenarios one by one") {
+        constexpr Idx n_scenarios = 10;
+        constexpr Idx outage_scenario = 5;
+        // pairs of consecutive scenarios have the same loads, one scenario has a line outage
+        std::vector<ID> update_load_id(n_scenarios * n_nodes);
+        std::vector<double> update_load_p(n_scenarios * n_nodes);
+        std::vector<ID> update_line_id(n_scenarios, line_id[1]);
+        std::vector<int8_t> update_line_status(n_scenarios, 1);
+        for (Idx scenario = 0; scenario != n_scenarios; ++scenario) {
+            for (Idx idx = 0; idx != n_nodes; ++idx) {
+                update_load_id[scenario * n_nodes + idx] = load_id[idx];
+                update_load_p[scenario * n_nodes + idx] = load_p_specified[idx] * (1.0 + 0.1 * (scenario / 2));
+            }
+        }
+        update_line_status[outage_scenario] = 0;
+        DatasetConst update_dataset{"update", true, n_scenarios};
+        update_dataset.add_buffer("sym_load", n_nodes, n_scenarios * n_nodes, nullptr, nullptr);
+        update_dataset.add_attribute_buffer("sym_load", "id", update_load_id.data());
+        update_dataset.add_attribute_buffer("sym_load", "p_specified", update_load_p.data());
+        update_dataset.add_buffer("line", 1, n_scenarios, nullptr, nullptr);
+        update_dataset.add_attribute_buffer("line", "id", update_line_id.data());
+        update_dataset.add_attribute_buffer("line", "from_status", update_line_status.data());
+
+        auto const calculate_batch = [&sequential_model, &update_dataset](Options const& options) {
+            std::vector<double> u_pu(n_scenarios * n_nodes);
+            DatasetMutable output_dataset{"sym_output", true, n_scenarios};
+            output_dataset.add_buffer("node", n_nodes, n_scenarios * n_nodes, nullptr, nullptr);
+            output_dataset.add_attribute_buffer("node", "u_pu", u_pu.data());
+            sequential_model.calculate(options, output_dataset, update_dataset);
+            return u_pu;
+        };
+        for (auto const method : {PGM_linear, PGM_linear_current}) {
+            CAPTURE(method);
+            Options options{};
+            options.set_calculation_method(method);
+            std::vector<double> const reference_u_pu = calculate_batch(options);
+            // the loads increase every other scenario, the outage separates node 2 from the nearby source node
+            Idx const node = 2;
+            CHECK(reference_u_pu[node] == reference_u_pu[n_nodes + node]);
+            CHECK(reference_u_pu[node] > reference_u_pu[(2 * n_nodes) + node]);
+            CHECK(reference_u_pu[(outage_scenario * n_nodes) + node] <
+                  reference_u_pu[((outage_scenario - 1) * n_nodes) + node]);
+
+            for (Idx const linear_panel_size : {2, 4, 16}) {
+                for (Idx const threading : {-1, 2}) {
+                    CAPTURE(linear_panel_size);
+                    CAPTURE(threading);
+                    options.set_linear_panel_size(linear_panel_size);
+                    options.set_threading(threading);
+                    CHECK(calculate_batch(options) == reference_u_pu);
+                }
+            }
+        }
+    }
+
+    SUBCASE("Same error as sequential construction") {
+        auto const check_error = [&input_dataset](std::string const& message) {
+            CHECK_THROWS_WITH_AS((Model{50.0, input_dataset}), message, PowerGridRegularError);
+            CHECK_THROWS_WITH_AS((Model{50.0, input_dataset, 4}), message, PowerGridRegularError);
+        };
+
+        // the first error in the order of the input is reported
+        line_to_node[3000] = -1;
+        check_error("The id cannot be found: -1\n");
+        line_id[2000] = line_id[1000];
+        check_error("Conflicting id detected: " + std::to_string(line_id[1000]) + "\n");
+        line_to_node[500] = -2;
+        check_error("The id cannot be found: -2\n");
+    }
+}
+
+
+TEST_CASE("API Model - snapshot") {
+    // islands of rings of nodes, each with a source and a load per node
+    constexpr Idx n_islands = 2;
+    constexpr Idx n_nodes_per_island = 8;
+    constexpr Idx n_nodes = n_islands * n_nodes_per_island;
+
+    std::vector<ID> node_id(n_nodes);
+    std::vector<double> const node_u_rated(n_nodes, 10.0e3);
+    std::vector<ID> line_id(n_nodes);
+    std::vector<ID> line_from_node(n_nodes);
+    std::vector<ID> line_to_node(n_nodes);
+    std::vector<int8_t> const line_status(n_nodes, 1);
+    std::vector<double> const line_r1(n_nodes, 0.01);
+    std::vector<double> const line_x1(n_nodes, 0.02);
+    std::vector<double> const line_c1(n_nodes, 0.0);
+    std::vector<double> const line_tan1(n_nodes, 0.0);
+    std::vector<ID> load_id(n_nodes);
+    std::vector<int8_t> const load_status(n_nodes, 1);
+    std::vector<int8_t> const load_type(n_nodes, 0);
+    std::vector<double> const load_p_specified(n_nodes, 1.0e5);
+    std::vector<double> const load_q_specified(n_nodes, 0.0);
+    std::vector<ID> source_id(n_islands);
+    std::vector<ID> source_node(n_islands);
+    std::vector<int8_t> const source_status(n_islands, 1);
+    std::vector<double> const source_u_ref(n_islands, 1.0);
+
+    for (Idx idx = 0; idx != n_nodes; ++idx) {
+        Idx const island_begin = idx - (idx % n_nodes_per_island);
+        node_id[idx] = static_cast<ID>(idx);
+        line_id[idx] = static_cast<ID>(n_nodes + idx);
+        line_from_node[idx] = static_cast<ID>(idx);
+        line_to_node[idx] = static_cast<ID>(island_begin + ((idx + 1) % n_nodes_per_island));
+        load_id[idx] = static_cast<ID>(2 * n_nodes + idx);
+    }
+    for (Idx island = 0; island != n_islands; ++island) {
+        source_id[island] = static_cast<ID>(3 * n_nodes + island);
+        source_node[island] = static_cast<ID>(island * n_nodes_per_island);
+    }
+
+    DatasetConst input_dataset{"input", false, 1};
+    input_dataset.add_buffer("node", n_nodes, n_nodes, nullptr, nullptr);
+    input_dataset.add_attribute_buffer("node", "id", node_id.data());
+    input_dataset.add_attribute_buffer("node", "u_rated", node_u_rated.data());
+    input_dataset.add_buffer("line", n_nodes, n_nodes, nullptr, nullptr);
+    input_dataset.add_attribute_buffer("line", "id", line_id.data());
+    input_dataset.add_attribute_buffer("line", "from_node", line_from_node.data());
+    input_dataset.add_attribute_buffer("line", "to_node", line_to_node.data());
+    input_dataset.add_attribute_buffer("line", "from_status", line_status.data());
+    input_dataset.add_attribute_buffer("line", "to_status", line_status.data());
+    input_dataset.add_attribute_buffer("line", "r1", line_r1.data());
+    input_dataset.add_attribute_buffer("line", "x1", line_x1.data());
+    input_dataset.add_attribute_buffer("line", "c1", line_c1.data());
+    input_dataset.add_attribute_buffer("line", "tan1", line_tan1.data());
+    input_dataset.add_buffer("sym_load", n_nodes, n_nodes, nullptr, nullptr);
+    input_dataset.add_attribute_buffer("sym_load", "id", load_id.data());
+    input_dataset.add_attribute_buffer("sym_load", "node", node_id.data());
+    input_dataset.add_attribute_buffer("sym_load", "status", load_status.data());
+    input_dataset.add_attribute_buffer("sym_load", "type", load_type.data());
+    input_dataset.add_attribute_buffer("sym_load", "p_specified", load_p_specified.data());
+    input_dataset.add_attribute_buffer("sym_load", "q_specified", load_q_specified.data());
+    input_dataset.add_buffer("source", n_islands, n_islands, nullptr, nullptr);
+    input_dataset.add_attribute_buffer("source", "id", source_id.data());
+    input_dataset.add_attribute_buffer("source", "node", source_node.data());
+    input_dataset.add_attribute_buffer("source", "status", source_status.data());
+    input_dataset.add_attribute_buffer("source", "u_ref", source_u_ref.data());
+
+    auto const calculate = [](Model& model) {
+        std::vector<double> u_pu(n_nodes);
+        DatasetMutable output_dataset{"sym_output", false, 1};
+        output_dataset.add_buffer("node", n_nodes, n_nodes, nullptr, nullptr);
+        output_dataset.add_attribute_buffer("node", "u_pu", u_pu.data());
+        model.calculate(Options{}, output_dataset);
+        return u_pu;
+    };
+    Model model{50.0, input_dataset};
+    std::vector<double> const u_pu = calculate(model);
+    CHECK(u_pu.front() == doctest::Approx(1.0));
+    CHECK(u_pu[n_nodes_per_island / 2] < 1.0);
+
+    // a unique file per run, removed at the end of every subcase
+    struct TemporaryFile {
+        std::filesystem::path path{std::filesystem::temp_directory_path() /
+                                   ("power_grid_model_test_api_snapshot_" + std::to_string(std::random_device{}()) +
+                                    "_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()))};
+
+        TemporaryFile() = default;
+        TemporaryFile(TemporaryFile const&) = delete;
+        TemporaryFile& operator=(TemporaryFile const&) = delete;
+        TemporaryFile(TemporaryFile&&) = delete;
+        TemporaryFile& operator=(TemporaryFile&&) = delete;
+        ~TemporaryFile() {
+            std::error_code error;
+            std::filesystem::remove(path, error);
+        }
+    };
+    TemporaryFile const snapshot_file;
+    std::string const file_path = snapshot_file.path.string();
+    Model::save_snapshot(file_path, 50.0, input_dataset);
+
+    SUBCASE("Same result as the model created from the input") {
+        Model restored_model = Model::load_snapshot(file_path);
+        CHECK(calculate(restored_model) == u_pu);
+
+        // the topology is built again after a change
+        std::vector<ID> const update_line_id{line_id[0], line_id[n_nodes_per_island]};
+        std::vector<int8_t> const update_line_status{0, 0};
+        DatasetConst update_dataset{"update", false, 1};
+        update_dataset.add_buffer("line", 2, 2, nullptr, nullptr);
+        update_dataset.add_attribute_buffer("line", "id", update_line_id.data());
+        update_dataset.add_attribute_buffer("line", "from_status", update_line_status.data());
+        restored_model.update(update_dataset);
+        model.update(update_dataset);
+        std::vector<double> const updated_u_pu = calculate(model);
+        CHECK(updated_u_pu != u_pu);
+        CHECK(calculate(restored_model) == updated_u_pu);
+    }
+
+    SUBCASE("Invalid snapshot") {
+        std::ifstream input_file{file_path, std::ios::binary};
+        std::string const snapshot{std::istreambuf_iterator<char>{input_file}, std::istreambuf_iterator<char>{}};
+        input_file.close();
+        auto const write_file = [&file_path](std::string const& content) {
+            std::ofstream file{file_path, std::ios::binary | std::ios::trunc};
+            file.write(content.data(), static_cast<std::streamsize>(content.size()));
+        };
+
+        SUBCASE("Truncated") {
+            write_file(snapshot.substr(0, snapshot.size() / 2));
+            CHECK_THROWS_WITH_AS(Model::load_snapshot(file_path), "The model snapshot is truncated!\n",
+                                 PowerGridSerializationError);
+        }
+        SUBCASE("Not a snapshot") {
+            write_file("not a snapshot");
+            CHECK_THROWS_AS(Model::load_snapshot(file_path), PowerGridSerializationError);
+        }
+        SUBCASE("Other format version") {
+            // the format version follows the magic of 8 bytes, aligned to 16 bytes
+            std::string other_version = snapshot;
+            ++other_version[16];
+            write_file(other_version);
+            CHECK_THROWS_AS(Model::load_snapshot(file_path), PowerGridSerializationError);
+        }
+        SUBCASE("Corrupted topology indices") {
+            // the snapshot ends with the coupling of the sources, followed by the empty coupling of the voltage,
+            // power and current sensors and of the regulators, every item aligned to 16 bytes
+            constexpr size_t n_empty_coupling = 4;
+            constexpr size_t alignment = 16;
+            size_t const last_source_offset = snapshot.size() - ((n_empty_coupling + 1) * alignment);
+            auto const write_last_source_coupling = [&](Idx group, Idx pos) {
+                std::string corrupted = snapshot;
+                std::memcpy(corrupted.data() + last_source_offset, &group, sizeof(Idx));
+                std::memcpy(corrupted.data() + last_source_offset + sizeof(Idx), &pos, sizeof(Idx));
+                write_file(corrupted);
+            };
+            std::string const message = "The restored topology does not match the components of the model!\n";
+
+            // the source of the last island is coupled to the first source of its math model
+            write_last_source_coupling(n_islands - 1, 0);
+            Model restored_model = Model::load_snapshot(file_path);
+            CHECK(calculate(restored_model) == u_pu);
+
+            // out of range of the sources of the math model
+            write_last_source_coupling(n_islands - 1, 1);
+            CHECK_THROWS_WITH_AS(Model::load_snapshot(file_path), message, PowerGridSerializationError);
+            // out of range of the math models
+            write_last_source_coupling(n_islands, 0);
+            CHECK_THROWS_WITH_AS(Model::load_snapshot(file_path), message, PowerGridSerializationError);
+            // in range, but the first source is coupled to the same element of the other math model
+            write_last_source_coupling(0, 0);
+            CHECK_THROWS_WITH_AS(Model::load_snapshot(file_path), message, PowerGridSerializationError);
+        }
+    }
+
+    SUBCASE("Missing file") {
+        std::filesystem::remove(file_path);
+        CHECK_THROWS_AS(Model::load_snapshot(file_path), PowerGridSerializationError);
+    }
+}
+
 } // namespace power_grid_model_cpp
@@ -829,4 +829,80 @@ TEST_CASE("API model - Incomplete scenario update followed by complete") {
     }
 }
 
+namespace {
+auto const transformer_state_json = R"json({
+  "version": "1.0",
+  "type": "input",
+  "is_batch": false,
+  "attributes": {},
+  "data": {
+    "node": [
+      {"id": 1, "u_rated": 10000},
+      {"id": 2, "u_rated": 400},
+      {"id": 3, "u_rated": 400}
+    ],
+    "transformer": [
+      {"id": 4, "from_node": 1, "to_node": 2, "from_status": 1, "to_status": 1, "u1": 10000, "u2": 400, "sn": 1000000, "uk": 0.06, "pk": 10000, "i0": 0.01, "p0": 1000, "winding_from": 2, "winding_to": 1, "clock": 5, "tap_side": 0, "tap_pos": 0, "tap_min": -5, "tap_max": 5, "tap_nom": 0, "tap_size": 250}
+    ],
+    "line": [
+      {"id": 5, "from_node": 2, "to_node": 3, "from_status": 1, "to_status": 1, "r1": 0.01, "x1": 0.01, "c1": 0, "tan1": 0, "r0": 0.01, "x0": 0.01, "c0": 0, "tan0": 0, "i_n": 1000}
+    ],
+    "source": [
+      {"id": 6, "node": 1, "status": 1, "u_ref": 1.0, "sk": 1000000000}
+    ],
+    "sym_load": [
+      {"id": 7, "node": 3, "status": 1, "type": 0, "p_specified": 200000, "q_specified": 50000}
+    ],
+    "shunt": [
+      {"id": 8, "node": 3, "status": 1, "g1": 0.01, "b1": 0.01, "g0": 0.01, "b0": 0.01}
+    ]
+  }
+})json"s;
+} // namespace
+
+TEST_CASE("API model - tap position updates") {
+    auto const owning_input_dataset = load_dataset(transformer_state_json);
+    auto const& input_data = owning_input_dataset.dataset;
+
+    ID const transformer_id = 4;
+    Buffer transformer_update{PGM_def_update_transformer, 1};
+    transformer_update.set_nan();
+    transformer_update.set_value(PGM_def_update_transformer_id, &transformer_id, -1);
+    DatasetConst update_data{"update", false, 1};
+    update_data.add_buffer("transformer", 1, 1, nullptr, transformer_update);
+
+    auto const calculate_u_pu = [](Model& calculation_model, PGM_SymmetryType symmetry) {
+        auto const output_type = symmetry == PGM_symmetric ? "sym_output"s : "asym_output"s;
+        std::vector<double> node_output_u_pu((symmetry == PGM_symmetric ? 1 : 3) * 3);
+        DatasetMutable output_data{output_type, false, 1};
+        output_data.add_buffer("node", 3, 3, nullptr, nullptr);
+        output_data.add_attribute_buffer("node", "u_pu", node_output_u_pu.data());
+        calculation_model.calculate(get_default_options(symmetry, PGM_newton_raphson), output_data);
+        return node_output_u_pu;
+    };
+
+    for (auto symmetry : {PGM_symmetric, PGM_asymmetric}) {
+        CAPTURE(symmetry);
+
+        // after the first calculation, only the parameters of the updated transformer are recalculated
+        auto model = Model{50.0, input_data};
+        calculate_u_pu(model, symmetry);
+
+        for (IntS const tap_pos : {IntS{-5}, IntS{2}, IntS{3}, IntS{5}, IntS{0}}) {
+            CAPTURE(tap_pos);
+            transformer_update.set_value(PGM_def_update_transformer_tap_pos, &tap_pos, -1);
+            model.update(update_data);
+
+            auto ref_model = Model{50.0, input_data};
+            ref_model.update(update_data);
+
+            auto const u_pu = calculate_u_pu(model, symmetry);
+            auto const ref_u_pu = calculate_u_pu(ref_model, symmetry);
+            for (Idx idx = 0; idx != std::ssize(u_pu); ++idx) {
+                CAPTURE(idx);
+                CHECK(u_pu[idx] == doctest::Approx(ref_u_pu[idx]));
+            }
+        }
+    }
+}
 } // namespace power_grid_model_cpp
@@ -10,6 +10,8 @@
 #include <nlohmann/json.hpp>
 
 #include <cmath>
+#include <filesystem>
+#include <fstream>
 #include <limits>
 #include <string>
 #include <vector>
@@ -155,6 +157,29 @@ TEST_CASE("API Serialization and Deserialization") {
 
         check_deserializer(json_deserializer);
         check_deserializer(msgpack_deserializer);
+
+        // memory mapped msgpack file
+        auto const file_path = std::filesystem::temp_directory_path() / "power_grid_model_test_api_deserializer";
+        {
+            std::ofstream file{file_path, std::ios::binary};
+            file.write(msgpack_data.data(), static_cast<std::streamsize>(msgpack_data.size()));
+        }
+        {
+            Deserializer file_deserializer{file_path, 1};
+            check_deserializer(file_deserializer);
+
+            // parse a scenario range
+            CHECK(file_deserializer.get_scenario_range_total_elements("source", 0, 1) == 2);
+            CHECK(file_deserializer.get_scenario_range_total_elements("source", 1, 1) == 0);
+            source_buffer_2.set_nan();
+            file_deserializer.parse_to_buffer(0, 1);
+            std::vector<ID> source_2_id(2);
+            source_buffer_2.get_value(PGM_def_input_source_id, source_2_id.data(), -1);
+            CHECK(source_2_id == source_id);
+            CHECK_THROWS_AS(file_deserializer.parse_to_buffer(0, 2), PowerGridSerializationError);
+        }
+        std::filesystem::remove(file_path);
+        CHECK_THROWS_AS((Deserializer{file_path, 1}), PowerGridSerializationError);
     }
 
     SUBCASE("Deserializer with columnar data") {
@@ -27,6 +27,10 @@ calculation_function_arguments_map: dict[str, tuple[Callable, list[str]]] = {
             "output_component_types",
             "continue_on_batch_error",
             "tap_changing_strategy",
+            "warm_start",
+            "island_threading",
+            "linear_panel_size",
+            "tap_sensitivity_search",
             "experimental_features",
         ],
     ),
@@ -41,6 +45,7 @@ calculation_function_arguments_map: dict[str, tuple[Callable, list[str]]] = {
             "threading",
             "output_component_types",
             "continue_on_batch_error",
+            "island_threading",
             "experimental_features",
         ],
     ),
@@ -53,6 +58,8 @@ calculation_function_arguments_map: dict[str, tuple[Callable, list[str]]] = {
             "output_component_types",
             "continue_on_batch_error",
             "short_circuit_voltage_scaling",
+            "short_circuit_sweep",
+            "island_threading",
             "experimental_features",
         ],
     ),
@@ -185,3 +192,168 @@ def test_batch_validation(
         result_list = convert_batch_dataset_to_batch_list(result_batch)
         for result, reference_result in zip(result_list, reference_output_list):
             compare_result(result, reference_result, rtol, atol)
+
+
+def check_single_validation_with_options(
+    case_path: Path,
+    sym: bool,
+    calculation_type: str,
+    calculation_method: str,
+    rtol: float,
+    atol: float,
+    params: dict,
+    **options,
+):
+    """Run a single validation case with calculation options that do not change the result."""
+    case_data = import_case_data(case_path, calculation_type=calculation_type, sym=sym)
+    model = PowerGridModelWithExt(case_data["input"], system_frequency=50.0)
+
+    calculation_function, calculation_args = calculation_function_arguments_map[calculation_type]
+    assert set(options) <= set(calculation_args)
+    base_kwargs = get_kwargs(
+        sym=sym, calculation_type=calculation_type, calculation_method=calculation_method, params=params, **options
+    )
+
+    result = calculation_function(model, **supported_kwargs(kwargs=base_kwargs, supported=calculation_args))
+    compare_result(result, case_data["output"], rtol, atol)
+
+
+def check_batch_validation_with_options(
+    case_path: Path,
+    sym: bool,
+    calculation_type: str,
+    calculation_method: str,
+    rtol: float,
+    atol: float,
+    params: dict,
+    **options,
+):
+    """Run a batch validation case with calculation options that do not change the result."""
+    case_data = import_case_data(case_path, calculation_type=calculation_type, sym=sym)
+    model = PowerGridModelWithExt(case_data["input"], system_frequency=50.0)
+    reference_output_list = convert_batch_dataset_to_batch_list(case_data["output_batch"])
+
+    calculation_function, calculation_args = calculation_function_arguments_map[calculation_type]
+    assert set(options) <= set(calculation_args)
+    base_kwargs = get_kwargs(
+        sym=sym, calculation_type=calculation_type, calculation_method=calculation_method, params=params, **options
+    )
+
+    for threading in [-1, 2]:
+        kwargs = dict(base_kwargs, update_data=case_data["update_batch"], threading=threading)
+        result_batch = calculation_function(model, **supported_kwargs(kwargs=kwargs, supported=calculation_args))
+        result_list = convert_batch_dataset_to_batch_list(result_batch)
+        for result, reference_result in zip(result_list, reference_output_list):
+            compare_result(result, reference_result, rtol, atol)
+
+
+@pytest.mark.parametrize("warm_start", [-1, 1], ids=["flat-start", "warm-start"])
+@pytest.mark.parametrize(
+    ["case_id", "case_path", "sym", "calculation_type", "calculation_method", "rtol", "atol", "params"],
+    pytest_cases(get_batch_cases=True, data_dir="power_flow", test_cases=["power_flow/dummy-test-batch-newton"]),
+)
+def test_batch_validation_warm_start(
+    case_id: str,
+    case_path: Path,
+    sym: bool,
+    calculation_type: str,
+    calculation_method: str,
+    rtol: float,
+    atol: float,
+    params: dict,
+    warm_start: int,
+):
+    check_batch_validation_with_options(
+        case_path, sym, calculation_type, calculation_method, rtol, atol, params, warm_start=warm_start
+    )
+
+
+@pytest.mark.parametrize(
+    ["case_id", "case_path", "sym", "calculation_type", "calculation_method", "rtol", "atol", "params"],
+    pytest_cases(get_batch_cases=True, data_dir="short_circuit"),
+)
+def test_batch_validation_short_circuit_sweep(
+    case_id: str,
+    case_path: Path,
+    sym: bool,
+    calculation_type: str,
+    calculation_method: str,
+    rtol: float,
+    atol: float,
+    params: dict,
+):
+    check_batch_validation_with_options(
+        case_path, sym, calculation_type, calculation_method, rtol, atol, params, short_circuit_sweep=True
+    )
+
+
+@pytest.mark.parametrize(
+    ["case_id", "case_path", "sym", "calculation_type", "calculation_method", "rtol", "atol", "params"],
+    pytest_cases(get_batch_cases=False),
+)
+def test_single_validation_island_threading(
+    case_id: str,
+    case_path: Path,
+    sym: bool,
+    calculation_type: str,
+    calculation_method: str,
+    rtol: float,
+    atol: float,
+    params: dict,
+):
+    check_single_validation_with_options(
+        case_path, sym, calculation_type, calculation_method, rtol, atol, params, island_threading=2
+    )
+
+
+@pytest.mark.parametrize(
+    ["case_id", "case_path", "sym", "calculation_type", "calculation_method", "rtol", "atol", "params"],
+    pytest_cases(get_batch_cases=True, data_dir="power_flow", test_cases=["power_flow/dummy-test-batch"]),
+)
+def test_batch_validation_linear_panel_size(
+    case_id: str,
+    case_path: Path,
+    sym: bool,
+    calculation_type: str,
+    calculation_method: str,
+    rtol: float,
+    atol: float,
+    params: dict,
+):
+    check_batch_validation_with_options(
+        case_path, sym, calculation_type, calculation_method, rtol, atol, params, linear_panel_size=4
+    )
+
+
+@pytest.mark.parametrize(
+    ["case_id", "case_path", "sym", "calculation_type", "calculation_method", "rtol", "atol", "params"],
+    pytest_cases(
+        get_batch_cases=False,
+        data_dir="power_flow",
+        test_cases=[
+            "power_flow/automatic-tap-regulator/auto-tap-changer-meshed-any",
+            "power_flow/automatic-tap-regulator/auto-tap-changer-meshed-fast-any",
+            "power_flow/automatic-tap-regulator/pgm-automatic-tap-any",
+            "power_flow/automatic-tap-regulator/pgm-automatic-tap-line-drop-any",
+            "power_flow/automatic-tap-regulator/pgm-automatic-tap-tight-bands",
+            "power_flow/automatic-tap-regulator/single-trafo-any-valid-tap",
+            "power_flow/automatic-tap-regulator/step-up-transformer-any-valid-tap",
+            "power_flow/automatic-tap-regulator/step-up-transformer-fast-any-tap",
+            "power_flow/automatic-tap-regulator/trafo-control-tap-same-side-any-valid-tap",
+            "power_flow/automatic-tap-regulator/trafo-control-tap-same-side-fast-any-tap",
+        ],
+    ),
+)
+def test_single_validation_tap_sensitivity_search(
+    case_id: str,
+    case_path: Path,
+    sym: bool,
+    calculation_type: str,
+    calculation_method: str,
+    rtol: float,
+    atol: float,
+    params: dict,
+):
+    check_single_validation_with_options(
+        case_path, sym, calculation_type, calculation_method, rtol, atol, params, tap_sensitivity_search=True
+    )
@@ -200,7 +200,9 @@ def test_single_calculation_error(model: PowerGridModel):
     with pytest.raises(InvalidCalculationMethod, match="The calculation method is invalid for this calculation!"):
         model.calculate_state_estimation(calculation_method="iterative_current")
 
-    for calculation_method in ("linear", "newton_raphson", "iterative_current", "linear_current", "iterative_linear"):
+    for calculation_method in (
+        "linear", "newton_raphson", "iterative_current", "linear_current", "iterative_linear", "fast_decoupled"
+    ):
         with pytest.raises(InvalidCalculationMethod):
             model.calculate_short_circuit(calculation_method=calculation_method)
 